@@ -65,10 +65,13 @@ Fitness::Handle KnapsackEvalOp::evaluate(Individual& inIndividual, Context& ioCo
 	GA::BitString::Handle lBitString = castHandleT<GA::BitString>(inIndividual[0]);
 	float lValue  = 0.0;
 	float lWeight = 0.0;
-	for(unsigned int i=0; i<lBitString->size(); ++i) {
-		if((*lBitString)[i]) {
-			lValue  += (*mObjectValues)[i];
-			lWeight += (*mObjectWeights)[i];
+	for(unsigned int i=0; i<lBitString->getNumberWords(); ++i) {
+		GA::BitString::Word lWord = lBitString->getWord(i);
+		for(unsigned int j=i*GA::BitString::eWordBits; lWord!=0; ++j, lWord>>=1) {
+			if(lWord & 1) {
+				lValue  += (*mObjectValues)[j];
+				lWeight += (*mObjectWeights)[j];
+			}
 		}
 	}
 	FitnessMultiObj::Handle lFitness = new FitnessMultiObj(2);
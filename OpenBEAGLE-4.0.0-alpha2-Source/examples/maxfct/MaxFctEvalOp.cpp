@@ -54,6 +54,25 @@ MaxFctEvalOp::MaxFctEvalOp() :
 }
 
 
+/*!
+ *  \brief Compute the function maximized at a point.
+ *  \param inX Point of five coordinates, decoded from a bit string.
+ *  \return Value of the function at the point.
+ */
+double MaxFctEvalOp::computeObjective(const Beagle::DoubleArray& inX) const
+{
+	Beagle_AssertM(inX.size() == 5);
+	double lU   = 10.0;
+	double lSum = 0.0;
+	for(unsigned int i=0; i<5; i++) {
+		lSum += ((inX[i])*(inX[i])) + (lU*lU);
+		lU += inX[i];
+	}
+	lSum += (lU*lU);
+	return 161.8 / lSum;
+}
+
+
 /*!
  *  \brief Evaluate the fitness of the given individual.
  *  \param inIndividual Current individual to evaluate.
@@ -66,13 +85,30 @@ Fitness::Handle MaxFctEvalOp::evaluate(Individual& inIndividual, Context& ioCont
 	GA::BitString::Handle lBitString = castHandleT<GA::BitString>(inIndividual[0]);
 	Beagle::DoubleArray lX;
 	lBitString->decodeGray(mDecodingKeys, lX);
-	double lU   = 10.0;
-	double lSum = 0.0;
-	for(unsigned int i=0; i<5; i++) {
-		lSum += ((lX[i])*(lX[i])) + (lU*lU);
-		lU += lX[i];
+	return new FitnessSimple(computeObjective(lX));
+}
+
+
+/*!
+ *  \brief Evaluate the fitness of a batch of individuals at once.
+ *  \param ioIndividuals Individuals to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return True, as the individuals are always evaluated.
+ *
+ *  The decoded values are kept in one buffer for the whole batch, and the fitness objects of
+ *  the individuals are updated in place.
+ */
+bool MaxFctEvalOp::evaluateBatch(Individual::Bag& ioIndividuals, Context& ioContext)
+{
+	Beagle::DoubleArray lX;
+	for(unsigned int i=0; i<ioIndividuals.size(); ++i) {
+		Beagle_AssertM(ioIndividuals[i]->size() == 1);
+		GA::BitString::Handle lBitString = castHandleT<GA::BitString>((*ioIndividuals[i])[0]);
+		lBitString->decodeGray(mDecodingKeys, lX);
+		const double lF = computeObjective(lX);
+		FitnessSimple::Handle lFitness = castHandleT<FitnessSimple>(ioIndividuals[i]->getFitness());
+		if(lFitness == NULL) ioIndividuals[i]->setFitness(new FitnessSimple(lF));
+		else lFitness->setValue(lF);
 	}
-	lSum += (lU*lU);
-	double lF = 161.8 / lSum;
-	return new FitnessSimple(lF);
+	return true;
 }
@@ -86,9 +86,13 @@ public:
 
 	virtual Beagle::Fitness::Handle evaluate(Beagle::Individual& inIndividual,
 	        Beagle::Context& ioContext);
+	virtual bool evaluateBatch(Beagle::Individual::Bag& ioIndividuals,
+	                           Beagle::Context& ioContext);
 
 protected:
 
+	double computeObjective(const Beagle::DoubleArray& inX) const;
+
 	Beagle::GA::BitString::DecodingKeyVector mDecodingKeys;   //!< Decoding keys.
 
 };
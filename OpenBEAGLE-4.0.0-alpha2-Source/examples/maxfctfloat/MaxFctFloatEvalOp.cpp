@@ -51,26 +51,58 @@ MaxFctFloatEvalOp::MaxFctFloatEvalOp() :
 
 
 /*!
- *  \brief Evaluate the fitness of the given individual.
- *  \param inIndividual Current individual to evaluate.
- *  \param ioContext Evolutionary context.
- *  \return Handle to the fitness value of the individual.
+ *  \brief Compute the function maximized at a point.
+ *  \param inX Point of five coordinates, each limited to [-200,200].
+ *  \return Value of the function at the point.
  */
-Fitness::Handle MaxFctFloatEvalOp::evaluate(Individual& inIndividual, Context& ioContext)
+double MaxFctFloatEvalOp::computeObjective(const GA::FloatVector& inX) const
 {
-	Beagle_AssertM(inIndividual.size() == 1);
-	GA::FloatVector::Handle lFloatVector = castHandleT<GA::FloatVector>(inIndividual[0]);
-	Beagle_AssertM(lFloatVector->size() == 5);
+	Beagle_AssertM(inX.size() == 5);
 	double lU   = 10.0;
 	double lSum = 0.0;
 	for(unsigned int i=0; i<5; ++i) {
-		double lXi = (*lFloatVector)[i];
+		double lXi = inX[i];
 		if(lXi > 200.0)  lXi = 200.0;
 		if(lXi < -200.0) lXi = -200.0;
 		lSum += (lXi*lXi) + (lU*lU);
 		lU += lXi;
 	}
 	lSum += (lU*lU);
-	double lF = 161.8 / lSum;
-	return new FitnessSimple(lF);
+	return 161.8 / lSum;
+}
+
+
+/*!
+ *  \brief Evaluate the fitness of the given individual.
+ *  \param inIndividual Current individual to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return Handle to the fitness value of the individual.
+ */
+Fitness::Handle MaxFctFloatEvalOp::evaluate(Individual& inIndividual, Context& ioContext)
+{
+	Beagle_AssertM(inIndividual.size() == 1);
+	GA::FloatVector::Handle lFloatVector = castHandleT<GA::FloatVector>(inIndividual[0]);
+	return new FitnessSimple(computeObjective(*lFloatVector));
+}
+
+
+/*!
+ *  \brief Evaluate the fitness of a batch of individuals at once.
+ *  \param ioIndividuals Individuals to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return True, as the individuals are always evaluated.
+ *
+ *  The fitness objects of the individuals are updated in place.
+ */
+bool MaxFctFloatEvalOp::evaluateBatch(Individual::Bag& ioIndividuals, Context& ioContext)
+{
+	for(unsigned int i=0; i<ioIndividuals.size(); ++i) {
+		Beagle_AssertM(ioIndividuals[i]->size() == 1);
+		const GA::FloatVector& lFloatVector = castObjectT<const GA::FloatVector&>(*(*ioIndividuals[i])[0]);
+		const double lF = computeObjective(lFloatVector);
+		FitnessSimple::Handle lFitness = castHandleT<FitnessSimple>(ioIndividuals[i]->getFitness());
+		if(lFitness == NULL) ioIndividuals[i]->setFitness(new FitnessSimple(lF));
+		else lFitness->setValue(lF);
+	}
+	return true;
 }
@@ -87,6 +87,12 @@ public:
 
 	virtual Beagle::Fitness::Handle evaluate(Beagle::Individual& inIndividual,
 	        Beagle::Context& ioContext);
+	virtual bool evaluateBatch(Beagle::Individual::Bag& ioIndividuals,
+	                           Beagle::Context& ioContext);
+
+protected:
+
+	double computeObjective(const Beagle::GA::FloatVector& inX) const;
 
 };
 
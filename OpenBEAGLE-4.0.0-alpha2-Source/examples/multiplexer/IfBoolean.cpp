@@ -52,11 +52,28 @@ IfBoolean::IfBoolean() :
 
 /*!
  *  \brief Depending the first argument value, return the 2nd (true) or the 3rd (false).
+ *    In bit-parallel mode, the choice is made for each fitness case of the packed words.
  *  \param outDatum Result of the comparison.
  *  \param ioContext Evolutionary context.
  */
 void IfBoolean::execute(GP::Datum& outDatum, GP::Context& ioContext)
 {
+	if(ioContext.isBitParallel()) {
+		// Blend the two branches bitwise, each fitness case according to its condition bit
+		GP::PackedBool lCondition;
+		get1stArgument(lCondition, ioContext);
+		const uint64_t lMask = lCondition.getWrappedValue();
+		GP::PackedBool& lResult = castObjectT<GP::PackedBool&>(outDatum);
+		if(lMask == ~uint64_t(0)) get2ndArgument(lResult, ioContext);
+		else if(lMask == 0) get3rdArgument(lResult, ioContext);
+		else {
+			GP::PackedBool lArg3;
+			get2ndArgument(lResult, ioContext);
+			get3rdArgument(lArg3, ioContext);
+			lResult.getWrappedValue() = (lMask & lResult.getWrappedValue()) | (~lMask & lArg3.getWrappedValue());
+		}
+		return;
+	}
 	Bool lCondition;
 	get1stArgument(lCondition, ioContext);
 	if(lCondition == true) get2ndArgument(outDatum, ioContext);
@@ -40,19 +40,43 @@
 using namespace Beagle;
 using namespace std;
 
+namespace
+{
+
+//! Names of the input primitives, the three address bits then the eight data bits.
+const char* gInputNames[11] = { "A0", "A1", "A2", "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7" };
+
+/*!
+ *  \brief Count the number of bits set in a word.
+ */
+inline unsigned int countBits(uint64_t inWord)
+{
+	inWord = inWord - ((inWord >> 1) & 0x5555555555555555ULL);
+	inWord = (inWord & 0x3333333333333333ULL) + ((inWord >> 2) & 0x3333333333333333ULL);
+	inWord = (inWord + (inWord >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (unsigned int)((inWord * 0x0101010101010101ULL) >> 56);
+}
+
+}
+
+
 /*!
  *  \brief Construct a new Boolean 11-multiplexer evaluation operator.
  */
 MultiplexerEvalOp::MultiplexerEvalOp() :
 		GP::EvaluationOp("MultiplexerEvalOp"),
-		mInputs(2048),
-		mOutputs(2048)
+		mInputs(32),
+		mOutputs(32)
 { }
 
 
 /*!
  * \brief Initialize the Boolean 11-multiplexer evaluation operator by creating the test tables.
  * \param ioSystem System to use to initialize the operator.
+ *
+ * The 2048 test cases are packed into 32 words of 64 cases, the ith test case being
+ * the (i%64)th bit of the (i/64)th word. The input tokens of the primitive sets are looked
+ * up once, to be set directly at each evaluation.
  */
 void MultiplexerEvalOp::init(System& ioSystem)
 {
@@ -62,24 +86,46 @@ void MultiplexerEvalOp::init(System& ioSystem)
 	    "Configuring the Boolean 11-multiplexer problem"
 	);
 	GP::EvaluationOp::init(ioSystem);
-	mInputs.resize(2048);
-	mOutputs.resize(2048);
-	for(unsigned int i=0; i<2048; ++i) {
+	mInputTokens.resize(11);
+	for(unsigned int j=0; j<11; ++j) {
+		GP::Primitive::Bag lPrimitives;
+		getPrimitivesByName(gInputNames[j], lPrimitives, ioSystem);
+		if(lPrimitives.empty()) {
+			throw Beagle_RunTimeExceptionM(std::string("No primitive named '")+gInputNames[j]+
+			                               std::string("' found in the primitive sets!"));
+		}
+		mInputTokens[j].clear();
+		for(unsigned int k=0; k<lPrimitives.size(); ++k) {
+			mInputTokens[j].push_back(castHandleT<GP::TokenBool>(lPrimitives[k]));
+		}
+	}
+	mInputs.resize(32);
+	mOutputs.resize(32);
+	for(unsigned int i=0; i<32; ++i) {
 		mInputs[i].resize(11);
+		for(unsigned int j=0; j<11; ++j) mInputs[i][j] = 0;
+		mOutputs[i] = 0;
+	}
+	for(unsigned int i=0; i<2048; ++i) {
+		bool lInputs[11];
 		unsigned int lValue = i;
 		unsigned int lDividor = 2048;
 		for(unsigned int j=0; j<11; ++j) {
 			lDividor /= 2;
 			if(lValue >= lDividor) {
-				mInputs[i][j] = true;
+				lInputs[j] = true;
 				lValue -= lDividor;
-			} else mInputs[i][j] = false;
+			} else lInputs[j] = false;
 		}
 		unsigned int lIndexOutput = 3;
-		if(mInputs[i][0]) lIndexOutput += 1;
-		if(mInputs[i][1]) lIndexOutput += 2;
-		if(mInputs[i][2]) lIndexOutput += 4;
-		mOutputs[i] = mInputs[i][lIndexOutput];
+		if(lInputs[0]) lIndexOutput += 1;
+		if(lInputs[1]) lIndexOutput += 2;
+		if(lInputs[2]) lIndexOutput += 4;
+		const uint64_t lBit = uint64_t(1) << (i % 64);
+		for(unsigned int j=0; j<11; ++j) {
+			if(lInputs[j]) mInputs[i/64][j].getWrappedValue() |= lBit;
+		}
+		if(lInputs[lIndexOutput]) mOutputs[i/64].getWrappedValue() |= lBit;
 	}
 }
 
@@ -89,27 +135,24 @@ void MultiplexerEvalOp::init(System& ioSystem)
  *  \param inIndividual Individual to evaluate.
  *  \param ioContext Evolutionary context.
  *  \return Handle to the fitness measure,
+ *
+ *  The individual is run in bit-parallel mode, each run evaluating 64 test cases.
  */
 Fitness::Handle MultiplexerEvalOp::evaluate(GP::Individual& inIndividual, GP::Context& ioContext)
 {
 	unsigned int lNbGood = 0;
-	for(unsigned int i=0; i<2048; ++i) {
-		setValue("A0", mInputs[i][0], ioContext);
-		setValue("A1", mInputs[i][1], ioContext);
-		setValue("A2", mInputs[i][2], ioContext);
-		setValue("D0", mInputs[i][3], ioContext);
-		setValue("D1", mInputs[i][4], ioContext);
-		setValue("D2", mInputs[i][5], ioContext);
-		setValue("D3", mInputs[i][6], ioContext);
-		setValue("D4", mInputs[i][7], ioContext);
-		setValue("D5", mInputs[i][8], ioContext);
-		setValue("D6", mInputs[i][9], ioContext);
-		setValue("D7", mInputs[i][10], ioContext);
-		Bool lResult;
+	ioContext.setBitParallel(true);
+	for(unsigned int i=0; i<32; ++i) {
+		for(unsigned int j=0; j<11; ++j) {
+			for(unsigned int k=0; k<mInputTokens[j].size(); ++k) {
+				mInputTokens[j][k]->setPackedToken(mInputs[i][j]);
+			}
+		}
+		GP::PackedBool lResult;
 		inIndividual.run(lResult, ioContext);
-		if(lResult.getWrappedValue() == mOutputs[i].getWrappedValue()) ++lNbGood;
+		lNbGood += countBits(~(lResult.getWrappedValue() ^ mOutputs[i].getWrappedValue()));
 	}
+	ioContext.setBitParallel(false);
 	double lFitness = double(lNbGood) / 2048.;
 	return new FitnessSimple(lFitness);
 }
-
@@ -103,8 +103,9 @@ public:
 
 protected:
 
-	std::vector< std::vector<Beagle::Bool> > mInputs;
-	std::vector<Beagle::Bool>                mOutputs;
+	std::vector< std::vector<Beagle::GP::PackedBool> > mInputs;   //!< Packed inputs, 11 per word of cases.
+	std::vector<Beagle::GP::PackedBool>                mOutputs;  //!< Packed expected outputs.
+	std::vector< std::vector<Beagle::GP::TokenBool::Handle> > mInputTokens;  //!< Tokens of each input in the primitive sets.
 
 };
 
@@ -64,17 +64,17 @@ int main(int argc, char *argv[])
 		lSet->insert(new GP::Or);
 		lSet->insert(new GP::Not);
 		lSet->insert(new IfBoolean);
-		lSet->insert(new GP::TokenT<Bool>("A0"));
-		lSet->insert(new GP::TokenT<Bool>("A1"));
-		lSet->insert(new GP::TokenT<Bool>("A2"));
-		lSet->insert(new GP::TokenT<Bool>("D0"));
-		lSet->insert(new GP::TokenT<Bool>("D1"));
-		lSet->insert(new GP::TokenT<Bool>("D2"));
-		lSet->insert(new GP::TokenT<Bool>("D3"));
-		lSet->insert(new GP::TokenT<Bool>("D4"));
-		lSet->insert(new GP::TokenT<Bool>("D5"));
-		lSet->insert(new GP::TokenT<Bool>("D6"));
-		lSet->insert(new GP::TokenT<Bool>("D7"));
+		lSet->insert(new GP::TokenBool("A0"));
+		lSet->insert(new GP::TokenBool("A1"));
+		lSet->insert(new GP::TokenBool("A2"));
+		lSet->insert(new GP::TokenBool("D0"));
+		lSet->insert(new GP::TokenBool("D1"));
+		lSet->insert(new GP::TokenBool("D2"));
+		lSet->insert(new GP::TokenBool("D3"));
+		lSet->insert(new GP::TokenBool("D4"));
+		lSet->insert(new GP::TokenBool("D5"));
+		lSet->insert(new GP::TokenBool("D6"));
+		lSet->insert(new GP::TokenBool("D7"));
 		
 		// Build system
 		System::Handle lSystem = new System;
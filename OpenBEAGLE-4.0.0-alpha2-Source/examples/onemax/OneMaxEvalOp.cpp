@@ -60,9 +60,6 @@ Fitness::Handle OneMaxEvalOp::evaluate(Individual& inIndividual, Context& ioCont
 {
 	Beagle_AssertM(inIndividual.size() == 1);
 	GA::BitString::Handle lBitString = castHandleT<GA::BitString>(inIndividual[0]);
-	unsigned int lCount = 0;
-	for(unsigned int i=0; i<lBitString->size(); ++i) {
-		if((*lBitString)[i] == true) ++lCount;
-	}
+	unsigned int lCount = lBitString->count();
 	return new FitnessSimple(float(lCount));
 }
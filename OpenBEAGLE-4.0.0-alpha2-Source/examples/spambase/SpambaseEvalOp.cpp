@@ -39,7 +39,6 @@
 
 #include <cmath>
 #include <fstream>
-#include <algorithm>
 
 using namespace Beagle;
 
@@ -52,6 +51,39 @@ SpambaseEvalOp::SpambaseEvalOp() :
 { }
 
 
+/*!
+ *  \brief Breed an individual, evaluating again the breeding pool on a new sample.
+ *  \param inBreedingPool Pool of individuals to breed from.
+ *  \param inChild Node of the breeder tree giving the individual to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return Bred individual.
+ *
+ *  The individuals of the pool are evaluated again on the first breeding after the sample
+ *  changes, before any selection compares their errors.
+ */
+Individual::Handle SpambaseEvalOp::breed(Individual::Bag& inBreedingPool,
+        BreederNode::Handle inChild,
+        Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(isSampleChanged(ioContext)) {
+		Individual::Handle lOldIndividualHandle = ioContext.getIndividualHandle();
+		unsigned int lOldIndividualIndex = ioContext.getIndividualIndex();
+		for(unsigned int i=0; i<inBreedingPool.size(); ++i) {
+			if((inBreedingPool[i]->getFitness() == NULL) || (inBreedingPool[i]->getFitness()->isValid() == false)) continue;
+			ioContext.setIndividualIndex(i);
+			ioContext.setIndividualHandle(inBreedingPool[i]);
+			inBreedingPool[i]->setFitness(GP::EvaluationOp::evaluate(*inBreedingPool[i], ioContext));
+			inBreedingPool[i]->getFitness()->setValid();
+		}
+		ioContext.setIndividualIndex(lOldIndividualIndex);
+		ioContext.setIndividualHandle(lOldIndividualHandle);
+	}
+	return GP::EvaluationOp::breed(inBreedingPool, inChild, ioContext);
+	Beagle_StackTraceEndM("Individual::Handle SpambaseEvalOp::breed(Individual::Bag&,BreederNode::Handle,Context&)");
+}
+
+
 /*!
  *  \brief Evaluate the individual fitness for the spambase problem.
  *  \param inIndividual Individual to evaluate.
@@ -63,22 +95,14 @@ Fitness::Handle SpambaseEvalOp::evaluate(GP::Individual& inIndividual, GP::Conte
 	// Get reference to data set
 	DataSetClassification::Handle lDataSet =
 	    castHandleT<DataSetClassification>(ioContext.getSystem().getComponent("DataSet"));
-	if(lDataSet == NULL) {
-		throw Beagle_RunTimeExceptionM("Data set is not present in the system, could not proceed further!");
-	}
 
-	// Generate indices used as data subset for fitness evaluation
-	std::vector<unsigned int> lSubSet(lDataSet->size());
-	for(unsigned int i=0; i<lSubSet.size(); ++i) lSubSet[i] = i;
-	std::random_shuffle(lSubSet.begin(), lSubSet.end(),
-	                    ioContext.getSystem().getRandomizer());
-	if(Spambase_TestSize < lSubSet.size()) {
-		lSubSet.resize(Spambase_TestSize);
-	}
+	// Get the data subset used for fitness evaluation, shared by the whole generation
+	const std::vector<unsigned int>& lSubSet = getSample(ioContext);
 
 	// Evaluate sampled test cases
 	unsigned int lCorrectCount = 0;
-	for(unsigned int i=0; i<Spambase_TestSize; ++i) {
+	std::vector<double> lErrors(lSubSet.size(), 1.0);
+	for(unsigned int i=0; i<lSubSet.size(); ++i) {
 		const bool lPositiveID = ((*lDataSet)[lSubSet[i]].first == 1);
 		const Beagle::Vector& lData = (*lDataSet)[lSubSet[i]].second;
 		for(unsigned int j=0; j<lData.size(); ++j) {
@@ -88,10 +112,80 @@ Fitness::Handle SpambaseEvalOp::evaluate(GP::Individual& inIndividual, GP::Conte
 		}
 		Bool lResult;
 		inIndividual.run(lResult, ioContext);
-		if(lResult.getWrappedValue() == lPositiveID) ++lCorrectCount;
+		if(lResult.getWrappedValue() == lPositiveID) {
+			++lCorrectCount;
+			lErrors[i] = 0.0;
+		}
 	}
-	double lFitness = double(lCorrectCount) / Spambase_TestSize;
-	return new FitnessSimple(lFitness);
+	double lFitness = double(lCorrectCount) / lSubSet.size();
+	return new FitnessCaseErrors(lFitness, lErrors);
 }
 
 
+/*!
+ *  \brief Get the sample of the data set used for the evaluations.
+ *  \param ioContext Evolutionary context.
+ *  \return Indices of the e-mails of the sample.
+ */
+const std::vector<unsigned int>& SpambaseEvalOp::getSample(Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	DataSetClassification::Handle lDataSet =
+	    castHandleT<DataSetClassification>(ioContext.getSystem().getComponent("DataSet"));
+	if(lDataSet == NULL) {
+		throw Beagle_RunTimeExceptionM("Data set is not present in the system, could not proceed further!");
+	}
+	DataSetSampler::Handle lSampler =
+	    castHandleT<DataSetSampler>(ioContext.getSystem().getComponent("DataSetSampler"));
+	if(lSampler == NULL) {
+		throw Beagle_RunTimeExceptionM("Data set sampler is not present in the system, could not proceed further!");
+	}
+	return lSampler->getSample(*lDataSet, ioContext);
+	Beagle_StackTraceEndM("const std::vector<unsigned int>& SpambaseEvalOp::getSample(Context&) const");
+}
+
+
+/*!
+ *  \brief Test whether the sample changed since the last evaluation of the actual deme.
+ *  \param ioContext Evolutionary context.
+ *  \return True if the sample changed, in which case its version is recorded for the deme.
+ *
+ *  When the sample changed, the fitness cache is cleared, as the fitnesses it holds were
+ *  measured on the previous sample.
+ */
+bool SpambaseEvalOp::isSampleChanged(Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	// Draw the sample first if it is outdated, so that its version is up to date.
+	getSample(ioContext);
+	DataSetSampler::Handle lSampler =
+	    castHandleT<DataSetSampler>(ioContext.getSystem().getComponent("DataSetSampler"));
+	const unsigned int lDemeIndex = ioContext.getDemeIndex();
+	const unsigned int lVersion = lSampler->getSampleVersion(lDemeIndex);
+	if(mSampleVersions.size() <= lDemeIndex) mSampleVersions.resize(lDemeIndex+1, 0);
+	if(mSampleVersions[lDemeIndex] == lVersion) return false;
+	mSampleVersions[lDemeIndex] = lVersion;
+	FitnessCache::Handle lCache = castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
+	if(lCache != NULL) lCache->clear();
+	return true;
+	Beagle_StackTraceEndM("bool SpambaseEvalOp::isSampleChanged(Context&)");
+}
+
+
+/*!
+ *  \brief Evaluate the invalid individuals of a deme, invalidating first all of them when
+ *    the sample changed.
+ *  \param ioDeme Deme to evaluate.
+ *  \param ioContext Evolutionary context.
+ */
+void SpambaseEvalOp::operate(Deme& ioDeme, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(isSampleChanged(ioContext)) {
+		for(unsigned int i=0; i<ioDeme.size(); ++i) {
+			if(ioDeme[i]->getFitness() != NULL) ioDeme[i]->getFitness()->setInvalid();
+		}
+	}
+	GP::EvaluationOp::operate(ioDeme, ioContext);
+	Beagle_StackTraceEndM("void SpambaseEvalOp::operate(Deme&,Context&)");
+}
@@ -69,8 +69,12 @@
  *  - if-then-else      [1st Input: Bool, 2nd & 3rd Input: Double, Output: Double]
  *
  *  \par Fitness cases
- *  A random sample of 400 e-mails from the database, re-chosen for
- *  each fitness evaluation.
+ *  A random sample of 400 e-mails from the database, re-chosen at
+ *  each generation and shared by all the fitness evaluations. When the
+ *  sample changes, the individuals evaluated on the previous sample are
+ *  evaluated again, so that the errors on each case compared by lexicase
+ *  selection are those of the same e-mail for all the individuals, and the
+ *  fitness cache is cleared.
  *
  *  \par Fitness
  *  Classification rate over the 400 e-mails sampled.
@@ -113,8 +117,19 @@ public:
 
 	SpambaseEvalOp();
 
+	virtual Beagle::Individual::Handle breed(Beagle::Individual::Bag& inBreedingPool,
+	        Beagle::BreederNode::Handle inChild,
+	        Beagle::Context& ioContext);
 	virtual Beagle::Fitness::Handle evaluate(Beagle::GP::Individual& inIndividual,
 	        Beagle::GP::Context& ioContext);
+	virtual void operate(Beagle::Deme& ioDeme, Beagle::Context& ioContext);
+
+protected:
+
+	const std::vector<unsigned int>& getSample(Beagle::Context& ioContext) const;
+	bool isSampleChanged(Beagle::Context& ioContext);
+
+	std::vector<unsigned int> mSampleVersions;  //!< Sample version on which each deme was last evaluated.
 
 };
 
@@ -153,6 +153,9 @@ int main(int argc, char *argv[])
 		lIFS.close();
 		lSystem->addComponent(lDataSet);
 
+		// Add data set sampler, drawing the evaluation cases once per generation
+		lSystem->addComponent(new DataSetSampler(Spambase_TestSize));
+
 		// Set fitness evaluation operator
 		lSystem->setEvaluationOp("SpambaseEvalOp", new SpambaseEvalOp::Alloc);
 
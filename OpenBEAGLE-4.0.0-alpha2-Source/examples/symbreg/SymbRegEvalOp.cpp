@@ -55,24 +55,36 @@ SymbRegEvalOp::SymbRegEvalOp() :
  *  \param inIndividual Individual to evaluate.
  *  \param ioContext Evolutionary context.
  *  \return Handle to the fitness measure,
+ *
+ *  The absolute error on each data point is kept with the fitness, for case-based
+ *  selection operators such as SelectLexicaseOp.
  */
 Fitness::Handle SymbRegEvalOp::evaluate(GP::Individual& inIndividual, GP::Context& ioContext)
 {
+	// The data set is fixed, the sub-tree outputs are cached with a constant case set ID
+	GP::SubTreeMemo lMemo;
+	if(mSubTreeCache != NULL) mSubTreeCache->prepare(inIndividual, 0, mDataSet->size(), lMemo, ioContext);
+
 	double lSquareError = 0.;
+	std::vector<double> lErrors(mDataSet->size());
+	Double lResult;
 	for(unsigned int i=0; i<mDataSet->size(); i++) {
 		Beagle_AssertM((*mDataSet)[i].second.size() == 1);
-		const Double lX((*mDataSet)[i].second[0]);
-		setValue("X", lX, ioContext);
-		const Double lY((*mDataSet)[i].first);
-		Double lResult;
+		lMemo.setCaseIndex(i);
+		// Set the value of the X tokens directly, without copying a Double object
+		for(unsigned int j=0; j<mTokensX.size(); ++j) {
+			mTokensX[j]->getToken().getWrappedValue() = (*mDataSet)[i].second[0];
+		}
 		inIndividual.run(lResult, ioContext);
-		const double lError = lY-lResult;
+		const double lError = (*mDataSet)[i].first - lResult.getWrappedValue();
 		lSquareError += (lError*lError);
+		lErrors[i] = std::fabs(lError);
 	}
+	if(mSubTreeCache != NULL) mSubTreeCache->commit(lMemo);
 	const double lMSE  = lSquareError / mDataSet->size();
 	const double lRMSE = sqrt(lMSE);
 	const double lFitness = 1. / (1. + lRMSE);
-	return new FitnessSimple(lFitness);
+	return new FitnessCaseErrors(lFitness, lErrors);
 }
 
 
@@ -90,6 +102,20 @@ void SymbRegEvalOp::init(System& ioSystem)
 		throw Beagle_RunTimeExceptionM("'DataSetRegression' component not found in System, impossible to proceed further!");
 	}
 
+	// Get the X tokens of the primitive sets
+	GP::Primitive::Bag lPrimitivesX;
+	getPrimitivesByName("X", lPrimitivesX, ioSystem);
+	if(lPrimitivesX.empty()) {
+		throw Beagle_RunTimeExceptionM("No primitive named 'X' found in the primitive sets!");
+	}
+	mTokensX.clear();
+	for(unsigned int i=0; i<lPrimitivesX.size(); ++i) {
+		mTokensX.push_back(castHandleT< GP::TokenT<Double> >(lPrimitivesX[i]));
+	}
+
+	// Get sub-tree cache component, if installed
+	mSubTreeCache = castHandleT<GP::SubTreeCache>(ioSystem.haveComponent("GP-SubTreeCache"));
+
 	// If data set is empty, initialize it with random samples of quartic polynomial
 	if(mDataSet->size() == 0) {
 		mDataSet->resize(20);
@@ -109,7 +109,9 @@ public:
 
 protected:
 
-	Beagle::DataSetRegression::Handle mDataSet;  //!< Set of sampled data.
+	Beagle::DataSetRegression::Handle mDataSet;       //!< Set of sampled data.
+	Beagle::GP::SubTreeCache::Handle  mSubTreeCache;  //!< Sub-tree cache, NULL if not installed.
+	std::vector< Beagle::GP::TokenT<Beagle::Double>::Handle > mTokensX;  //!< X tokens of the primitive sets.
 
 };
 
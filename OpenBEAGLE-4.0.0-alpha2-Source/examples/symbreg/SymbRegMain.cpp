@@ -83,6 +83,9 @@ int main(int argc, char *argv[])
 		// Add data set for regression component
 		lSystem->addComponent(new DataSetRegression);
 
+		// Add sub-tree cache component, enabled by parameter gp.subtree.cachesize
+		lSystem->addComponent(new GP::SubTreeCache);
+
 		// Add evaluation operator allocator
 		lSystem->setEvaluationOp("SymbRegEvalOp", new SymbRegEvalOp::Alloc);
 
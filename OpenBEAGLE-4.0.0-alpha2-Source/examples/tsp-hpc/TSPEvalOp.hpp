@@ -55,7 +55,7 @@
 
 #include "beagle/GA.hpp"
 #include "beagle/HPC.hpp"
-#include "TSPDistanceMap.hpp"
+#include "../tsp/TSPDistanceMap.hpp"
 #include "beagle/HPC.hpp"
 
 /*!
@@ -38,6 +38,8 @@
 #include "TSPDistanceMap.hpp"
 
 #include <cmath>
+#include <fstream>
+#include <sstream>
 
 using namespace Beagle;
 
@@ -48,7 +50,8 @@ using namespace Beagle;
  */
 TSPDistanceMap::TSPDistanceMap(unsigned int inNumberOfTowns) :
 		Component("TSPDistanceMap"),
-		mNumberOfTowns(new UInt(inNumberOfTowns))
+		mNumberOfTowns(new UInt(inNumberOfTowns)),
+		mFileName(new String(""))
 { }
 
 
@@ -61,11 +64,16 @@ void TSPDistanceMap::init(System& ioSystem)
 	Beagle_StackTraceBeginM();
 
 	// The distance map is already initialized, don't touch it.
-	if((mDistancesMatrix.getRows()!=0) && (mDistancesMatrix.getCols()!=0)) return;
+	if(mDistances.empty() == false) return;
+
+	// Read the map from the TSPLIB file given by parameter 'tsp.map.file', if any.
+	if(mFileName->getWrappedValue().empty() == false) {
+		readTSPLIB(mFileName->getWrappedValue());
+		return;
+	}
 
 	// Resize the distance map to the size given by parameter 'tsp.map.size'.
-	mDistancesMatrix.resize(mNumberOfTowns->getWrappedValue(),
-	        mNumberOfTowns->getWrappedValue());
+	resize(mNumberOfTowns->getWrappedValue());
 
 	// Generating randomly the TSP graph to solve.
 	std::vector< std::pair<double,double> > lNodePosition(mNumberOfTowns->getWrappedValue());
@@ -83,15 +91,10 @@ void TSPDistanceMap::init(System& ioSystem)
 				                (lNodePosition[j].second-lNodePosition[i].second));
 			lDistance = std::sqrt(lDistance);
 			lDistance += ioSystem.getRandomizer().rollGaussian(0.0, 0.5);       // Add some noise
-			mDistancesMatrix(i,j) = mDistancesMatrix(j,i) = lDistance;
+			setDistance(i, j, lDistance);
 		}
 	}
 
-	// Set distance to self to 0.
-	for(unsigned int i=0; i<mNumberOfTowns->getWrappedValue(); ++i) {
-		mDistancesMatrix(i,i) = 0.;
-	}
-
 	Beagle_StackTraceEndM("void TSPDistanceMap::init(System&)");
 }
 
@@ -100,19 +103,180 @@ void TSPDistanceMap::init(System& ioSystem)
  *  \brief Read distance map.
  *  \param inIter XML iterator to use to read the distance map.
  *  \param ioSystem Evolutionary system.
+ *
+ *  Maps written as a full matrix in a <TSPDistanceMatrix> tag by previous versions are
+ *  also accepted.
  */
 void TSPDistanceMap::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem)
 {
 	Beagle_StackTraceBeginM();
 	if((inIter->getType() != PACC::XML::eData) || (inIter->getValue() != "TSPDistanceMap"))
 		throw Beagle_IOExceptionNodeM(*inIter, "invalid node type or tag name!");
-	for(PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; ++lChild)
-		if(lChild->getValue() == "TSPDistanceMatrix")
-			mDistancesMatrix.read(lChild);
+	for(PACC::XML::ConstIterator lChild = inIter->getFirstChild(); lChild; ++lChild) {
+		if(lChild->getType() != PACC::XML::eData) continue;
+		if(lChild->getValue() == "TSPDistances") {
+			const std::string lSizeAttr = lChild->getAttribute("size");
+			if(lSizeAttr.empty())
+				throw Beagle_IOExceptionNodeM(*lChild, "expected attribute 'size' in <TSPDistances>!");
+			resize(str2uint(lSizeAttr));
+			mNumberOfTowns->getWrappedValue() = mRowOffsets.size();
+			PACC::XML::ConstIterator lContent = lChild->getFirstChild();
+			if(mDistances.empty() == false) {
+				if(!lContent || (lContent->getType() != PACC::XML::eString))
+					throw Beagle_IOExceptionNodeM(*lChild, "expected distances in <TSPDistances>!");
+				std::istringstream lISS(lContent->getValue());
+				for(std::size_t i=0; i<mDistances.size(); ++i) {
+					if(!(lISS >> mDistances[i]))
+						throw Beagle_IOExceptionNodeM(*lChild, "missing distances in <TSPDistances>!");
+				}
+			}
+		} else if(lChild->getValue() == "TSPDistanceMatrix") {
+			PACC::Matrix lMatrix;
+			lMatrix.read(lChild);
+			if(lMatrix.getRows() != lMatrix.getCols())
+				throw Beagle_IOExceptionNodeM(*lChild, "distance matrix must be square!");
+			resize(lMatrix.getRows());
+			mNumberOfTowns->getWrappedValue() = mRowOffsets.size();
+			for(unsigned int i=0; i<lMatrix.getRows(); ++i) {
+				for(unsigned int j=(i+1); j<lMatrix.getCols(); ++j) setDistance(i, j, lMatrix(i,j));
+			}
+		}
+	}
 	Beagle_StackTraceEndM("void TSPDistanceMap::readWithSystem(PACC::XML::ConstIterator, System&)");
 }
 
 
+/*!
+ *  \brief Read distance map from a file in the TSPLIB format.
+ *  \param inFileName Name of the TSPLIB file to read.
+ *  \throw Beagle::IOException If the file can't be read or the problem is not supported.
+ *
+ *  Symmetric problems (TYPE: TSP) are supported, with EUC_2D, CEIL_2D and ATT node
+ *  coordinates, or explicit weights given as FULL_MATRIX, UPPER_ROW, LOWER_ROW,
+ *  UPPER_DIAG_ROW or LOWER_DIAG_ROW. The number of towns (parameter 'tsp.map.size') is
+ *  set to the dimension of the problem.
+ */
+void TSPDistanceMap::readTSPLIB(const std::string& inFileName)
+{
+	Beagle_StackTraceBeginM();
+	std::ifstream lStream(inFileName.c_str());
+	if(!lStream) {
+		std::ostringstream lOSS;
+		lOSS << "could not open TSPLIB file '" << inFileName << "'!";
+		throw Beagle_IOExceptionMessageM(lOSS.str());
+	}
+
+	// Read specification part, up to the data section.
+	unsigned int lDimension = 0;
+	std::string lEdgeWeightType, lEdgeWeightFormat, lSection;
+	std::string lLine;
+	while(std::getline(lStream, lLine)) {
+		std::string::size_type lColon = lLine.find(':');
+		std::istringstream lKeyISS(lLine.substr(0, lColon));
+		std::string lKey;
+		if(!(lKeyISS >> lKey)) continue;
+		std::string lValue;
+		if(lColon != std::string::npos) {
+			std::istringstream lValueISS(lLine.substr(lColon+1));
+			lValueISS >> lValue;
+		}
+		if(lKey == "TYPE") {
+			if(lValue != "TSP") {
+				std::ostringstream lOSS;
+				lOSS << "unsupported TSPLIB problem type '" << lValue << "' in file '" << inFileName << "'!";
+				throw Beagle_IOExceptionMessageM(lOSS.str());
+			}
+		} else if(lKey == "DIMENSION") lDimension = str2uint(lValue);
+		else if(lKey == "EDGE_WEIGHT_TYPE") lEdgeWeightType = lValue;
+		else if(lKey == "EDGE_WEIGHT_FORMAT") lEdgeWeightFormat = lValue;
+		else if((lKey == "NODE_COORD_SECTION") || (lKey == "EDGE_WEIGHT_SECTION")) {
+			lSection = lKey;
+			break;
+		} else if(lKey == "EOF") break;
+	}
+	if((lDimension == 0) || lSection.empty()) {
+		std::ostringstream lOSS;
+		lOSS << "missing dimension or data section in TSPLIB file '" << inFileName << "'!";
+		throw Beagle_IOExceptionMessageM(lOSS.str());
+	}
+
+	resize(lDimension);
+	mNumberOfTowns->getWrappedValue() = lDimension;
+
+	if(lSection == "NODE_COORD_SECTION") {
+		if((lEdgeWeightType != "EUC_2D") && (lEdgeWeightType != "CEIL_2D") && (lEdgeWeightType != "ATT")) {
+			std::ostringstream lOSS;
+			lOSS << "unsupported TSPLIB edge weight type '" << lEdgeWeightType;
+			lOSS << "' in file '" << inFileName << "'!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		std::vector< std::pair<double,double> > lNodePosition(lDimension);
+		for(unsigned int i=0; i<lDimension; ++i) {
+			unsigned int lNode = 0;
+			double lX = 0.0, lY = 0.0;
+			if(!(lStream >> lNode >> lX >> lY) || (lNode == 0) || (lNode > lDimension)) {
+				std::ostringstream lOSS;
+				lOSS << "invalid node coordinates in TSPLIB file '" << inFileName << "'!";
+				throw Beagle_IOExceptionMessageM(lOSS.str());
+			}
+			lNodePosition[lNode-1] = std::make_pair(lX, lY);
+		}
+		for(unsigned int i=0; i<lDimension; ++i) {
+			for(unsigned int j=(i+1); j<lDimension; ++j) {
+				const double lDX = lNodePosition[i].first  - lNodePosition[j].first;
+				const double lDY = lNodePosition[i].second - lNodePosition[j].second;
+				double lDistance = 0.0;
+				if(lEdgeWeightType == "EUC_2D") {
+					lDistance = std::floor(std::sqrt(lDX*lDX + lDY*lDY) + 0.5);
+				} else if(lEdgeWeightType == "CEIL_2D") {
+					lDistance = std::ceil(std::sqrt(lDX*lDX + lDY*lDY));
+				} else {
+					// Pseudo-Euclidean distance of the att48 and att532 problems.
+					const double lR = std::sqrt((lDX*lDX + lDY*lDY) / 10.0);
+					lDistance = std::floor(lR + 0.5);
+					if(lDistance < lR) lDistance += 1.0;
+				}
+				setDistance(i, j, lDistance);
+			}
+		}
+	} else {
+		if(lEdgeWeightType != "EXPLICIT") {
+			std::ostringstream lOSS;
+			lOSS << "unsupported TSPLIB edge weight type '" << lEdgeWeightType;
+			lOSS << "' in file '" << inFileName << "'!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		// Each format is scanned row by row, for columns [lBegin,lEnd) of the row.
+		const bool lFull      = (lEdgeWeightFormat == "FULL_MATRIX");
+		const bool lUpper     = (lEdgeWeightFormat == "UPPER_ROW") || (lEdgeWeightFormat == "UPPER_DIAG_ROW");
+		const bool lLower     = (lEdgeWeightFormat == "LOWER_ROW") || (lEdgeWeightFormat == "LOWER_DIAG_ROW");
+		const bool lDiagonal  = (lEdgeWeightFormat == "UPPER_DIAG_ROW") || (lEdgeWeightFormat == "LOWER_DIAG_ROW");
+		if(!lFull && !lUpper && !lLower) {
+			std::ostringstream lOSS;
+			lOSS << "unsupported TSPLIB edge weight format '" << lEdgeWeightFormat;
+			lOSS << "' in file '" << inFileName << "'!";
+			throw Beagle_IOExceptionMessageM(lOSS.str());
+		}
+		for(unsigned int i=0; i<lDimension; ++i) {
+			unsigned int lBegin = 0, lEnd = lDimension;
+			if(lUpper) lBegin = lDiagonal ? i : (i+1);
+			else if(lLower) lEnd = lDiagonal ? (i+1) : i;
+			for(unsigned int j=lBegin; j<lEnd; ++j) {
+				double lWeight = 0.0;
+				if(!(lStream >> lWeight)) {
+					std::ostringstream lOSS;
+					lOSS << "missing edge weights in TSPLIB file '" << inFileName << "'!";
+					throw Beagle_IOExceptionMessageM(lOSS.str());
+				}
+				if(i < j) setDistance(i, j, lWeight);
+				else if(lLower && (j < i)) setDistance(j, i, lWeight);
+			}
+		}
+	}
+	Beagle_StackTraceEndM("void TSPDistanceMap::readTSPLIB(const std::string&)");
+}
+
+
 /*!
  *  \brief Register parameters of the distance map component.
  *  \param ioSystem Evolutionary system.
@@ -121,28 +285,80 @@ void TSPDistanceMap::registerParams(System& ioSystem)
 {
 	Beagle_StackTraceBeginM();
 	Component::registerParams(ioSystem);
-	const unsigned int lNumberOfTowns = mNumberOfTowns->getWrappedValue();
-	Register::Description lDescription(
-	    "Number of towns of TSP problem",
-	    "UInt",
-	    uint2str(lNumberOfTowns),
-	    std::string("Integer giving the number of town of the TSP problem, that is the number of ")+
-	    std::string("nodes in the graph in which the optimization is done.")
-	);
-	mNumberOfTowns = castHandleT<UInt>(
-	        ioSystem.getRegister().insertEntry("tsp.map.size", new UInt(lNumberOfTowns), lDescription));
+	{
+		const unsigned int lNumberOfTowns = mNumberOfTowns->getWrappedValue();
+		Register::Description lDescription(
+		    "Number of towns of TSP problem",
+		    "UInt",
+		    uint2str(lNumberOfTowns),
+		    std::string("Integer giving the number of town of the TSP problem, that is the number of ")+
+		    std::string("nodes in the graph in which the optimization is done.")
+		);
+		mNumberOfTowns = castHandleT<UInt>(
+		        ioSystem.getRegister().insertEntry("tsp.map.size", new UInt(lNumberOfTowns), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		    "TSPLIB file of TSP problem",
+		    "String",
+		    "",
+		    std::string("Name of a symmetric TSP problem file in the TSPLIB format to read the map from. ")+
+		    std::string("When empty, a map of 'tsp.map.size' towns is generated randomly. Otherwise, ")+
+		    std::string("the number of towns is given by the dimension of the problem.")
+		);
+		mFileName = castHandleT<String>(
+		        ioSystem.getRegister().insertEntry("tsp.map.file", new String(""), lDescription));
+	}
 	Beagle_StackTraceEndM("void TSPDistanceMap::registerParams(System&)");
 }
 
 
+/*!
+ *  \brief Resize distance map, and compute the offsets of its rows.
+ *  \param inNumberOfTowns Number of towns in the map.
+ *
+ *  Row i holds the distances to towns i+1 to n-1. The offset stored is the start of the
+ *  row in the packed triangle minus i+1, so that it can be indexed directly by the second
+ *  town. The subtraction wraps around for the first row, which is harmless as unsigned
+ *  arithmetic is modular.
+ */
+void TSPDistanceMap::resize(unsigned int inNumberOfTowns)
+{
+	Beagle_StackTraceBeginM();
+	mRowOffsets.resize(inNumberOfTowns);
+	const std::size_t lNumberOfTowns = inNumberOfTowns;
+	std::size_t lRowStart = 0;
+	for(std::size_t i=0; i<lNumberOfTowns; ++i) {
+		mRowOffsets[i] = lRowStart - (i + 1);
+		lRowStart += lNumberOfTowns - i - 1;
+	}
+	mDistances.clear();
+	mDistances.resize(lNumberOfTowns<2 ? 0 : (lNumberOfTowns * (lNumberOfTowns-1)) / 2, 0.0f);
+	Beagle_StackTraceEndM("void TSPDistanceMap::resize(unsigned int)");
+}
+
+
 /*!
  *  \brief Write distance map into XML streamer.
  *  \param ioStreamer XML streamer.
  *  \param inIndent Indent (or not) XML output.
+ *
+ *  The upper triangle of the distance matrix is written row by row.
  */
 void TSPDistanceMap::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const
 {
 	Beagle_StackTraceBeginM();
-	mDistancesMatrix.write(ioStreamer, "TSPDistanceMatrix");
+	ioStreamer.openTag("TSPDistances", inIndent);
+	ioStreamer.insertAttribute("size", uint2str(mRowOffsets.size()));
+	if(mDistances.empty() == false) {
+		std::ostringstream lOSS;
+		lOSS.precision(9);
+		for(std::size_t i=0; i<mDistances.size(); ++i) {
+			if(i != 0) lOSS << ' ';
+			lOSS << mDistances[i];
+		}
+		ioStreamer.insertStringContent(lOSS.str());
+	}
+	ioStreamer.closeTag();
 	Beagle_StackTraceEndM("void TSPDistanceMap::writeContent(PACC::XML::Streamer&, bool) const");
 }
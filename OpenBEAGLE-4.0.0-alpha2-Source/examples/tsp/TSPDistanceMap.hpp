@@ -39,6 +39,9 @@
 #define TSPDistanceMap_hpp
 
 #include "beagle/GA.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 
@@ -46,6 +49,12 @@
  *  \class TSPDistanceMap TSPDistanceMap.hpp "TSPDistanceMap.hpp"
  *  \brief The map containing distances between towns for the TSP problem.
  *  \ingroup TSP
+ *
+ *  Distances are symmetric, so only the strict upper triangle of the distance matrix is
+ *  kept, packed row by row in single precision. This is a quarter of the memory of the
+ *  full matrix in double precision, which keeps large instances in cache longer. The map
+ *  is either generated randomly, or loaded from the TSPLIB file given by parameter
+ *  'tsp.map.file'. This component is shared by the tsp and tsp-hpc examples.
  */
 class TSPDistanceMap : public Beagle::Component
 {
@@ -69,6 +78,8 @@ public:
 	virtual void registerParams(Beagle::System& ioSystem);
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	void readTSPLIB(const std::string& inFileName);
+
 	/*!
 	 *  \brief Get distance between two towns in the map.
 	 *  \param inIndexFirstTown Index of first town in the map.
@@ -78,11 +89,12 @@ public:
 	inline double getDistance(unsigned int inIndexFirstTown, unsigned int inIndexSecondTown) const
 	{
 		Beagle_StackTraceBeginM();
-		Beagle_AssertM(mDistancesMatrix.getCols() != 0);
-		Beagle_AssertM(mDistancesMatrix.getRows() != 0);
-		Beagle_AssertM(inIndexFirstTown < mNumberOfTowns->getWrappedValue());
-		Beagle_AssertM(inIndexSecondTown < mNumberOfTowns->getWrappedValue());
-		return mDistancesMatrix(inIndexFirstTown, inIndexSecondTown);
+		Beagle_AssertM(mDistances.empty() == false);
+		Beagle_AssertM(inIndexFirstTown < mRowOffsets.size());
+		Beagle_AssertM(inIndexSecondTown < mRowOffsets.size());
+		if(inIndexFirstTown == inIndexSecondTown) return 0.0;
+		if(inIndexFirstTown > inIndexSecondTown) std::swap(inIndexFirstTown, inIndexSecondTown);
+		return mDistances[mRowOffsets[inIndexFirstTown] + std::size_t(inIndexSecondTown)];
 		Beagle_StackTraceEndM("double getDistance(unsigned int, unsigned int) const");
 	}
 
@@ -98,8 +110,27 @@ public:
 
 protected:
 
-	PACC::Matrix         mDistancesMatrix;  //!< Distances between nodes of the graph.
-	Beagle::UInt::Handle mNumberOfTowns;    //!< Number of towns of the problem.
+	void resize(unsigned int inNumberOfTowns);
+
+	/*!
+	 *  \brief Set distance between two different towns in the map.
+	 *  \param inIndexFirstTown Index of first town in the map.
+	 *  \param inIndexSecondTown Index of second town in the map, greater than the first one.
+	 *  \param inDistance Distance between the two towns.
+	 */
+	inline void setDistance(unsigned int inIndexFirstTown, unsigned int inIndexSecondTown, double inDistance)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(inIndexFirstTown < inIndexSecondTown);
+		Beagle_AssertM(inIndexSecondTown < mRowOffsets.size());
+		mDistances[mRowOffsets[inIndexFirstTown] + std::size_t(inIndexSecondTown)] = float(inDistance);
+		Beagle_StackTraceEndM("void setDistance(unsigned int, unsigned int, double)");
+	}
+
+	std::vector<float>          mDistances;      //!< Upper triangle of the distance matrix, packed by rows.
+	std::vector<std::size_t>    mRowOffsets;     //!< Distance (i,j), i<j, is at index mRowOffsets[i]+j.
+	Beagle::UInt::Handle        mNumberOfTowns;  //!< Number of towns of the problem.
+	Beagle::String::Handle      mFileName;       //!< Name of the TSPLIB file to read the map from.
 
 };
 
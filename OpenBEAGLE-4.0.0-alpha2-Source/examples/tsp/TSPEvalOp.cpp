@@ -41,6 +41,10 @@
 
 #define BEAGLE_TSP_PROBLEMSIZE 25
 
+// Generations between two full evaluations of the paths, bounding the rounding drift of
+// the incremental updates.
+#define BEAGLE_TSP_FULLEVALPERIOD 10
+
 
 using namespace Beagle;
 
@@ -57,11 +61,29 @@ TSPEvalOp::TSPEvalOp() :
  *  \param inIndividual Current individual to evaluate.
  *  \param ioContext Evolutionary context.
  *  \return Handle to the fitness value of the individual.
+ *
+ *  When the individual has been changed by sequence mutations only since its fitness was
+ *  valid, the trip distance is updated from the links of the path removed and added,
+ *  instead of being summed over the whole path. The path is summed anyway every
+ *  BEAGLE_TSP_FULLEVALPERIOD generations, or when the fitness is still valid.
  */
 Fitness::Handle TSPEvalOp::evaluate(Individual& inIndividual, Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
 	Beagle_AssertM(inIndividual.size() == 1);
+	GA::SequenceDelta::Handle lDelta =
+	    castHandleT<GA::SequenceDelta>(inIndividual.getMember("FitnessDelta"));
+	const bool lFullEval = ((ioContext.getGeneration() % BEAGLE_TSP_FULLEVALPERIOD) == 0);
+	if((lDelta != NULL) && (lFullEval == false) &&
+	        (inIndividual.getFitness() != NULL) && (inIndividual.getFitness()->isValid() == false)) {
+		const FitnessSimpleMin& lFitness = castObjectT<const FitnessSimpleMin&>(*inIndividual.getFitness());
+		double lTripDistance = lFitness.getValue();
+		const std::vector<GA::SequenceDelta::Link>& lRemoved = lDelta->getRemovedLinks();
+		for(unsigned int i=0; i<lRemoved.size(); ++i) lTripDistance -= getLinkDistance(lRemoved[i]);
+		const std::vector<GA::SequenceDelta::Link>& lAdded = lDelta->getAddedLinks();
+		for(unsigned int i=0; i<lAdded.size(); ++i) lTripDistance += getLinkDistance(lAdded[i]);
+		return new FitnessSimpleMin(float(lTripDistance));
+	}
 	GA::IntegerVector::Handle lPath = castHandleT<GA::IntegerVector>(inIndividual[0]);
 	const unsigned int lRootIndex = (mDistanceMap->getNumberOfTowns()-1);
 	double lTripDistance = mDistanceMap->getDistance(lRootIndex,(*lPath)[0]);
@@ -74,6 +96,24 @@ Fitness::Handle TSPEvalOp::evaluate(Individual& inIndividual, Context& ioContext
 }
 
 
+/*!
+ *  \brief Get the distance between the two towns of a link of a path.
+ *  \param inLink Link of the path, the exterior node being the root town.
+ *  \return Distance between the two towns.
+ */
+double TSPEvalOp::getLinkDistance(const GA::SequenceDelta::Link& inLink) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lRootIndex = (mDistanceMap->getNumberOfTowns()-1);
+	const unsigned int lFirst =
+	    (inLink.mFirst == GA::SequenceDelta::eExterior) ? lRootIndex : (unsigned int)inLink.mFirst;
+	const unsigned int lSecond =
+	    (inLink.mSecond == GA::SequenceDelta::eExterior) ? lRootIndex : (unsigned int)inLink.mSecond;
+	return mDistanceMap->getDistance(lFirst, lSecond);
+	Beagle_StackTraceEndM("double TSPEvalOp::getLinkDistance(const GA::SequenceDelta::Link&) const");
+}
+
+
 /*!
  *  \brief Register the parameters of this operator.
  *  \param ioSystem Evolutionary system.
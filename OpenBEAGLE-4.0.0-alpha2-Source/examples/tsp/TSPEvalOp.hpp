@@ -86,6 +86,8 @@ public:
 
 protected:
 
+	double getLinkDistance(const Beagle::GA::SequenceDelta::Link& inLink) const;
+
 	TSPDistanceMap::Handle mDistanceMap;    //!< Distance map for TSP evaluation.
 	Beagle::UInt::Handle   mIntVectorSize;  //!< Individual integer vectors size.
 
@@ -50,6 +50,17 @@ ZeroMinEvalOp::ZeroMinEvalOp() :
 { }
 
 
+/*!
+ *  \brief Compute the number of ones to minimize in a bit string.
+ *  \param inBitString Bit string of an individual.
+ *  \return Number of ones in the bit string.
+ */
+float ZeroMinEvalOp::computeObjective(const GA::BitString& inBitString) const
+{
+	return float(inBitString.count());
+}
+
+
 /*!
  *  \brief Evaluate the fitness of the given individual.
  *  \param inIndividual Current individual to evaluate.
@@ -60,9 +71,27 @@ Fitness::Handle ZeroMinEvalOp::evaluate(Individual& inIndividual, Context& ioCon
 {
 	Beagle_AssertM(inIndividual.size() == 1);
 	GA::BitString::Handle lBitString = castHandleT<GA::BitString>(inIndividual[0]);
-	unsigned int lCount = 0;
-	for(unsigned int i=0; i<lBitString->size(); ++i) {
-		if((*lBitString)[i] == true) ++lCount;
+	return new FitnessSimpleMin(computeObjective(*lBitString));
+}
+
+
+/*!
+ *  \brief Evaluate the fitness of a batch of GA individuals at once.
+ *  \param ioIndividuals Individuals to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return True, as the individuals are always evaluated.
+ *
+ *  The fitness objects of the individuals are updated in place.
+ */
+bool ZeroMinEvalOp::evaluateBatch(Individual::Bag& ioIndividuals, Context& ioContext)
+{
+	for(unsigned int i=0; i<ioIndividuals.size(); ++i) {
+		Beagle_AssertM(ioIndividuals[i]->size() == 1);
+		GA::BitString::Handle lBitString = castHandleT<GA::BitString>((*ioIndividuals[i])[0]);
+		const float lCount = computeObjective(*lBitString);
+		FitnessSimpleMin::Handle lFitness = castHandleT<FitnessSimpleMin>(ioIndividuals[i]->getFitness());
+		if(lFitness == NULL) ioIndividuals[i]->setFitness(new FitnessSimpleMin(lCount));
+		else lFitness->setValue(lCount);
 	}
-	return new FitnessSimpleMin(float(lCount));
+	return true;
 }
@@ -81,6 +81,12 @@ public:
 
 	virtual Beagle::Fitness::Handle evaluate(Beagle::Individual& inIndividual,
 	        Beagle::Context& ioContext);
+	virtual bool evaluateBatch(Beagle::Individual::Bag& ioIndividuals,
+	                           Beagle::Context& ioContext);
+
+protected:
+
+	float computeObjective(const Beagle::GA::BitString& inBitString) const;
 
 };
 
@@ -132,6 +132,7 @@
 #include "beagle/Fitness.hpp"
 #include "beagle/FitnessSimple.hpp"
 #include "beagle/FitnessSimpleMin.hpp"
+#include "beagle/FitnessCaseErrors.hpp"
 #include "beagle/FitnessMultiObj.hpp"
 #include "beagle/FitnessMultiObjMin.hpp"
 #include "beagle/Genotype.hpp"
@@ -157,6 +158,7 @@
 #include "beagle/OperatorMap.hpp"
 #include "beagle/Member.hpp"
 #include "beagle/MemberMap.hpp"
+#include "beagle/FitnessDelta.hpp"
 #include "beagle/Evolver.hpp"
 #include "beagle/Package.hpp"
 #include "beagle/PackageBase.hpp"
@@ -185,9 +187,11 @@
 #include "beagle/TermMaxEvalsOp.hpp"
 #include "beagle/TermMaxFitnessOp.hpp"
 #include "beagle/TermMinFitnessOp.hpp"
+#include "beagle/StatsMeasure.hpp"
 #include "beagle/StatsCalculateOp.hpp"
 #include "beagle/StatsCalcFitnessMultiObjOp.hpp"
 #include "beagle/StatsCalcFitnessSimpleOp.hpp"
+#include "beagle/StatsWriterOp.hpp"
 #include "beagle/MigrationOp.hpp"
 #include "beagle/MigrationMapOp.hpp"
 #include "beagle/MigrationRingOp.hpp"
@@ -199,6 +203,7 @@
 #include "beagle/SelectionOp.hpp"
 #include "beagle/SelectBestOp.hpp"
 #include "beagle/SelectFirstOp.hpp"
+#include "beagle/SelectLexicaseOp.hpp"
 #include "beagle/SelectParsimonyTournOp.hpp"
 #include "beagle/SelectRandomOp.hpp"
 #include "beagle/SelectRouletteOp.hpp"
@@ -218,12 +223,14 @@
 #include "beagle/IndividualSizeFrequencyStatsOp.hpp"
 #include "beagle/DataSetClassification.hpp"
 #include "beagle/DataSetRegression.hpp"
+#include "beagle/DataSetSampler.hpp"
 #include "beagle/History.hpp"
 #include "beagle/HistoryEntry.hpp"
 #include "beagle/HistoryTrace.hpp"
 #include "beagle/HistoryFlushOp.hpp"
 #include "beagle/HistoryID.hpp"
 #include "beagle/HistoryMarkOp.hpp"
+#include "beagle/FitnessCache.hpp"
 
 #if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
 #include "beagle/RandomizerMulti.hpp"
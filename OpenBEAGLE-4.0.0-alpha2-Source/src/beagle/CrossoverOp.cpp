@@ -98,6 +98,8 @@ Individual::Handle CrossoverOp::breed(Individual::Bag& inBreedingPool,
 		if(lMated) {
 			if(lIndiv1->getFitness() != NULL) lIndiv1->getFitness()->setInvalid();
 			if(lIndiv2->getFitness() != NULL) lIndiv2->getFitness()->setInvalid();
+			lIndiv1->removeMember("FitnessDelta");
+			lIndiv2->removeMember("FitnessDelta");
 			History::Handle lHistory = castHandleT<History>(ioContext.getSystem().haveComponent("History"));
 			if(lHistory != NULL) {
 				std::vector<HistoryID> lParents;
@@ -263,6 +265,8 @@ void CrossoverOp::operate(Deme& ioDeme, Context& ioContext)
 			if(ioDeme[lSecondMate]->getFitness() != NULL) {
 				ioDeme[lSecondMate]->getFitness()->setInvalid();
 			}
+			ioDeme[lFirstMate]->removeMember("FitnessDelta");
+			ioDeme[lSecondMate]->removeMember("FitnessDelta");
 			if(lHistory != NULL) {
 				#pragma omp critical (Beagle_History)
 				{
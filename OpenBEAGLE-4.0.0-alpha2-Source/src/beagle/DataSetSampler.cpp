@@ -0,0 +1,328 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/src/DataSetSampler.cpp
+ *  \brief  Source code of class DataSetSampler.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <map>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a data set sampler component.
+ *  \param inSampleSize Default number of cases in the sample, zero for all the cases.
+ */
+DataSetSampler::DataSetSampler(unsigned int inSampleSize) :
+		Component("DataSetSampler"),
+		mDefaultSize(inSampleSize),
+		mNbCases(0),
+		mGeneration(UINT_MAX),
+		mDemeIndex(UINT_MAX),
+		mVersion(0)
+{ }
+
+
+/*!
+ *  \brief Draw a sample uniformly without replacement.
+ *  \param inNbCases Number of cases of the data set.
+ *  \param ioContext Evolutionary context.
+ *
+ *  The sample is taken from a partial Fisher-Yates shuffle of a permutation kept between
+ *  the draws, so that each draw costs time proportional to the sample size only.
+ */
+void DataSetSampler::drawRandom(unsigned int inNbCases, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mPermutation.size() != inNbCases) {
+		mPermutation.resize(inNbCases);
+		for(unsigned int i=0; i<inNbCases; ++i) mPermutation[i] = i;
+	}
+	unsigned int lSampleSize = mSampleSize->getWrappedValue();
+	if((lSampleSize == 0) || (lSampleSize > inNbCases)) lSampleSize = inNbCases;
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	for(unsigned int i=0; i<lSampleSize; ++i) {
+		const unsigned int lChosen = lRandomizer.rollInteger(i, inNbCases-1);
+		std::swap(mPermutation[i], mPermutation[lChosen]);
+	}
+	mSample.assign(mPermutation.begin(), mPermutation.begin()+lSampleSize);
+	Beagle_StackTraceEndM("void DataSetSampler::drawRandom(unsigned int,Context&)");
+}
+
+
+/*!
+ *  \brief Draw a sample keeping the proportion of each class of the data set.
+ *  \param inLabels Class label of each case of the data set.
+ *  \param ioContext Evolutionary context.
+ *
+ *  Each class gets the integer part of its share of the sample, the remaining cases going
+ *  to the classes with the largest fractional parts. The sample is shuffled afterward,
+ *  so that the cases are not ordered by class.
+ */
+void DataSetSampler::drawStratified(const std::vector<int>& inLabels, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbCases = inLabels.size();
+	unsigned int lSampleSize = mSampleSize->getWrappedValue();
+	if((lSampleSize == 0) || (lSampleSize > lNbCases)) lSampleSize = lNbCases;
+
+	// Group the cases by class
+	std::map< int,std::vector<unsigned int> > lClassMap;
+	for(unsigned int i=0; i<lNbCases; ++i) lClassMap[inLabels[i]].push_back(i);
+	std::vector< std::vector<unsigned int> > lClasses;
+	lClasses.reserve(lClassMap.size());
+	for(std::map< int,std::vector<unsigned int> >::iterator lIter=lClassMap.begin();
+	        lIter!=lClassMap.end(); ++lIter) {
+		lClasses.push_back(std::vector<unsigned int>());
+		lClasses.back().swap(lIter->second);
+	}
+
+	// Compute the number of cases drawn from each class
+	std::vector<unsigned int> lQuotas(lClasses.size(), 0);
+	std::vector< std::pair<double,unsigned int> > lRemainders(lClasses.size());
+	unsigned int lAllocated = 0;
+	for(unsigned int i=0; i<lClasses.size(); ++i) {
+		const double lShare = double(lSampleSize) * lClasses[i].size() / lNbCases;
+		lQuotas[i] = (unsigned int)std::floor(lShare);
+		lRemainders[i] = std::make_pair(lShare-lQuotas[i], i);
+		lAllocated += lQuotas[i];
+	}
+	std::sort(lRemainders.begin(), lRemainders.end(), std::greater< std::pair<double,unsigned int> >());
+	for(unsigned int i=0; (lAllocated<lSampleSize) && (i<lRemainders.size()); ++i, ++lAllocated) {
+		++lQuotas[lRemainders[i].second];
+	}
+
+	// Draw the cases of each class, then shuffle the sample
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	mSample.clear();
+	mSample.reserve(lSampleSize);
+	for(unsigned int i=0; i<lClasses.size(); ++i) {
+		std::vector<unsigned int>& lClass = lClasses[i];
+		for(unsigned int j=0; j<lQuotas[i]; ++j) {
+			const unsigned int lChosen = lRandomizer.rollInteger(j, lClass.size()-1);
+			std::swap(lClass[j], lClass[lChosen]);
+			mSample.push_back(lClass[j]);
+		}
+	}
+	for(unsigned int i=1; i<mSample.size(); ++i) {
+		const unsigned int lChosen = lRandomizer.rollInteger(0, i);
+		std::swap(mSample[i], mSample[lChosen]);
+	}
+	Beagle_StackTraceEndM("void DataSetSampler::drawStratified(const std::vector<int>&,Context&)");
+}
+
+
+/*!
+ *  \brief Get the sample of a classification data set for the actual generation.
+ *  \param inDataSet Data set to sample.
+ *  \param ioContext Evolutionary context.
+ *  \return Indices of the cases of the sample.
+ *
+ *  The sample is drawn by the first call of a generation (or of a deme, when sampling per
+ *  deme), the later calls returning the same sample.
+ */
+const std::vector<unsigned int>& DataSetSampler::getSample(const DataSetClassification& inDataSet,
+        Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	#pragma omp critical (Beagle_DataSetSampler)
+	{
+		if(isOutdated(inDataSet.size(), ioContext)) {
+			if(mSampleMode->getWrappedValue() == "stratified") {
+				std::vector<int> lLabels(inDataSet.size());
+				for(unsigned int i=0; i<inDataSet.size(); ++i) lLabels[i] = inDataSet[i].first;
+				drawStratified(lLabels, ioContext);
+			} else drawRandom(inDataSet.size(), ioContext);
+			setUpdated(inDataSet.size(), ioContext);
+		}
+	}
+	return mSample;
+	Beagle_StackTraceEndM("const std::vector<unsigned int>& DataSetSampler::getSample(const DataSetClassification&,Context&)");
+}
+
+
+/*!
+ *  \brief Get the sample of a regression data set for the actual generation.
+ *  \param inDataSet Data set to sample.
+ *  \param ioContext Evolutionary context.
+ *  \return Indices of the cases of the sample.
+ *
+ *  The sample is drawn by the first call of a generation (or of a deme, when sampling per
+ *  deme), the later calls returning the same sample.
+ */
+const std::vector<unsigned int>& DataSetSampler::getSample(const DataSetRegression& inDataSet,
+        Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	#pragma omp critical (Beagle_DataSetSampler)
+	{
+		if(isOutdated(inDataSet.size(), ioContext)) {
+			drawRandom(inDataSet.size(), ioContext);
+			setUpdated(inDataSet.size(), ioContext);
+		}
+	}
+	return mSample;
+	Beagle_StackTraceEndM("const std::vector<unsigned int>& DataSetSampler::getSample(const DataSetRegression&,Context&)");
+}
+
+
+/*!
+ *  \brief Get the version of the sample of a deme.
+ *  \param inDemeIndex Index of the deme.
+ *  \return Number of samples drawn for the deme, zero if none was drawn yet.
+ *
+ *  When the sample is shared by all the demes, any draw changes the version of every deme.
+ */
+unsigned int DataSetSampler::getSampleVersion(unsigned int inDemeIndex) const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lVersion = 0;
+	#pragma omp critical (Beagle_DataSetSampler)
+	{
+		if(mSamplePerDeme->getWrappedValue() == false) lVersion = mVersion;
+		else if(inDemeIndex < mDemeVersions.size()) lVersion = mDemeVersions[inDemeIndex];
+	}
+	return lVersion;
+	Beagle_StackTraceEndM("unsigned int DataSetSampler::getSampleVersion(unsigned int) const");
+}
+
+
+/*!
+ *  \brief Initialize the data set sampler, checking the sampling mode.
+ *  \param ioSystem Evolutionary system.
+ *  \throw ValidationException If the sampling mode is unknown.
+ */
+void DataSetSampler::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::init(ioSystem);
+	if((mSampleMode->getWrappedValue() != "random") && (mSampleMode->getWrappedValue() != "stratified")) {
+		std::ostringstream lOSS;
+		lOSS << "Unknown data set sampling mode '" << mSampleMode->getWrappedValue();
+		lOSS << "', it should be 'random' or 'stratified'!";
+		throw Beagle::ValidationException(lOSS.str());
+	}
+	Beagle_StackTraceEndM("void DataSetSampler::init(System&)");
+}
+
+
+/*!
+ *  \brief Test whether a new sample must be drawn.
+ *  \param inNbCases Number of cases of the data set.
+ *  \param inContext Evolutionary context.
+ *  \return True if the sample was drawn for another generation, deme or data set size.
+ */
+bool DataSetSampler::isOutdated(unsigned int inNbCases, const Context& inContext) const
+{
+	Beagle_StackTraceBeginM();
+	if(mGeneration != inContext.getGeneration()) return true;
+	if(mSamplePerDeme->getWrappedValue() && (mDemeIndex != inContext.getDemeIndex())) return true;
+	return (mNbCases != inNbCases);
+	Beagle_StackTraceEndM("bool DataSetSampler::isOutdated(unsigned int,const Context&) const");
+}
+
+
+/*!
+ *  \brief Register the parameters of the data set sampler.
+ *  \param ioSystem Evolutionary system.
+ */
+void DataSetSampler::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Number of cases of the data set sample used to evaluate the individuals. ";
+		lOSS << "A value of zero means all the cases, in a random order.";
+		Register::Description lDescription(
+		    "Data set sample size",
+		    "UInt",
+		    uint2str(mDefaultSize),
+		    lOSS.str()
+		);
+		mSampleSize = castHandleT<UInt>(
+		                  ioSystem.getRegister().insertEntry("ds.sample.size", new UInt(mDefaultSize), lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Data set sampling mode. With 'random', the cases are drawn uniformly ";
+		lOSS << "without replacement. With 'stratified', the proportion of each class of ";
+		lOSS << "a classification data set is kept in the sample.";
+		Register::Description lDescription(
+		    "Data set sampling mode",
+		    "String",
+		    "'random'",
+		    lOSS.str()
+		);
+		mSampleMode = castHandleT<String>(
+		                  ioSystem.getRegister().insertEntry("ds.sample.mode", new String("random"), lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "If true, a new data set sample is drawn for each deme. Otherwise the ";
+		lOSS << "same sample is used for all the demes of a generation.";
+		Register::Description lDescription(
+		    "Data set sample per deme flag",
+		    "Bool",
+		    "0",
+		    lOSS.str()
+		);
+		mSamplePerDeme = castHandleT<Bool>(
+		                     ioSystem.getRegister().insertEntry("ds.sample.perdeme", new Bool(false), lDescription));
+	}
+	Beagle_StackTraceEndM("void DataSetSampler::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Record the generation, deme and data set size of the sample just drawn, and
+ *    increment the sample versions.
+ *  \param inNbCases Number of cases of the data set.
+ *  \param inContext Evolutionary context.
+ */
+void DataSetSampler::setUpdated(unsigned int inNbCases, const Context& inContext)
+{
+	Beagle_StackTraceBeginM();
+	mNbCases = inNbCases;
+	mGeneration = inContext.getGeneration();
+	mDemeIndex = inContext.getDemeIndex();
+	++mVersion;
+	if(mDemeVersions.size() <= mDemeIndex) mDemeVersions.resize(mDemeIndex+1, 0);
+	++mDemeVersions[mDemeIndex];
+	Beagle_StackTraceEndM("void DataSetSampler::setUpdated(unsigned int,const Context&)");
+}
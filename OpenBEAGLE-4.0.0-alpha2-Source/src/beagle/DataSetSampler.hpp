@@ -0,0 +1,138 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/DataSetSampler.hpp
+ *  \brief  Definition of the class DataSetSampler.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_DataSetSampler_hpp
+#define Beagle_DataSetSampler_hpp
+
+#include <string>
+#include <vector>
+
+#include "PACC/XML.hpp"
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Pointer.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/Allocator.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/Container.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Component.hpp"
+#include "beagle/UInt.hpp"
+#include "beagle/Bool.hpp"
+#include "beagle/String.hpp"
+#include "beagle/DataSetClassification.hpp"
+#include "beagle/DataSetRegression.hpp"
+
+
+namespace Beagle
+{
+
+// Forward declarations
+class Context;
+class System;
+
+
+/*!
+ *  \class DataSetSampler beagle/DataSetSampler.hpp "beagle/DataSetSampler.hpp"
+ *  \brief Sample of the cases of a data set, shared by all the evaluations of a generation.
+ *  \ingroup ECF
+ *  \ingroup Sys
+ *
+ *  The sampler draws the indices of \c ds.sample.size cases of a data set once per
+ *  generation (or once per deme and generation, when \c ds.sample.perdeme is true), and
+ *  returns the same sample to all the evaluations, whatever the thread they run into.
+ *  A sample size of zero selects all the cases of the data set, in a random order.
+ *  Each draw increments the sample version of the deme (of all the demes, when the sample
+ *  is shared), so that users can detect sample changes by comparing versions.
+ *
+ *  Two sampling modes are available with parameter \c ds.sample.mode: \c random draws the
+ *  cases uniformly without replacement, while \c stratified keeps the proportion of each
+ *  class of a classification data set in the sample. Regression data sets are always
+ *  sampled randomly.
+ *
+ *  \code
+ *  Beagle::System::Handle lSystem = new System;
+ *  lSystem->addComponent(new Beagle::DataSetSampler(400));
+ *  \endcode
+ */
+class DataSetSampler : public Component
+{
+
+public:
+
+	//! DataSetSampler allocator type.
+	typedef AllocatorT<DataSetSampler,Component::Alloc> Alloc;
+	//! DataSetSampler handle type.
+	typedef PointerT<DataSetSampler,Component::Handle> Handle;
+	//! DataSetSampler bag type.
+	typedef ContainerT<DataSetSampler,Component::Bag> Bag;
+
+	explicit DataSetSampler(unsigned int inSampleSize=0);
+	virtual ~DataSetSampler()
+	{ }
+
+	const std::vector<unsigned int>& getSample(const DataSetClassification& inDataSet, Context& ioContext);
+	const std::vector<unsigned int>& getSample(const DataSetRegression& inDataSet, Context& ioContext);
+	unsigned int                     getSampleVersion(unsigned int inDemeIndex) const;
+	virtual void                     init(System& ioSystem);
+	virtual void                     registerParams(System& ioSystem);
+
+protected:
+
+	void drawRandom(unsigned int inNbCases, Context& ioContext);
+	void drawStratified(const std::vector<int>& inLabels, Context& ioContext);
+	bool isOutdated(unsigned int inNbCases, const Context& inContext) const;
+	void setUpdated(unsigned int inNbCases, const Context& inContext);
+
+	UInt::Handle              mSampleSize;     //!< Number of cases in the sample.
+	String::Handle            mSampleMode;     //!< Sampling mode, 'random' or 'stratified'.
+	Bool::Handle              mSamplePerDeme;  //!< True: draw a new sample for each deme.
+	unsigned int              mDefaultSize;    //!< Default value of the sample size parameter.
+	std::vector<unsigned int> mSample;         //!< Indices of the cases of the actual sample.
+	std::vector<unsigned int> mPermutation;    //!< Permutation of the cases, for random draws.
+	unsigned int              mNbCases;        //!< Size of the data set when the sample was drawn.
+	unsigned int              mGeneration;     //!< Generation at which the sample was drawn.
+	unsigned int              mDemeIndex;      //!< Deme for which the sample was drawn.
+	unsigned int              mVersion;        //!< Number of samples drawn.
+	std::vector<unsigned int> mDemeVersions;   //!< Number of samples drawn for each deme.
+
+};
+
+}
+
+#endif // Beagle_DataSetSampler_hpp
@@ -85,18 +85,25 @@ Individual::Handle EvaluationOp::breed(Individual::Bag& inBreedingPool,
 		    "Evaluating the fitness of a new bred individual"
 		);
 
-		lBredIndividual->setFitness(evaluate(*lBredIndividual, ioContext));
+		FitnessCache::Handle lCache = castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
+		Fitness::Handle lCachedFitness = (lCache != NULL) ? lCache->find(*lBredIndividual, ioContext) : NULL;
+		if(lCachedFitness != NULL) lBredIndividual->setFitness(lCachedFitness);
+		else lBredIndividual->setFitness(evaluate(*lBredIndividual, ioContext));
 		lBredIndividual->getFitness()->setValid();
+		lBredIndividual->removeMember("FitnessDelta");
 		History::Handle lHistory = castHandleT<History>(ioContext.getSystem().haveComponent("History"));
 		if(lHistory != NULL) {
 			lHistory->allocateID(*lBredIndividual);
 			lHistory->trace(ioContext, std::vector<HistoryID>(), lBredIndividual, getName(), "evaluation");
 		}
 
-		ioContext.setProcessedDeme(ioContext.getProcessedDeme()+1);
-		ioContext.setTotalProcessedDeme(ioContext.getTotalProcessedDeme()+1);
-		ioContext.setProcessedVivarium(ioContext.getProcessedVivarium()+1);
-		ioContext.setTotalProcessedVivarium(ioContext.getTotalProcessedVivarium()+1);
+		if(lCachedFitness == NULL) {
+			if(lCache != NULL) lCache->insert(*lBredIndividual, ioContext);
+			ioContext.setProcessedDeme(ioContext.getProcessedDeme()+1);
+			ioContext.setTotalProcessedDeme(ioContext.getTotalProcessedDeme()+1);
+			ioContext.setProcessedVivarium(ioContext.getProcessedVivarium()+1);
+			ioContext.setTotalProcessedVivarium(ioContext.getTotalProcessedVivarium()+1);
+		}
 
 		Beagle_LogObjectM(
 		    ioContext.getSystem().getLogger(),
@@ -114,6 +121,26 @@ Individual::Handle EvaluationOp::breed(Individual::Bag& inBreedingPool,
 }
 
 
+/*!
+ *  \brief Evaluate the fitness of a batch of individuals at once.
+ *  \param ioIndividuals Individuals to evaluate.
+ *  \param ioContext Evolutionary context.
+ *  \return True if the individuals have been evaluated, false if the operator doesn't
+ *    support batch evaluation.
+ *
+ *  Operators evaluating cheap objective functions can override this method to compute the
+ *  fitness of all the individuals in one pass, for instance over their genotypes packed
+ *  contiguously, without the call and allocation overhead of evaluate. The
+ *  fitness of each individual is set in place, reusing its current fitness object when it
+ *  has one; the operator validates them afterward. The default implementation returns
+ *  false, so that the individuals are evaluated one by one with evaluate.
+ */
+bool EvaluationOp::evaluateBatch(Individual::Bag& ioIndividuals, Context& ioContext)
+{
+	return false;
+}
+
+
 /*!
  *  \return Return selection probability of breeder operator.
  *  \param inChild Child node in the breeder tree.
@@ -148,69 +175,98 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 
 	prepareStats(ioDeme,ioContext);
 	History::Handle lHistory = castHandleT<History>(ioContext.getSystem().haveComponent("History"));
+	FitnessCache::Handle lCache = castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
 
 	int lNbrEvaluations = 0; // Used to count how many evaluations have been done.
-	const int lSize = ioDeme.size();
+	int lNbrCacheHits = 0;   // Used to count how many fitnesses have been found in the cache.
+
+	// Gather the invalid individuals, taking the fitnesses found in the cache.
+	Individual::Bag lInvalids;
+	std::vector<unsigned int> lInvalidIndices;
+	for(unsigned int i=0; i<ioDeme.size(); ++i) {
+		if((ioDeme[i]->getFitness() != NULL) && ioDeme[i]->getFitness()->isValid()) continue;
+		if(lCache != NULL) {
+			ioContext.setIndividualIndex(i);
+			ioContext.setIndividualHandle(ioDeme[i]);
+			Fitness::Handle lCachedFitness = lCache->find(*ioDeme[i], ioContext);
+			if(lCachedFitness != NULL) {
+				ioDeme[i]->setFitness(lCachedFitness);
+				ioDeme[i]->removeMember("FitnessDelta");
+				++lNbrCacheHits;
+				if(lHistory != NULL) {
+					lHistory->allocateID(*ioDeme[i]);
+					lHistory->trace(ioContext, std::vector<HistoryID>(), ioDeme[i], getName(), "evaluation");
+				}
+				Beagle_LogObjectM(
+				    ioContext.getSystem().getLogger(),
+				    Logger::eVerbose,
+				    "evaluation",
+				    "Beagle::EvaluationOp",
+				    *ioDeme[i]->getFitness()
+				);
+				continue;
+			}
+		}
+		lInvalids.push_back(ioDeme[i]);
+		lInvalidIndices.push_back(i);
+	}
+	const int lSize = lInvalids.size();
 
+	// Evaluate the individuals in one batch, or one by one if the operator can't.
+	if((lSize > 0) && (evaluateBatch(lInvalids, ioContext) == false)) {
 #if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-	static OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioContext.getSystem().getComponent("OpenMP"));
-	const Factory& lFactory = ioContext.getSystem().getFactory();
-	const std::string& lContextName = lFactory.getConceptTypeName("Context");
-	Context::Alloc::Handle lContextAlloc = castHandleT<Context::Alloc>(lFactory.getAllocator(lContextName));
-	Context::Bag lContexts(lOpenMP->getMaxNumThreads());
-	for(unsigned int i = 0; i < lOpenMP->getMaxNumThreads(); ++i)
-		lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
+		static OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioContext.getSystem().getComponent("OpenMP"));
+		const Factory& lFactory = ioContext.getSystem().getFactory();
+		const std::string& lContextName = lFactory.getConceptTypeName("Context");
+		Context::Alloc::Handle lContextAlloc = castHandleT<Context::Alloc>(lFactory.getAllocator(lContextName));
+		Context::Bag lContexts(lOpenMP->getMaxNumThreads());
+		for(unsigned int i = 0; i < lOpenMP->getMaxNumThreads(); ++i)
+			lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
 #if defined(BEAGLE_USE_OMP_NR)
-	#pragma omp parallel for reduction(+:lNbrEvaluations) schedule(dynamic)
+		#pragma omp parallel for schedule(dynamic)
 #elif defined(BEAGLE_USE_OMP_R) 
-	const int lChunkSize = std::max((int)(lSize / lOpenMP->getMaxNumThreads()), 1);
-	#pragma omp parallel for reduction(+:lNbrEvaluations) schedule(static, lChunkSize)
+		const int lChunkSize = std::max((int)(lSize / lOpenMP->getMaxNumThreads()), 1);
+		#pragma omp parallel for schedule(static, lChunkSize)
 #endif
 #endif
-	for(int i=0; i < lSize; ++i) {
-		if((ioDeme[i]->getFitness() == NULL) ||
-			(ioDeme[i]->getFitness()->isValid() == false)) {
-
+		for(int i=0; i < lSize; ++i) {
 			Beagle_LogVerboseM(
 			    ioContext.getSystem().getLogger(),
 			    "evaluation", "Beagle::EvaluationOp",
-			    std::string("Evaluating the fitness of the ")+uint2ordinal(i+1)+
+			    std::string("Evaluating the fitness of the ")+uint2ordinal(lInvalidIndices[i]+1)+
 			    " individual"
 			);
 
 #if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-			lContexts[lOpenMP->getThreadNum()]->setIndividualIndex(i);
-			lContexts[lOpenMP->getThreadNum()]->setIndividualHandle(ioDeme[i]);
-			ioDeme[i]->setFitness(evaluate(*ioDeme[i], *lContexts[lOpenMP->getThreadNum()]));
+			Context& lThreadContext = *lContexts[lOpenMP->getThreadNum()];
 #else 
-			ioContext.setIndividualIndex(i);
-			ioContext.setIndividualHandle(ioDeme[i]);
-			ioDeme[i]->setFitness(evaluate(*ioDeme[i], ioContext));
+			Context& lThreadContext = ioContext;
 #endif
-			ioDeme[i]->getFitness()->setValid();	
-			if(lHistory != NULL) {
-				#pragma omp critical (Beagle_History)
-				{
-					lHistory->allocateID(*ioDeme[i]);
-#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-					lHistory->trace(*lContexts[lOpenMP->getThreadNum()], std::vector<HistoryID>(), ioDeme[i], getName(), "evaluation");
-#else 
-					lHistory->trace(ioContext, std::vector<HistoryID>(), ioDeme[i], getName(), "evaluation");
-#endif
-				}
-			}
-			
-
-			++lNbrEvaluations;
+			lThreadContext.setIndividualIndex(lInvalidIndices[i]);
+			lThreadContext.setIndividualHandle(lInvalids[i]);
+			lInvalids[i]->setFitness(evaluate(*lInvalids[i], lThreadContext));
+		}
+	}
 
-			Beagle_LogObjectM(
-			    ioContext.getSystem().getLogger(),
-			    Logger::eVerbose,
-			    "evaluation",
-			    "Beagle::EvaluationOp",
-			    *ioDeme[i]->getFitness()
-			);
+	for(int i=0; i < lSize; ++i) {
+		lInvalids[i]->getFitness()->setValid();
+		lInvalids[i]->removeMember("FitnessDelta");
+		ioContext.setIndividualIndex(lInvalidIndices[i]);
+		ioContext.setIndividualHandle(lInvalids[i]);
+		if(lCache != NULL) lCache->insert(*lInvalids[i], ioContext);
+		++lNbrEvaluations;
+		if(lHistory != NULL) {
+			lHistory->allocateID(*lInvalids[i]);
+			lHistory->trace(ioContext, std::vector<HistoryID>(), lInvalids[i], getName(), "evaluation");
 		}
+
+		Beagle_LogObjectM(
+		    ioContext.getSystem().getLogger(),
+		    Logger::eVerbose,
+		    "evaluation",
+		    "Beagle::EvaluationOp",
+		    *lInvalids[i]->getFitness()
+		);
 	}
 
 	ioContext.setIndividualIndex(lOldIndividualIndex);
@@ -220,7 +276,7 @@ void EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 	updateHallOfFameWithDeme(ioDeme,ioContext);
 
 	// Warn if the operator has not evaluated anything
-	if(lNbrEvaluations == 0) {
+	if((lNbrEvaluations == 0) && (lNbrCacheHits == 0)) {
 		Beagle_LogBasicM(
 		    ioContext.getSystem().getLogger(),
 		    "evaluation", "Beagle::EvaluationOp",
@@ -243,6 +299,7 @@ void EvaluationOp::prepareStats(Deme& ioDeme, Context& ioContext)
 	Beagle_StackTraceBeginM();
 	
 	Stats::Handle lDemeStats = ioDeme.getStats();
+	FitnessCache::Handle lCache = castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
 
 	if(lDemeStats == NULL) {
 		const Factory& lFactory = ioContext.getSystem().getFactory();
@@ -263,6 +320,7 @@ void EvaluationOp::prepareStats(Deme& ioDeme, Context& ioContext)
 		ioContext.setProcessedDeme(0);
 		ioContext.setTotalProcessedDeme(0);
 	}
+	if(lCache != NULL) lCache->resetDemeCounters();
 
 	if(ioContext.getDemeIndex()==0) {
 	
@@ -288,6 +346,7 @@ void EvaluationOp::prepareStats(Deme& ioDeme, Context& ioContext)
 			ioContext.setProcessedVivarium(0);
 			ioContext.setTotalProcessedVivarium(0);
 		}
+		if(lCache != NULL) lCache->resetVivariumCounters();
 
 	}
 
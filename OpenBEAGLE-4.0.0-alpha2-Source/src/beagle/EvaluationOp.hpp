@@ -93,6 +93,7 @@ public:
 	virtual Individual::Handle breed(Individual::Bag& inBreedingPool,
 	                                 BreederNode::Handle inChild,
 	                                 Context& ioContext);
+	virtual bool               evaluateBatch(Individual::Bag& ioIndividuals, Context& ioContext);
 	virtual double             getBreedingProba(BreederNode::Handle inChild);
 	virtual void               registerParams(System& ioSystem);
 	virtual void               operate(Deme& ioDeme, Context& ioContext);
@@ -104,6 +104,40 @@ double Fitness::getObjective(unsigned int inObjIndex) const
 }
 
 
+/*!
+ *  \brief  Write the sort key of the fitness.
+ *  \param  outKey Array of getSortKeySize() values where the key is written.
+ *  \throw  Beagle::InternalException If the method is not overdefined in a subclass.
+ *
+ *  The sort key is an array of values such that a fitness is less than another
+ *  (as defined by isLess) if and only if its key is lexicographically less than the key
+ *  of the other fitness. It allows selection operators to work on a flat array of
+ *  values instead of calling isLess on each comparison.
+ */
+void Fitness::getSortKey(double* outKey) const
+{
+	Beagle_StackTraceBeginM();
+	throw Beagle_UndefinedMethodInternalExceptionM("getSortKey", "Fitness", getType());
+	Beagle_StackTraceEndM("void Fitness::getSortKey(double*) const");
+}
+
+
+/*!
+ *  \brief  Get the number of values in the sort key of the fitness.
+ *  \return Size of the sort key, 0 if the fitness has no sort key.
+ *
+ *  By default, a fitness has no sort key and can only be compared with isLess.
+ *  \warning A fitness type that overloads isLess must also overload getSortKey and
+ *    getSortKeySize consistently, or return 0 as the size of its sort key.
+ */
+unsigned int Fitness::getSortKeySize() const
+{
+	Beagle_StackTraceBeginM();
+	return 0;
+	Beagle_StackTraceEndM("unsigned int Fitness::getSortKeySize() const");
+}
+
+
 /*!
  *  \brief  Test if an fitness is Pareto dominated by another.
  *  \param  inRightFitness Right fitness value used to compute domination.
@@ -124,6 +124,8 @@ public:
 	virtual const std::string&  getName() const;
 	virtual unsigned int        getNumberOfObjectives() const;
 	virtual double              getObjective(unsigned int inObjIndex) const;
+	virtual void                getSortKey(double* outKey) const;
+	virtual unsigned int        getSortKeySize() const;
 	virtual bool                isDominated(const Fitness& inRightFitness) const;
 	virtual void                read(PACC::XML::ConstIterator inIter);
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
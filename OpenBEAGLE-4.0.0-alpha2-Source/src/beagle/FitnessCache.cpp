@@ -0,0 +1,225 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/src/FitnessCache.cpp
+ *  \brief  Source code of class FitnessCache.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a fitness cache component.
+ */
+FitnessCache::FitnessCache() :
+		Component("FitnessCache"),
+		mDemeHits(0),
+		mDemeMisses(0),
+		mVivaHits(0),
+		mVivaMisses(0)
+{ }
+
+
+/*!
+ *  \brief Remove all entries from the cache.
+ */
+void FitnessCache::clear()
+{
+	Beagle_StackTraceBeginM();
+	#pragma omp critical (Beagle_FitnessCache)
+	{
+		mEntries.clear();
+		mIndex.clear();
+	}
+	Beagle_StackTraceEndM("void FitnessCache::clear()");
+}
+
+
+/*!
+ *  \brief Look for the fitness of an individual in the cache.
+ *  \param inIndividual Individual to look for.
+ *  \param ioContext Evolutionary context.
+ *  \return Copy of the cached fitness if the individual is found, NULL otherwise.
+ *
+ *  The fitness is copied while the cache is locked, as the reference counts of the handles
+ *  held by the cache are not thread-safe.
+ */
+Fitness::Handle FitnessCache::find(const Individual& inIndividual, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mCacheSize->getWrappedValue() == 0) return NULL;
+	const unsigned int lHash = inIndividual.getHash();
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	Fitness::Handle lFitness = NULL;
+	#pragma omp critical (Beagle_FitnessCache)
+	{
+		std::pair<EntryIndex::iterator,EntryIndex::iterator> lRange = mIndex.equal_range(lHash);
+		for(EntryIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+			if(isSameGenotypes(inIndividual, *lIter->second->mIndividual)) {
+				// Move entry to the front of the list, as the most recently used
+				mEntries.splice(mEntries.begin(), mEntries, lIter->second);
+				const Fitness& lCachedFitness = *lIter->second->mIndividual->getFitness();
+				Fitness::Alloc::Handle lFitnessAlloc =
+					castHandleT<Fitness::Alloc>(lFactory.getAllocator(lCachedFitness.getType()));
+				lFitness = castHandleT<Fitness>(lFitnessAlloc->allocate());
+				lFitness->copy(lCachedFitness, ioContext.getSystem());
+				break;
+			}
+		}
+		if(lFitness == NULL) {
+			++mDemeMisses;
+			++mVivaMisses;
+		} else {
+			++mDemeHits;
+			++mVivaHits;
+		}
+	}
+	return lFitness;
+	Beagle_StackTraceEndM("Fitness::Handle FitnessCache::find(const Individual&,Context&)");
+}
+
+
+/*!
+ *  \brief Insert an evaluated individual into the cache.
+ *  \param inIndividual Individual to insert, with a valid fitness.
+ *  \param ioContext Evolutionary context.
+ *
+ *  The individual is copied, so that later modifications of it do not alter the cache.
+ *  When the cache is full, the least recently used entry is removed.
+ */
+void FitnessCache::insert(const Individual& inIndividual, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mCacheSize->getWrappedValue() == 0) return;
+	Beagle_NonNullPointerAssertM(inIndividual.getFitness());
+
+	const Factory& lFactory = ioContext.getSystem().getFactory();
+	Individual::Alloc::Handle lIndividualAlloc =
+		castHandleT<Individual::Alloc>(lFactory.getAllocator(inIndividual.getType()));
+	Entry lEntry;
+	lEntry.mHash = inIndividual.getHash();
+	lEntry.mIndividual = castHandleT<Individual>(lIndividualAlloc->allocate());
+	lEntry.mIndividual->copy(inIndividual, ioContext.getSystem());
+
+	#pragma omp critical (Beagle_FitnessCache)
+	{
+		// The individual handle is moved into the list, to leave its count to the cache
+		mEntries.push_front(Entry());
+		mEntries.front().mHash = lEntry.mHash;
+		std::swap(mEntries.front().mIndividual, lEntry.mIndividual);
+		mIndex.insert(std::make_pair(lEntry.mHash, mEntries.begin()));
+		while(mEntries.size() > mCacheSize->getWrappedValue()) {
+			EntryList::iterator lLast = --mEntries.end();
+			std::pair<EntryIndex::iterator,EntryIndex::iterator> lRange = mIndex.equal_range(lLast->mHash);
+			for(EntryIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+				if(lIter->second == lLast) {
+					mIndex.erase(lIter);
+					break;
+				}
+			}
+			mEntries.erase(lLast);
+		}
+	}
+	Beagle_StackTraceEndM("void FitnessCache::insert(const Individual&,Context&)");
+}
+
+
+/*!
+ *  \brief Test whether two individuals have the same genotypes.
+ *  \param inLeft First individual to compare.
+ *  \param inRight Second individual to compare.
+ *  \return True if the genotypes are equal, false if not.
+ *  \par Note:
+ *    Contrary to Individual::isIdentical, the fitness values are not compared.
+ */
+bool FitnessCache::isSameGenotypes(const Individual& inLeft, const Individual& inRight) const
+{
+	Beagle_StackTraceBeginM();
+	if(inLeft.size() != inRight.size()) return false;
+	for(unsigned int i=0; i<inLeft.size(); ++i) {
+		if(inLeft[i]->getType() != inRight[i]->getType()) return false;
+		if(inLeft[i]->isEqual(*inRight[i]) == false) return false;
+	}
+	return true;
+	Beagle_StackTraceEndM("bool FitnessCache::isSameGenotypes(const Individual&,const Individual&) const");
+}
+
+
+/*!
+ *  \brief Register the parameters of the fitness cache.
+ *  \param ioSystem Evolutionary system.
+ */
+void FitnessCache::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Maximum number of evaluated individuals kept in the fitness cache. ";
+		lOSS << "The least recently used individuals are dropped when the cache is full. ";
+		lOSS << "A value of zero disables the cache.";
+		Register::Description lDescription(
+		    "Fitness cache size",
+		    "UInt",
+		    "1000",
+		    lOSS.str()
+		);
+		mCacheSize = castHandleT<UInt>(
+		                 ioSystem.getRegister().insertEntry("ec.cache.size", new UInt(1000), lDescription));
+	}
+	Beagle_StackTraceEndM("void FitnessCache::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Reset the deme hit and miss counters.
+ */
+void FitnessCache::resetDemeCounters()
+{
+	Beagle_StackTraceBeginM();
+	mDemeHits = 0;
+	mDemeMisses = 0;
+	Beagle_StackTraceEndM("void FitnessCache::resetDemeCounters()");
+}
+
+
+/*!
+ *  \brief Reset the vivarium hit and miss counters.
+ */
+void FitnessCache::resetVivariumCounters()
+{
+	Beagle_StackTraceBeginM();
+	mVivaHits = 0;
+	mVivaMisses = 0;
+	Beagle_StackTraceEndM("void FitnessCache::resetVivariumCounters()");
+}
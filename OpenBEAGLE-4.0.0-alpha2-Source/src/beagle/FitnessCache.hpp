@@ -0,0 +1,192 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/FitnessCache.hpp
+ *  \brief  Definition of the class FitnessCache.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_FitnessCache_hpp
+#define Beagle_FitnessCache_hpp
+
+#include <list>
+#include <map>
+
+#include "PACC/XML.hpp"
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Pointer.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/Allocator.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/Container.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Component.hpp"
+#include "beagle/UInt.hpp"
+#include "beagle/Individual.hpp"
+#include "beagle/Fitness.hpp"
+
+
+namespace Beagle
+{
+
+// Forward declarations
+class Context;
+class System;
+
+
+/*!
+ *  \class FitnessCache beagle/FitnessCache.hpp "beagle/FitnessCache.hpp"
+ *  \brief Bounded cache of fitness values, keyed by genotype hash.
+ *  \ingroup ECF
+ *  \ingroup Sys
+ *
+ *  When installed into the system, the fitness cache is consulted by the evaluation
+ *  operators before calling evaluate() on an individual. Individuals are looked up
+ *  by the hash value of their genotypes, and a hit is confirmed by a full comparison
+ *  of the genotypes. The least recently used entries are dropped when the cache holds
+ *  more than \c ec.cache.size entries.
+ *
+ *  \code
+ *  Beagle::System::Handle lSystem = new System;
+ *  lSystem->addComponent(new Beagle::FitnessCache());
+ *  \endcode
+ *
+ *  The number of cache hits and misses are reported into the deme and vivarium
+ *  statistics as items \c cache-hits and \c cache-misses.
+ *
+ *  \warning The cache assumes that the fitness of an individual depends only on its
+ *    genotypes. It must not be installed when the evaluation is stochastic or varies
+ *    over the generations.
+ */
+class FitnessCache : public Component
+{
+
+public:
+
+	//! FitnessCache allocator type.
+	typedef AllocatorT<FitnessCache,Component::Alloc> Alloc;
+	//! FitnessCache handle type.
+	typedef PointerT<FitnessCache,Component::Handle> Handle;
+	//! FitnessCache bag type.
+	typedef ContainerT<FitnessCache,Component::Bag> Bag;
+
+	explicit FitnessCache();
+	virtual ~FitnessCache()
+	{ }
+
+	void                      clear();
+	Fitness::Handle           find(const Individual& inIndividual, Context& ioContext);
+	void                      insert(const Individual& inIndividual, Context& ioContext);
+	virtual void              registerParams(System& ioSystem);
+	void                      resetDemeCounters();
+	void                      resetVivariumCounters();
+
+	/*!
+	 *  \return Number of cache hits since the deme counters were reset.
+	 */
+	inline unsigned int getDemeHits() const
+	{
+		Beagle_StackTraceBeginM();
+		return mDemeHits;
+		Beagle_StackTraceEndM("unsigned int FitnessCache::getDemeHits() const");
+	}
+
+	/*!
+	 *  \return Number of cache misses since the deme counters were reset.
+	 */
+	inline unsigned int getDemeMisses() const
+	{
+		Beagle_StackTraceBeginM();
+		return mDemeMisses;
+		Beagle_StackTraceEndM("unsigned int FitnessCache::getDemeMisses() const");
+	}
+
+	/*!
+	 *  \return Number of cache hits since the vivarium counters were reset.
+	 */
+	inline unsigned int getVivariumHits() const
+	{
+		Beagle_StackTraceBeginM();
+		return mVivaHits;
+		Beagle_StackTraceEndM("unsigned int FitnessCache::getVivariumHits() const");
+	}
+
+	/*!
+	 *  \return Number of cache misses since the vivarium counters were reset.
+	 */
+	inline unsigned int getVivariumMisses() const
+	{
+		Beagle_StackTraceBeginM();
+		return mVivaMisses;
+		Beagle_StackTraceEndM("unsigned int FitnessCache::getVivariumMisses() const");
+	}
+
+	/*!
+	 *  \return Number of entries actually in the cache.
+	 */
+	inline unsigned int getSize() const
+	{
+		Beagle_StackTraceBeginM();
+		return mEntries.size();
+		Beagle_StackTraceEndM("unsigned int FitnessCache::getSize() const");
+	}
+
+protected:
+
+	/*!
+	 *  \brief Cache entry, a copy of an evaluated individual with its hash value.
+	 */
+	struct Entry
+	{
+		unsigned int       mHash;        //!< Hash value of the individual's genotypes.
+		Individual::Handle mIndividual;  //!< Copy of the evaluated individual.
+	};
+
+	typedef std::list<Entry> EntryList;
+	typedef std::multimap<unsigned int,EntryList::iterator> EntryIndex;
+
+	bool isSameGenotypes(const Individual& inLeft, const Individual& inRight) const;
+
+	UInt::Handle  mCacheSize;   //!< Maximum number of entries in the cache.
+	EntryList     mEntries;     //!< Cache entries, from the most to the least recently used.
+	EntryIndex    mIndex;       //!< Index of the entries by hash value.
+	unsigned int  mDemeHits;    //!< Number of hits since the deme counters were reset.
+	unsigned int  mDemeMisses;  //!< Number of misses since the deme counters were reset.
+	unsigned int  mVivaHits;    //!< Number of hits since the vivarium counters were reset.
+	unsigned int  mVivaMisses;  //!< Number of misses since the vivarium counters were reset.
+
+};
+
+}
+
+#endif // Beagle_FitnessCache_hpp
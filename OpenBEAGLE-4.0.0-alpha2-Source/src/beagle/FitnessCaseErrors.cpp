@@ -0,0 +1,181 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/src/FitnessCaseErrors.cpp
+ *  \brief  Source code of class FitnessCaseErrors.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+#include <cfloat>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a valid fitness with the errors made on the fitness cases.
+ *  \param inValue Value of the fitness.
+ *  \param inErrors Errors made on each fitness case.
+ */
+FitnessCaseErrors::FitnessCaseErrors(double inValue, const std::vector<double>& inErrors) :
+		FitnessSimple(inValue)
+{
+	setErrors(inErrors);
+}
+
+
+/*!
+ *  \brief Copy fitness into current.
+ *  \param inOriginal Fitness to copy.
+ *  \param ioSystem Evolutionary system to use for making the copy.
+ */
+void FitnessCaseErrors::copy(const Member& inOriginal, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	const FitnessCaseErrors& lOriginal = castObjectT<const FitnessCaseErrors&>(inOriginal);
+	(*this) = lOriginal;
+	Beagle_StackTraceEndM("void FitnessCaseErrors::copy(const Member&,System&)");
+}
+
+
+/*!
+ *  \brief Get exact type of the fitness.
+ *  \return Exact type of the fitness.
+ */
+const std::string& FitnessCaseErrors::getType() const
+{
+	Beagle_StackTraceBeginM();
+	const static std::string lType("FitnessCaseErrors");
+	return lType;
+	Beagle_StackTraceEndM("const std::string& FitnessCaseErrors::getType() const")
+}
+
+
+/*!
+ *  \brief Read a fitness with case errors from a XML subtree.
+ *  \param inIter XML iterator to use to read the fitness.
+ */
+void FitnessCaseErrors::read(PACC::XML::ConstIterator inIter)
+{
+	Beagle_StackTraceBeginM();
+	if((inIter->getType()!=PACC::XML::eData) || (inIter->getValue()!="Fitness"))
+		throw Beagle_IOExceptionNodeM(*inIter, "tag <Fitness> expected!");
+
+	const std::string& lValid = inIter->getAttribute("valid");
+	if(lValid.empty() || (lValid == "yes")) {
+
+		// Check type of fitness read
+		const std::string& lType = inIter->getAttribute("type");
+		if((lType.empty() == false) && (lType != getType())) {
+			std::ostringstream lOSS;
+			lOSS << "type given '" << lType << "' mismatch type of the fitness '";
+			lOSS << getType() << "'!";
+			throw Beagle_IOExceptionNodeM(*inIter, lOSS.str());
+		}
+
+		// Read value and errors
+		bool lValueRead = false;
+		mErrors.clear();
+		for(PACC::XML::ConstIterator lChild=inIter->getFirstChild(); lChild; ++lChild) {
+			if(lChild->getType() != PACC::XML::eData) continue;
+			if(lChild->getValue() == "Value") {
+				PACC::XML::ConstIterator lChild2 = lChild->getFirstChild();
+				if((!lChild2) || (lChild2->getType() != PACC::XML::eString))
+					throw Beagle_IOExceptionNodeM(*lChild, "needed a double value in the <Value> tag!");
+				mValue = str2dbl(lChild2->getValue());
+				lValueRead = true;
+			} else if(lChild->getValue() == "Errors") {
+				PACC::XML::ConstIterator lChild2 = lChild->getFirstChild();
+				if(!lChild2) continue;
+				if(lChild2->getType() != PACC::XML::eString)
+					throw Beagle_IOExceptionNodeM(*lChild, "needed comma-separated values in the <Errors> tag!");
+				std::istringstream lISS(lChild2->getValue());
+				double lError = 0.0;
+				while(lISS >> lError) {
+					mErrors.push_back(lError);
+					if(lISS.peek() == ',') lISS.get();
+				}
+			}
+		}
+		if(lValueRead == false) throw Beagle_IOExceptionNodeM(*inIter, "no fitness value present!");
+		setValid();
+
+	} else if(lValid == "no") {
+		mErrors.clear();
+		setInvalid();
+	}
+	else {
+		throw Beagle_IOExceptionNodeM(*inIter, "bad fitness validity value!");
+	}
+
+	Beagle_StackTraceEndM("void FitnessCaseErrors::read(PACC::XML::ConstIterator)");
+}
+
+
+/*!
+ *  \brief Set the errors made on the fitness cases.
+ *  \param inErrors Errors made on each fitness case.
+ */
+void FitnessCaseErrors::setErrors(const std::vector<double>& inErrors)
+{
+	Beagle_StackTraceBeginM();
+	mErrors = inErrors;
+	for(unsigned int i=0; i<mErrors.size(); ++i) {
+		if(isFinite(mErrors[i]) == false) mErrors[i] = DBL_MAX;
+	}
+	Beagle_StackTraceEndM("void FitnessCaseErrors::setErrors(const std::vector<double>&)");
+}
+
+
+/*!
+ *  \brief Write a fitness with case errors into an XML streamer.
+ *  \param ioStreamer XML streamer to use to write the fitness.
+ *  \param inIndent Whether output should be indented.
+ */
+void FitnessCaseErrors::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const
+{
+	Beagle_StackTraceBeginM();
+	ioStreamer.openTag("Value", false);
+	ioStreamer.insertStringContent(dbl2str(mValue));
+	ioStreamer.closeTag();
+	ioStreamer.openTag("Errors", false);
+	ioStreamer.insertAttribute("size", uint2str(mErrors.size()));
+	std::ostringstream lOSS;
+	lOSS.precision(12);
+	for(unsigned int i=0; i<mErrors.size(); ++i) {
+		if(i != 0) lOSS << ',';
+		lOSS << mErrors[i];
+	}
+	ioStreamer.insertStringContent(lOSS.str());
+	ioStreamer.closeTag();
+	Beagle_StackTraceEndM("void FitnessCaseErrors::writeContent(PACC::XML::Streamer&,bool) const");
+}
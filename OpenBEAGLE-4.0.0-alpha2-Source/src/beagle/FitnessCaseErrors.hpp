@@ -0,0 +1,118 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/FitnessCaseErrors.hpp
+ *  \brief  Definition of the class FitnessCaseErrors.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_FitnessCaseErrors_hpp
+#define Beagle_FitnessCaseErrors_hpp
+
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Stats.hpp"
+#include "beagle/Fitness.hpp"
+#include "beagle/FitnessSimple.hpp"
+
+namespace Beagle
+{
+
+/*!
+ *  \class FitnessCaseErrors beagle/FitnessCaseErrors.hpp "beagle/FitnessCaseErrors.hpp"
+ *  \brief Simple fitness with the errors made on each fitness case.
+ *  \ingroup ECF
+ *  \ingroup FitStats
+ *
+ *  The fitness value is used as a simple maximization fitness by the operators, while the
+ *  errors, stored contiguously, are used by case-based operators such as lexicase
+ *  selection (see SelectLexicaseOp). Lower errors are better, non-finite errors are
+ *  replaced by DBL_MAX.
+ */
+class FitnessCaseErrors : public FitnessSimple
+{
+
+public:
+
+	//! FitnessCaseErrors allocator type.
+	typedef AllocatorT<FitnessCaseErrors,FitnessSimple::Alloc> Alloc;
+	//! FitnessCaseErrors handle type.
+	typedef PointerT<FitnessCaseErrors,FitnessSimple::Handle> Handle;
+	//! FitnessCaseErrors bag type.
+	typedef ContainerT<FitnessCaseErrors,FitnessSimple::Bag> Bag;
+
+	FitnessCaseErrors() { }
+	FitnessCaseErrors(double inValue, const std::vector<double>& inErrors);
+	virtual ~FitnessCaseErrors()
+	{ }
+
+	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual const std::string&  getType() const;
+	virtual void                read(PACC::XML::ConstIterator inIter);
+	        void                setErrors(const std::vector<double>& inErrors);
+	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
+
+	/*!
+	 *  \brief Return the errors made on the fitness cases.
+	 *  \return Errors, one per fitness case.
+	 */
+	inline const std::vector<double>& getErrors() const
+	{
+		Beagle_StackTraceBeginM();
+		return mErrors;
+		Beagle_StackTraceEndM("const std::vector<double>& FitnessCaseErrors::getErrors() const");
+	}
+
+	/*!
+	 *  \return Number of fitness cases.
+	 */
+	inline unsigned int getNumberOfCases() const
+	{
+		Beagle_StackTraceBeginM();
+		return mErrors.size();
+		Beagle_StackTraceEndM("unsigned int FitnessCaseErrors::getNumberOfCases() const");
+	}
+
+protected:
+
+	std::vector<double> mErrors;  //!< Errors made on each fitness case.
+
+};
+
+}
+
+#endif // Beagle_FitnessCaseErrors_hpp
@@ -0,0 +1,50 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/src/FitnessDelta.cpp
+ *  \brief  Source code of class FitnessDelta.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:45 $
+ */
+
+#include "beagle/Beagle.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \return Name of the member, "FitnessDelta".
+ */
+const std::string& FitnessDelta::getName() const
+{
+	Beagle_StackTraceBeginM();
+	const static std::string lName("FitnessDelta");
+	return lName;
+	Beagle_StackTraceEndM("const std::string& FitnessDelta::getName() const");
+}
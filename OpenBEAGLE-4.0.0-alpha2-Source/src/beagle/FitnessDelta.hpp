@@ -0,0 +1,92 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/FitnessDelta.hpp
+ *  \brief  Definition of the class FitnessDelta.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:45 $
+ */
+
+#ifndef Beagle_FitnessDelta_hpp
+#define Beagle_FitnessDelta_hpp
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AbstractAllocT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Member.hpp"
+
+
+namespace Beagle
+{
+
+/*!
+ *  \class FitnessDelta beagle/FitnessDelta.hpp "beagle/FitnessDelta.hpp"
+ *  \brief Record of the changes made to the genotypes of an individual since its fitness
+ *    was last valid, used as member of the individual.
+ *  \ingroup ECF
+ *  \ingroup FitStats
+ *
+ *  A variation operator that can describe its changes adds a fitness delta to an individual
+ *  of valid fitness it modifies, so that an evaluation operator can update the former fitness
+ *  value from the changes instead of evaluating the individual from scratch. The fitness
+ *  delta is held under the member name "FitnessDelta".
+ *
+ *  A fitness delta must only describe changes made to an individual of valid fitness: the
+ *  mutation operators remove the fitness delta of an individual before mutating it, the
+ *  crossover operators remove it from the mated individuals, and the evaluation operators
+ *  remove it once the individual is evaluated. Operators modifying individuals otherwise
+ *  must do the same.
+ */
+class FitnessDelta : public Member
+{
+
+public:
+
+	//! FitnessDelta allocator type.
+	typedef AbstractAllocT<FitnessDelta,Member::Alloc> Alloc;
+	//! FitnessDelta handle type.
+	typedef PointerT<FitnessDelta,Member::Handle> Handle;
+	//! FitnessDelta bag type.
+	typedef ContainerT<FitnessDelta,Member::Bag> Bag;
+
+	FitnessDelta()
+	{ }
+	virtual ~FitnessDelta()
+	{ }
+
+	virtual const std::string& getName() const;
+
+};
+
+}
+
+#endif // Beagle_FitnessDelta_hpp
@@ -140,6 +140,30 @@ double FitnessMultiObj::getObjective(unsigned int inObjIndex) const
 }
 
 
+/*!
+ *  \brief Write the sort key of the fitness, which is the objective values.
+ *  \param outKey Array of getSortKeySize() values where the key is written.
+ */
+void FitnessMultiObj::getSortKey(double* outKey) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<size(); ++i) outKey[i] = (*this)[i];
+	Beagle_StackTraceEndM("void FitnessMultiObj::getSortKey(double*) const");
+}
+
+
+/*!
+ *  \brief  Get the number of values in the sort key of the fitness.
+ *  \return Size of the sort key, the number of objectives if the fitness is valid, 0 if not.
+ */
+unsigned int FitnessMultiObj::getSortKeySize() const
+{
+	Beagle_StackTraceBeginM();
+	return isValid() ? size() : 0;
+	Beagle_StackTraceEndM("unsigned int FitnessMultiObj::getSortKeySize() const");
+}
+
+
 /*!
  *  \brief Get exact type of the fitness.
  *  \return Exact type of the fitness.
@@ -118,6 +118,8 @@ public:
 	virtual double              getDistance(const Fitness& inRightFitness) const;
 	virtual unsigned int        getNumberOfObjectives() const;
 	virtual double              getObjective(unsigned int inObjIndex) const;
+	virtual void                getSortKey(double* outKey) const;
+	virtual unsigned int        getSortKeySize() const;
 	virtual const std::string&  getType() const;
 	virtual bool                isDominated(const Fitness& inRightFitness) const;
 	virtual bool                isEqual(const Object& inRightObj) const;
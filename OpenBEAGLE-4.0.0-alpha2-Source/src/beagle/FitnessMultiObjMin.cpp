@@ -71,6 +71,18 @@ void FitnessMultiObjMin::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Write the sort key of the fitness, which is the negated objective values.
+ *  \param outKey Array of getSortKeySize() values where the key is written.
+ */
+void FitnessMultiObjMin::getSortKey(double* outKey) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<size(); ++i) outKey[i] = -(*this)[i];
+	Beagle_StackTraceEndM("void FitnessMultiObjMin::getSortKey(double*) const");
+}
+
+
 /*!
  *  \brief Get exact type of the fitness.
  *  \return Exact type of the fitness.
@@ -75,6 +75,7 @@ public:
 	{ }
 
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual void                getSortKey(double* outKey) const;
 	virtual const std::string&  getType() const;
 	virtual bool                isDominated(const Fitness& inRightFitness) const;
 	virtual bool                isLess(const Object& inRightObj) const;
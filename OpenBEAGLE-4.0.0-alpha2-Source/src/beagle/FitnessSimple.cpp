@@ -131,6 +131,30 @@ double FitnessSimple::getObjective(unsigned int inObjIndex) const
 }
 
 
+/*!
+ *  \brief Write the sort key of the fitness, which is the fitness value.
+ *  \param outKey Array of one value where the key is written.
+ */
+void FitnessSimple::getSortKey(double* outKey) const
+{
+	Beagle_StackTraceBeginM();
+	outKey[0] = mValue;
+	Beagle_StackTraceEndM("void FitnessSimple::getSortKey(double*) const");
+}
+
+
+/*!
+ *  \brief  Get the number of values in the sort key of the fitness.
+ *  \return Size of the sort key, 1 if the fitness is valid, 0 if not.
+ */
+unsigned int FitnessSimple::getSortKeySize() const
+{
+	Beagle_StackTraceBeginM();
+	return isValid() ? 1 : 0;
+	Beagle_StackTraceEndM("unsigned int FitnessSimple::getSortKeySize() const");
+}
+
+
 /*!
  *  \brief Get exact type of the fitness.
  *  \return Exact type of the fitness.
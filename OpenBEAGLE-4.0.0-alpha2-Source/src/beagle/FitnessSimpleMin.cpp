@@ -69,6 +69,18 @@ void FitnessSimpleMin::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Write the sort key of the fitness, which is the negated fitness value.
+ *  \param outKey Array of one value where the key is written.
+ */
+void FitnessSimpleMin::getSortKey(double* outKey) const
+{
+	Beagle_StackTraceBeginM();
+	outKey[0] = -mValue;
+	Beagle_StackTraceEndM("void FitnessSimpleMin::getSortKey(double*) const");
+}
+
+
 /*!
  *  \brief Get exact type of the fitness.
  *  \return Exact type of the fitness.
@@ -68,7 +68,11 @@
 #include "beagle/GA/FloatVector.hpp"
 #include "beagle/GA/ESVector.hpp"
 #include "beagle/GA/IntegerVector.hpp"
+#include "beagle/GA/SequenceDelta.hpp"
 #include "beagle/GA/CMAHolder.hpp"
+#include "beagle/GA/PackedFloatVectors.hpp"
+#include "beagle/GA/PermutationBuffers.hpp"
+#include "beagle/GA/RecombinationBuffers.hpp"
 #include "beagle/GA/CrossoverBlendESVecOp.hpp"
 #include "beagle/GA/CrossoverBlendFltVecOp.hpp"
 #include "beagle/GA/CrossoverCycleOp.hpp"
@@ -122,6 +126,8 @@
 #include "beagle/GA/RecombinationESVecOp.hpp"
 #include "beagle/GA/RecombinationWeightedESVecOp.hpp"
 #include "beagle/GA/MuWCommaLambdaCMAFltVecOp.hpp"
+#include "beagle/GA/MuWCommaLambdaSepCMAFltVecOp.hpp"
+#include "beagle/GA/MuWCommaLambdaLMCMAFltVecOp.hpp"
 #include "beagle/GA/TermCMAOp.hpp"
 #include "beagle/GA/AdaptOneFifthRuleFltVecOp.hpp"
 #include "beagle/GA/AlgoCMAES.hpp"
@@ -50,6 +50,10 @@ GA::AlgoCMAES::AlgoCMAES(void) :
  *  \param ioEvolver Evolver modified by setting the algorithm.
  *  \param ioSystem Evolutionary system.
  *
+ *  The CMA-ES replacement strategy used is the type associated to the concept
+ *  'ReplacementStrategyOp' in the factory, the full covariance CMA-ES by default. The
+ *  separable and limited-memory variants for large dimensionalities can be selected by
+ *  associating GA-MuWCommaLambdaSepCMAFltVecOp or GA-MuWCommaLambdaLMCMAFltVecOp to it.
  */
 void GA::AlgoCMAES::configure(Evolver& ioEvolver, System& ioSystem)
 {
@@ -83,7 +87,7 @@ void GA::AlgoCMAES::configure(Evolver& ioEvolver, System& ioSystem)
 	std::string lMsWriteOpName = "MilestoneWriteOp";
 	MilestoneWriteOp::Alloc::Handle lMsWriteOpAlloc =
 	    castHandleT<MilestoneWriteOp::Alloc>(lFactory.getAllocator(lMsWriteOpName));
-	std::string lMCLOpName = "GA-MuWCommaLambdaCMAFltVecOp";
+	std::string lMCLOpName = lFactory.getConceptTypeName("ReplacementStrategyOp");
 	GA::MuWCommaLambdaCMAFltVecOp::Alloc::Handle lMCLOpAlloc =
 	    castHandleT<GA::MuWCommaLambdaCMAFltVecOp::Alloc>(lFactory.getAllocator(lMCLOpName));
 
@@ -46,8 +46,56 @@ using namespace Beagle;
  *  \param inModel Default values of the bits.
  */
 GA::BitString::BitString(unsigned int inSize, bool inModel) :
-		std::vector<bool>(inSize, inModel)
-{ }
+		mWords((inSize+eWordBits-1)/eWordBits, inModel ? ~Word(0) : Word(0)),
+		mSize(inSize)
+{
+	trimLastWord();
+}
+
+
+/*!
+ *  \brief Copy GA bitstring into current.
+ *  \param inOriginal Bitstring to copy.
+ *  \param ioSystem Evolutionary system to use for making the copy.
+ */
+void GA::BitString::copy(const Member& inOriginal, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	const GA::BitString& lOriginal = castObjectT<const GA::BitString&>(inOriginal);
+	(*this) = lOriginal;
+	Beagle_StackTraceEndM("void GA::BitString::copy(const Member&,System&)");
+}
+
+
+/*!
+ *  \brief Compute the hash value of the bit string from its content.
+ *  \return Hash value of the bit string.
+ */
+unsigned int GA::BitString::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lHash = combineHash(0U, mSize);
+	for(unsigned int i=0; i<mWords.size(); ++i) {
+		lHash = combineHash(lHash, (unsigned int)(mWords[i] & 0xFFFFFFFFULL));
+		lHash = combineHash(lHash, (unsigned int)(mWords[i] >> 32));
+	}
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GA::BitString::computeHash() const");
+}
+
+
+/*!
+ *  \brief Count the number of bits set in the bit string.
+ *  \return Number of bits set.
+ */
+unsigned int GA::BitString::count() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lCount = 0;
+	for(unsigned int i=0; i<mWords.size(); ++i) lCount += countBits(mWords[i]);
+	return lCount;
+	Beagle_StackTraceEndM("unsigned int GA::BitString::count() const");
+}
 
 
 /*!
@@ -55,56 +103,20 @@ GA::BitString::BitString(unsigned int inSize, bool inModel) :
  *  \param inKeys Decoding keys.
  *  \param inBitString Binary bit string to decode.
  *  \param outVector Floating-point number vector resulting from decoding.
+ *
+ *  Kept for compatibility, the bits are packed into a bit string and decoded with decode().
  */
 void GA::BitString::convertBin2Dec(const GA::BitString::DecodingKeyVector& inKeys,
                                    const std::vector<bool>& inBitString,
                                    std::vector<double>& outVector)
 {
 	Beagle_StackTraceBeginM();
-#ifdef BEAGLE_HAVE_LONG_LONG
-	typedef unsigned long long EncodingType;
-#else // BEAGLE_HAVE_LONG_LONG
-	typedef unsigned long EncodingType;
-#endif // BEAGLE_HAVE_LONG_LONG
-
-#ifndef BEAGLE_NDEBUG
-	for(unsigned int i=0; i<inKeys.size(); i++) {
-		if(inKeys[i].mLowerBound >= inKeys[i].mUpperBound) {
-			std::ostringstream lOSS;
-			lOSS << "In GA::BitString::convertBin2Dec(): ";
-			lOSS <<  "the lower bound value of the " <<  uint2ordinal(i+1);
-			lOSS <<  " key (" <<  inKeys[i].mLowerBound;
-			lOSS <<  ") is bigger or equal to the associated upper bound (";
-			lOSS <<  inKeys[i].mUpperBound <<  ")!";
-			throw Beagle_RunTimeExceptionM(lOSS.str());
-		}
-		if((inKeys[i].mEncoding < 1) || (inKeys[i].mEncoding >= 8*sizeof(EncodingType))) {
-			std::ostringstream lOSS;
-			lOSS <<  "In GA::BitString::convertBin2Dec(): the ";
-			lOSS <<  uint2ordinal(i+1) << " encoding value (" << inKeys[i].mEncoding;
-			lOSS <<  ") is not in the valid interval (which is [1,";
-			lOSS <<  (8*sizeof(EncodingType))-1 << "])!";
-			throw Beagle_RunTimeExceptionM(lOSS.str());
-		}
-	}
-#endif // BEAGLE_NDEBUG
-
-	outVector.resize(inKeys.size());
-	std::vector<bool>::const_iterator lBit = inBitString.begin();
-	for(unsigned int j=0; j<inKeys.size(); j++) {
-		EncodingType lGene=0;
-		for(unsigned int k=0; k<inKeys[j].mEncoding; ++k) {
-			lGene <<= 1;
-			lGene |= ((*lBit++) ? 1 : 0);
-		}
-		EncodingType lDiv = ~0;
-		lDiv <<= inKeys[j].mEncoding;
-		lDiv = ~lDiv;
-		double lTempVal = double(lGene) / double(lDiv);
-		outVector[j] =
-		    inKeys[j].mLowerBound + (lTempVal * (inKeys[j].mUpperBound - inKeys[j].mLowerBound));
+	GA::BitString lBitString(inBitString.size());
+	for(unsigned int i=0; i<inBitString.size(); ++i) {
+		if(inBitString[i]) lBitString[i] = true;
 	}
-	Beagle_StackTraceEndM("void GA::BitString::convertBin2Dec(const std::vector<GA::BitString::DecodingKey>& inKeys, const std::vector<bool>& inBitString, std::vector<double>& outVector) const");
+	lBitString.decodeWords(inKeys, false, outVector);
+	Beagle_StackTraceEndM("void GA::BitString::convertBin2Dec(const std::vector<GA::BitString::DecodingKey>& inKeys, const std::vector<bool>& inBitString, std::vector<double>& outVector)");
 }
 
 
@@ -129,21 +141,7 @@ void GA::BitString::convertGray2Bin(const GA::BitString::DecodingKeyVector& inKe
 			++lPosBS;
 		}
 	}
-	Beagle_StackTraceEndM("void GA::BitString::convertGray2Bin(const std::vector<GA::BitString::DecodingKey>& inKeys, const std::vector<bool>& inGrayBitString, std::vector<bool>& outBinBitString) const");
-}
-
-
-/*!
- *  \brief Copy GA bitstring into current.
- *  \param inOriginal Bitstring to copy.
- *  \param ioSystem Evolutionary system to use for making the copy.
- */
-void GA::BitString::copy(const Member& inOriginal, System& ioSystem)
-{
-	Beagle_StackTraceBeginM();
-	const GA::BitString& lOriginal = castObjectT<const GA::BitString&>(inOriginal);
-	(*this) = lOriginal;
-	Beagle_StackTraceEndM("void GA::BitString::copy(const Member&,System&)");
+	Beagle_StackTraceEndM("void GA::BitString::convertGray2Bin(const std::vector<GA::BitString::DecodingKey>& inKeys, const std::vector<bool>& inGrayBitString, std::vector<bool>& outBinBitString)");
 }
 
 
@@ -156,23 +154,7 @@ void GA::BitString::decode(const GA::BitString::DecodingKeyVector& inKeys,
                            std::vector<double>& outVector) const
 {
 	Beagle_StackTraceBeginM();
-#ifndef BEAGLE_NDEBUG
-	unsigned int lNbBits = 0;
-	for(unsigned int i=0; i<inKeys.size(); i++) lNbBits += inKeys[i].mEncoding;
-
-	if(lNbBits != size()) {
-		std::ostringstream lOSS;
-		lOSS << "In GA::BitString::decode(): ";
-		lOSS <<  "The total number of bits specified by the encoding keys (";
-		lOSS <<  lNbBits;
-		lOSS <<  ") is different from the number of bits of the genotype string (";
-		lOSS <<  size();
-		lOSS <<  ") !";
-		throw Beagle_RunTimeExceptionM(lOSS.str());
-	}
-#endif // BEAGLE_NDEBUG
-
-	convertBin2Dec(inKeys, (*this), outVector);
+	decodeWords(inKeys, false, outVector);
 	Beagle_StackTraceEndM("void GA::BitString::decode(const std::vector<GA::BitString::DecodingKey>&,std::vector<double>&) const");
 }
 
@@ -184,15 +166,53 @@ void GA::BitString::decode(const GA::BitString::DecodingKeyVector& inKeys,
  */
 void GA::BitString::decodeGray(const GA::BitString::DecodingKeyVector& inKeys,
                                std::vector<double>& outVector) const
+{
+	Beagle_StackTraceBeginM();
+	decodeWords(inKeys, true, outVector);
+	Beagle_StackTraceEndM("void GA::BitString::decodeGray(const std::vector<GA::BitString::DecodingKey>& inKeys, std::vector<double>& outVector) const");
+}
+
+
+/*!
+ *  \brief Decode the bit string into a vector of floating-point numbers with keys.
+ *  \param inKeys Decoding keys.
+ *  \param inGrayCoded Whether the values are gray-coded.
+ *  \param outVector Floating-point number vector resulting from decoding.
+ *
+ *  The bits of each value are extracted at once from the words of the string, the first
+ *  bit of a value being its most significant one. Gray-coded values are converted to
+ *  binary with a prefix exclusive-or over the extracted bits.
+ */
+void GA::BitString::decodeWords(const GA::BitString::DecodingKeyVector& inKeys,
+                                bool inGrayCoded,
+                                std::vector<double>& outVector) const
 {
 	Beagle_StackTraceBeginM();
 #ifndef BEAGLE_NDEBUG
 	unsigned int lNbBits = 0;
-	for(unsigned int i=0; i<inKeys.size(); i++) lNbBits += inKeys[i].mEncoding;
-
+	for(unsigned int i=0; i<inKeys.size(); i++) {
+		if(inKeys[i].mLowerBound >= inKeys[i].mUpperBound) {
+			std::ostringstream lOSS;
+			lOSS << "In GA::BitString::decode(): ";
+			lOSS <<  "the lower bound value of the " <<  uint2ordinal(i+1);
+			lOSS <<  " key (" <<  inKeys[i].mLowerBound;
+			lOSS <<  ") is bigger or equal to the associated upper bound (";
+			lOSS <<  inKeys[i].mUpperBound <<  ")!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+		if((inKeys[i].mEncoding < 1) || (inKeys[i].mEncoding >= eWordBits)) {
+			std::ostringstream lOSS;
+			lOSS <<  "In GA::BitString::decode(): the ";
+			lOSS <<  uint2ordinal(i+1) << " encoding value (" << inKeys[i].mEncoding;
+			lOSS <<  ") is not in the valid interval (which is [1,";
+			lOSS <<  (eWordBits-1) << "])!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+		lNbBits += inKeys[i].mEncoding;
+	}
 	if(lNbBits != size()) {
 		std::ostringstream lOSS;
-		lOSS << "In GA::BitString::decodeGray(): ";
+		lOSS << "In GA::BitString::decode(): ";
 		lOSS <<  "the total number of bits specified by the encoding keys (";
 		lOSS <<  lNbBits;
 		lOSS <<  ") is different from the number of bits of the genotype string (";
@@ -202,10 +222,67 @@ void GA::BitString::decodeGray(const GA::BitString::DecodingKeyVector& inKeys,
 	}
 #endif // BEAGLE_NDEBUG
 
-	std::vector<bool> lBinBitString;
-	convertGray2Bin(inKeys, (*this), lBinBitString);
-	convertBin2Dec(inKeys, lBinBitString, outVector);
-	Beagle_StackTraceEndM("void GA::BitString::decodeGray(const std::vector<GA::BitString::DecodingKey>& inKeys, std::vector<double>& outVector) const");
+	outVector.resize(inKeys.size());
+	unsigned int lPosBS = 0;
+	for(unsigned int j=0; j<inKeys.size(); j++) {
+		Word lGene = extractBits(lPosBS, inKeys[j].mEncoding);
+		lPosBS += inKeys[j].mEncoding;
+		if(inGrayCoded) {
+			lGene ^= (lGene >> 1);
+			lGene ^= (lGene >> 2);
+			lGene ^= (lGene >> 4);
+			lGene ^= (lGene >> 8);
+			lGene ^= (lGene >> 16);
+			lGene ^= (lGene >> 32);
+		}
+		const Word lDiv = (Word(1) << inKeys[j].mEncoding) - 1;
+		double lTempVal = double(lGene) / double(lDiv);
+		outVector[j] =
+		    inKeys[j].mLowerBound + (lTempVal * (inKeys[j].mUpperBound - inKeys[j].mLowerBound));
+	}
+	Beagle_StackTraceEndM("void GA::BitString::decodeWords(const std::vector<GA::BitString::DecodingKey>&,bool,std::vector<double>&) const");
+}
+
+
+/*!
+ *  \brief Extract a number encoded by consecutive bits of the bit string.
+ *  \param inBegin Index of the first bit of the number, its most significant bit.
+ *  \param inNumberBits Number of bits of the number, in [1,63].
+ *  \return Number extracted.
+ */
+GA::BitString::Word GA::BitString::extractBits(unsigned int inBegin, unsigned int inNumberBits) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM((inNumberBits > 0) && (inNumberBits < eWordBits));
+	Beagle_UpperBoundCheckAssertM(inBegin+inNumberBits, mSize);
+	const unsigned int lWord = inBegin / eWordBits;
+	const unsigned int lOffset = inBegin % eWordBits;
+	Word lBits = mWords[lWord] >> lOffset;
+	if((lOffset+inNumberBits) > eWordBits) lBits |= mWords[lWord+1] << (eWordBits-lOffset);
+	// Reverse the bits, the first bit of the string being the most significant.
+	lBits = ((lBits >> 1) & 0x5555555555555555ULL) | ((lBits & 0x5555555555555555ULL) << 1);
+	lBits = ((lBits >> 2) & 0x3333333333333333ULL) | ((lBits & 0x3333333333333333ULL) << 2);
+	lBits = ((lBits >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((lBits & 0x0F0F0F0F0F0F0F0FULL) << 4);
+	lBits = ((lBits >> 8) & 0x00FF00FF00FF00FFULL) | ((lBits & 0x00FF00FF00FF00FFULL) << 8);
+	lBits = ((lBits >> 16) & 0x0000FFFF0000FFFFULL) | ((lBits & 0x0000FFFF0000FFFFULL) << 16);
+	lBits = (lBits >> 32) | (lBits << 32);
+	return lBits >> (eWordBits-inNumberBits);
+	Beagle_StackTraceEndM("GA::BitString::Word GA::BitString::extractBits(unsigned int,unsigned int) const");
+}
+
+
+/*!
+ *  \brief Flip the bits set in a mask.
+ *  \param inMask Mask of the bits to flip, by words of the bit string. Bits of the mask
+ *    past the end of the string are ignored.
+ */
+void GA::BitString::flipMasked(const std::vector<Word>& inMask)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbWords = minOf<unsigned int>(mWords.size(), inMask.size());
+	for(unsigned int i=0; i<lNbWords; ++i) mWords[i] ^= inMask[i];
+	trimLastWord();
+	Beagle_StackTraceEndM("void GA::BitString::flipMasked(const std::vector<GA::BitString::Word>&)");
 }
 
 
@@ -234,6 +311,24 @@ const std::string& GA::BitString::getType() const
 }
 
 
+/*!
+ *  \brief Resize the bit string.
+ *  \param inSize New size of the bit string.
+ *  \param inModel Value of the bits added.
+ */
+void GA::BitString::resize(unsigned int inSize, bool inModel)
+{
+	Beagle_StackTraceBeginM();
+	if(inModel && (inSize > mSize) && ((mSize%eWordBits) != 0)) {
+		mWords.back() |= ~((Word(1) << (mSize%eWordBits)) - 1);
+	}
+	mWords.resize((inSize+eWordBits-1)/eWordBits, inModel ? ~Word(0) : Word(0));
+	mSize = inSize;
+	trimLastWord();
+	Beagle_StackTraceEndM("void GA::BitString::resize(unsigned int,bool)");
+}
+
+
 /*!
  *  \brief Swap the gene at inI with the gene at inJ.
  *	\param inI is the index of the first gene to swap.
@@ -244,11 +339,61 @@ void GA::BitString::swap(unsigned int inI, unsigned int inJ)
 	Beagle_StackTraceBeginM();
 	Beagle_BoundCheckAssertM(inI, 0, size() -1);
 	Beagle_BoundCheckAssertM(inJ, 0, size() -1);
-	this->swap((*this)[inI], (*this)[inJ]);
+	const bool lTemp = (*this)[inI];
+	(*this)[inI] = (*this)[inJ];
+	(*this)[inJ] = lTemp;
 	Beagle_StackTraceEndM("const std::string& GA::BitString::swap(unsigned int, unsigned int)")
 }
 
 
+/*!
+ *  \brief Exchange with another bit string the bits set in a mask.
+ *  \param ioBitString Bit string to exchange bits with.
+ *  \param inMask Mask of the bits to exchange, by words of the bit strings. Bits of the
+ *    mask past the end of the shortest string are ignored.
+ */
+void GA::BitString::swapMasked(GA::BitString& ioBitString, const std::vector<Word>& inMask)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lNbBits = minOf<unsigned int>(mSize, ioBitString.mSize);
+	const unsigned int lNbWords =
+	    minOf<unsigned int>((lNbBits+eWordBits-1)/eWordBits, inMask.size());
+	for(unsigned int i=0; i<lNbWords; ++i) {
+		Word lMask = inMask[i];
+		if(((i+1)*eWordBits) > lNbBits) lMask &= ((Word(1) << (lNbBits%eWordBits)) - 1);
+		const Word lDiff = (mWords[i] ^ ioBitString.mWords[i]) & lMask;
+		mWords[i] ^= lDiff;
+		ioBitString.mWords[i] ^= lDiff;
+	}
+	Beagle_StackTraceEndM("void GA::BitString::swapMasked(GA::BitString&,const std::vector<GA::BitString::Word>&)");
+}
+
+
+/*!
+ *  \brief Exchange a range of bits with another bit string.
+ *  \param ioBitString Bit string to exchange bits with.
+ *  \param inBegin Index of the first bit exchanged.
+ *  \param inEnd Index following the last bit exchanged, not above the size of the strings.
+ */
+void GA::BitString::swapRange(GA::BitString& ioBitString, unsigned int inBegin, unsigned int inEnd)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_UpperBoundCheckAssertM(inEnd, minOf<unsigned int>(mSize, ioBitString.mSize));
+	if(inBegin >= inEnd) return;
+	const unsigned int lFirstWord = inBegin / eWordBits;
+	const unsigned int lLastWord = (inEnd-1) / eWordBits;
+	for(unsigned int i=lFirstWord; i<=lLastWord; ++i) {
+		Word lMask = ~Word(0);
+		if(i == lFirstWord) lMask &= ~((Word(1) << (inBegin%eWordBits)) - 1);
+		if((i == lLastWord) && ((inEnd%eWordBits) != 0)) lMask &= ((Word(1) << (inEnd%eWordBits)) - 1);
+		const Word lDiff = (mWords[i] ^ ioBitString.mWords[i]) & lMask;
+		mWords[i] ^= lDiff;
+		ioBitString.mWords[i] ^= lDiff;
+	}
+	Beagle_StackTraceEndM("void GA::BitString::swapRange(GA::BitString&,unsigned int,unsigned int)");
+}
+
+
 /*!
  *  \brief  Test if two bit strings are equals.
  *  \param  inRightObj Second bit string used for the comparison.
@@ -259,7 +404,7 @@ bool GA::BitString::isEqual(const Object& inRightObj) const
 	Beagle_StackTraceBeginM();
 	const GA::BitString& lRightBS = castObjectT<const GA::BitString&>(inRightObj);
 	if(size() != lRightBS.size()) return false;
-	return std::equal(begin(), end(), lRightBS.begin());
+	return mWords == lRightBS.mWords;
 	Beagle_StackTraceEndM("bool GA::BitString::isEqual(const Object& inRightObj) const");
 }
 
@@ -277,9 +422,18 @@ bool GA::BitString::isLess(const Object& inRightObj) const
 {
 	Beagle_StackTraceBeginM();
 	const GA::BitString& lRightBS = castObjectT<const GA::BitString&>(inRightObj);
-	unsigned int lSizeCompared = minOf<unsigned int>(size(),lRightBS.size());
-	return std::lexicographical_compare(begin(), begin()+lSizeCompared,
-	                                    lRightBS.begin(), lRightBS.begin()+lSizeCompared);
+	const unsigned int lSizeCompared = minOf<unsigned int>(size(),lRightBS.size());
+	const unsigned int lNbWords = (lSizeCompared+eWordBits-1)/eWordBits;
+	for(unsigned int i=0; i<lNbWords; ++i) {
+		Word lDiff = mWords[i] ^ lRightBS.mWords[i];
+		if(((i+1)*eWordBits) > lSizeCompared) lDiff &= ((Word(1) << (lSizeCompared%eWordBits)) - 1);
+		if(lDiff != 0) {
+			// The first different bit decides, the string with a zero being the lesser.
+			const Word lFirstDiff = lDiff & (~lDiff + 1);
+			return (mWords[i] & lFirstDiff) == 0;
+		}
+	}
+	return false;
 	Beagle_StackTraceEndM("bool GA::BitString::isLess(const Object& inRightObj) const");
 }
 
@@ -333,8 +487,10 @@ void GA::BitString::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent)
 {
 	Beagle_StackTraceBeginM();
 	ioStreamer.insertAttribute("size", uint2str(size()));
-	std::ostringstream lOSS;
-	for(unsigned int i=0; i<size(); i++) lOSS << ((*this)[i] ? '1' : '0');
-	ioStreamer.insertStringContent(lOSS.str());
+	std::string lBits(mSize, '0');
+	for(unsigned int i=0; i<mSize; i++) {
+		if((mWords[i/eWordBits] >> (i%eWordBits)) & 1) lBits[i] = '1';
+	}
+	ioStreamer.insertStringContent(lBits);
 	Beagle_StackTraceEndM("void GA::BitString::write(PACC::XML::Streamer&,bool) const");
 }
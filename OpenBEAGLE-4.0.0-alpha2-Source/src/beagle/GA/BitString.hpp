@@ -44,6 +44,8 @@
 
 #include <vector>
 
+#include "stdint.h"
+
 #include "beagle/config.hpp"
 #include "beagle/macros.hpp"
 #include "beagle/Object.hpp"
@@ -64,12 +66,74 @@ namespace GA
  *  \brief Bit string GA genotype class.
  *  \ingroup GAF
  *  \ingroup GABS
+ *
+ *  The bits are packed into 64-bit words, the ith bit of the string being the bit of
+ *  weight 2^(i%64) of the (i/64)th word. The bits of the last word past the end of the
+ *  string are always zero. The bits can be accessed one at a time, as with a
+ *  std::vector<bool>, or a word at a time with getWord and the word-level operations.
  */
-class BitString : public Genotype, public std::vector<bool>
+class BitString : public Genotype
 {
 
 public:
 
+	//! Storage word of the bits.
+	typedef uint64_t Word;
+
+	//! Value type of the bits.
+	typedef bool value_type;
+
+	//! Number of bits in a word.
+	enum { eWordBits=64 };
+
+	/*!
+	 *  \brief Reference to a bit of a bit string.
+	 */
+	class reference
+	{
+	public:
+
+		/*!
+		 *  \brief Construct a reference to a bit.
+		 *  \param inWord Word containing the bit.
+		 *  \param inMask Mask of the bit in the word.
+		 */
+		reference(Word* inWord, Word inMask) :
+				mWord(inWord),
+				mMask(inMask)
+		{ }
+
+		//! Return the value of the bit.
+		inline operator bool() const
+		{
+			return ((*mWord) & mMask) != 0;
+		}
+
+		//! Set the value of the bit.
+		inline reference& operator=(bool inValue)
+		{
+			if(inValue) (*mWord) |= mMask;
+			else (*mWord) &= ~mMask;
+			return *this;
+		}
+
+		//! Set the value of the bit to the value of another bit.
+		inline reference& operator=(const reference& inBit)
+		{
+			return (*this) = bool(inBit);
+		}
+
+		//! Flip the value of the bit.
+		inline void flip()
+		{
+			(*mWord) ^= mMask;
+		}
+
+	private:
+		Word* mWord;  //!< Word containing the bit.
+		Word  mMask;  //!< Mask of the bit in the word.
+	};
+
 	/*!
 	 *  \struct DecodingKey beagle/GA/BitString.hpp "beagle/GA/BitString.hpp"
 	 *  \brief Decoding key to tranform a bit string genotype into a vector of numbers.
@@ -108,16 +172,129 @@ public:
 	explicit BitString(unsigned int inSize=0, bool inModel=false);
 
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual unsigned int        computeHash() const;
+	unsigned int                count() const;
 	void                        decode(const DecodingKeyVector& inKeys, std::vector<double>& outVector) const;
 	void                        decodeGray(const DecodingKeyVector& inKeys, std::vector<double>& outVector) const;
+	void                        flipMasked(const std::vector<Word>& inMask);
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
-	virtual void				swap(unsigned int inI, unsigned int inJ);
+	void                        resize(unsigned int inSize, bool inModel=false);
+	virtual void                swap(unsigned int inI, unsigned int inJ);
+	void                        swapMasked(BitString& ioBitString, const std::vector<Word>& inMask);
+	void                        swapRange(BitString& ioBitString, unsigned int inBegin, unsigned int inEnd);
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual bool                isLess(const Object& inRightObj) const;
 	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Return a reference to a bit.
+	 *  \param inIndex Index of the bit.
+	 *  \return Reference to the bit.
+	 */
+	inline reference operator[](unsigned int inIndex)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex, mSize-1);
+		return reference(&mWords[inIndex/eWordBits], Word(1) << (inIndex%eWordBits));
+		Beagle_StackTraceEndM("GA::BitString::reference GA::BitString::operator[](unsigned int)");
+	}
+
+	/*!
+	 *  \brief Return the value of a bit.
+	 *  \param inIndex Index of the bit.
+	 *  \return Value of the bit.
+	 */
+	inline bool operator[](unsigned int inIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex, mSize-1);
+		return ((mWords[inIndex/eWordBits] >> (inIndex%eWordBits)) & 1) != 0;
+		Beagle_StackTraceEndM("bool GA::BitString::operator[](unsigned int) const");
+	}
+
+	/*!
+	 *  \brief Remove all the bits of the bit string.
+	 */
+	inline void clear()
+	{
+		Beagle_StackTraceBeginM();
+		mWords.clear();
+		mSize = 0;
+		Beagle_StackTraceEndM("void GA::BitString::clear()");
+	}
+
+	/*!
+	 *  \return True if the bit string has no bit.
+	 */
+	inline bool empty() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSize == 0;
+		Beagle_StackTraceEndM("bool GA::BitString::empty() const");
+	}
+
+	/*!
+	 *  \brief Return the number of words storing the bits.
+	 *  \return Number of words.
+	 */
+	inline unsigned int getNumberWords() const
+	{
+		Beagle_StackTraceBeginM();
+		return mWords.size();
+		Beagle_StackTraceEndM("unsigned int GA::BitString::getNumberWords() const");
+	}
+
+	/*!
+	 *  \brief Return a word of the bit string.
+	 *  \param inIndex Index of the word, the word holding the bits inIndex*64 to inIndex*64+63.
+	 *  \return Word, with the bits past the end of the string set to zero.
+	 */
+	inline Word getWord(unsigned int inIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inIndex, mWords.size()-1);
+		return mWords[inIndex];
+		Beagle_StackTraceEndM("GA::BitString::Word GA::BitString::getWord(unsigned int) const");
+	}
+
+	/*!
+	 *  \brief Append a bit at the end of the bit string.
+	 *  \param inValue Value of the bit.
+	 */
+	inline void push_back(bool inValue)
+	{
+		Beagle_StackTraceBeginM();
+		if((mSize%eWordBits) == 0) mWords.push_back(0);
+		if(inValue) mWords.back() |= (Word(1) << (mSize%eWordBits));
+		++mSize;
+		Beagle_StackTraceEndM("void GA::BitString::push_back(bool)");
+	}
+
+	/*!
+	 *  \return Number of bits of the bit string.
+	 */
+	inline unsigned int size() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSize;
+		Beagle_StackTraceEndM("unsigned int GA::BitString::size() const");
+	}
+
+	/*!
+	 *  \brief Count the number of bits set in a word.
+	 *  \param inWord Word to count bits of.
+	 *  \return Number of bits set.
+	 */
+	static inline unsigned int countBits(Word inWord)
+	{
+		inWord = inWord - ((inWord >> 1) & 0x5555555555555555ULL);
+		inWord = (inWord & 0x3333333333333333ULL) + ((inWord >> 2) & 0x3333333333333333ULL);
+		inWord = (inWord + (inWord >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (unsigned int)((inWord * 0x0101010101010101ULL) >> 56);
+	}
+
 protected:
 
 	static void convertBin2Dec(const DecodingKeyVector& inKeys,
@@ -127,6 +304,20 @@ protected:
 	                            const std::vector<bool>& inGrayBitString,
 	                            std::vector<bool>& outBinBitString);
 
+	Word extractBits(unsigned int inBegin, unsigned int inNumberBits) const;
+	void decodeWords(const DecodingKeyVector& inKeys, bool inGrayCoded, std::vector<double>& outVector) const;
+
+	/*!
+	 *  \brief Set to zero the bits of the last word past the end of the string.
+	 */
+	inline void trimLastWord()
+	{
+		if((mSize%eWordBits) != 0) mWords.back() &= ((Word(1) << (mSize%eWordBits)) - 1);
+	}
+
+	std::vector<Word> mWords;  //!< Words storing the bits.
+	unsigned int      mSize;   //!< Number of bits of the bit string.
+
 };
 
 }
@@ -35,9 +35,96 @@
 
 #include "beagle/GA.hpp"
 
+#include <cmath>
 
 using namespace Beagle;
 
+namespace
+{
+
+//! Size of the square blocks of the matrix products, chosen so that three blocks fit in cache.
+const unsigned int gBlockSize = 64;
+
+/*!
+ *  \brief Add the product A*B of two row-major matrices to matrix C.
+ *  \param ioC MxN matrix to which the product is added.
+ *  \param inA Left MxK matrix.
+ *  \param inB Right KxN matrix.
+ *  \param inM Number of rows of A and C.
+ *  \param inN Number of columns of B and C.
+ *  \param inK Number of columns of A and rows of B.
+ *
+ *  The product is computed by blocks, with the innermost loop running along contiguous
+ *  rows of B and C so that it can be vectorized.
+ */
+void multiplyAdd(double* ioC, const double* inA, const double* inB,
+                 unsigned int inM, unsigned int inN, unsigned int inK)
+{
+	for(unsigned int lI0=0; lI0<inM; lI0+=gBlockSize) {
+		const unsigned int lI1 = minOf(lI0+gBlockSize, inM);
+		for(unsigned int lK0=0; lK0<inK; lK0+=gBlockSize) {
+			const unsigned int lK1 = minOf(lK0+gBlockSize, inK);
+			for(unsigned int lJ0=0; lJ0<inN; lJ0+=gBlockSize) {
+				const unsigned int lJ1 = minOf(lJ0+gBlockSize, inN);
+				for(unsigned int i=lI0; i<lI1; ++i) {
+					double* lRowC = ioC + (i*inN);
+					for(unsigned int k=lK0; k<lK1; ++k) {
+						const double lA = inA[(i*inK)+k];
+						const double* lRowB = inB + (k*inN);
+						for(unsigned int j=lJ0; j<lJ1; ++j) lRowC[j] += lA * lRowB[j];
+					}
+				}
+			}
+		}
+	}
+}
+
+
+/*!
+ *  \brief Add the weighted sum of outer products of the rows of Y to symmetric matrix C.
+ *  \param ioC NxN symmetric matrix, of which only the upper triangle is updated.
+ *  \param inY Row-major matrix of the vectors y_i, one per row.
+ *  \param inWeights Weights w_i of the vectors, or NULL for unit weights.
+ *  \param inNbRows Number of rows of Y.
+ *  \param inN Size of the vectors.
+ *  \param inFactor Factor applied to the sum.
+ *
+ *  C += inFactor * sum_i w_i y_i y_i^T, that is C += inFactor * Y^T W Y, computed by blocks
+ *  of C on or above the diagonal.
+ */
+void addWeightedGram(double* ioC, const double* inY, const double* inWeights,
+                     unsigned int inNbRows, unsigned int inN, double inFactor)
+{
+	for(unsigned int lA0=0; lA0<inN; lA0+=gBlockSize) {
+		const unsigned int lA1 = minOf(lA0+gBlockSize, inN);
+		for(unsigned int lB0=lA0; lB0<inN; lB0+=gBlockSize) {
+			const unsigned int lB1 = minOf(lB0+gBlockSize, inN);
+			for(unsigned int i=0; i<inNbRows; ++i) {
+				const double* lRowY = inY + (i*inN);
+				const double lW = (inWeights==NULL) ? inFactor : (inFactor*inWeights[i]);
+				for(unsigned int a=lA0; a<lA1; ++a) {
+					const double lS = lW * lRowY[a];
+					double* lRowC = ioC + (a*inN);
+					for(unsigned int b=lB0; b<lB1; ++b) lRowC[b] += lS * lRowY[b];
+				}
+			}
+		}
+	}
+}
+
+
+/*!
+ *  \brief Copy the upper triangle of a row-major square matrix into its lower triangle.
+ */
+void mirrorUpperTriangle(double* ioC, unsigned int inN)
+{
+	for(unsigned int i=1; i<inN; ++i) {
+		for(unsigned int j=0; j<i; ++j) ioC[(i*inN)+j] = ioC[(j*inN)+i];
+	}
+}
+
+}
+
 
 /*!
  *  \brief Construct CMA value holder system component, which contain global CMA values.
@@ -64,6 +151,13 @@ void GA::CMAHolder::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSy
 			if(lIndexStr.empty()) throw Beagle_IOExceptionNodeM(*lChild, "attribute 'index' expected!");
 			unsigned int lIndex = str2uint(lIndexStr);
 			GA::CMAValues& lValues = (*this)[lIndex];
+			const std::string lModelStr = lChild->getAttribute("model");
+			if(lModelStr.empty() || (lModelStr=="full")) lValues.mModel = GA::CMAValues::eFullModel;
+			else if(lModelStr=="separable") lValues.mModel = GA::CMAValues::eSeparableModel;
+			else if(lModelStr=="limited-memory") lValues.mModel = GA::CMAValues::eLimitedMemoryModel;
+			else throw Beagle_IOExceptionNodeM(*lChild, std::string("unknown CMA values model '")+lModelStr+"'!");
+			lValues.mDirections.clear();
+			lValues.mDirectionGens.clear();
 			for(PACC::XML::ConstIterator lChild2=lChild->getFirstChild(); lChild2; ++lChild2) {
 				if(lChild2->getType()!=PACC::XML::eData) continue;
 				if(lChild2->getFirstChild() == NULL)
@@ -74,7 +168,27 @@ void GA::CMAHolder::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSy
 				else if(lChild2->getValue()=="PS") lValues.mPS.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="Xmean") lValues.mXmean.read(lChild2->getFirstChild());
 				else if(lChild2->getValue()=="Sigma") lValues.mSigma.read(lChild2->getFirstChild());
+				else if(lChild2->getValue()=="RankOneRate") {
+					Double lRate;
+					lRate.read(lChild2->getFirstChild());
+					lValues.mRankOneRate = lRate.getWrappedValue();
+				} else if(lChild2->getValue()=="Directions") {
+					Matrix lDirections;
+					lDirections.read(lChild2->getFirstChild());
+					for(unsigned int i=0; i<lDirections.getRows(); ++i) {
+						for(unsigned int j=0; j<lDirections.getCols(); ++j) {
+							lValues.mDirections.push_back(lDirections(i,j));
+						}
+					}
+				} else if(lChild2->getValue()=="DirectionGens") {
+					UIntArray lGens;
+					lGens.read(lChild2->getFirstChild());
+					lValues.mDirectionGens.assign(lGens.begin(), lGens.end());
+				}
 			}
+			if(lValues.mDirections.size() != (lValues.mDirectionGens.size()*lValues.mXmean.size()))
+				throw Beagle_IOExceptionNodeM(*lChild, "directions of the CMA values are inconsistent!");
+			lValues.clearBuffers();
 		}
 	}
 	Beagle_StackTraceEndM("void GA::CMAHolder::readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem)");
@@ -90,8 +204,13 @@ void GA::CMAHolder::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent)
 {
 	Beagle_StackTraceBeginM();
 	for(GA::CMAHolder::const_iterator lIterMap=begin(); lIterMap!=end(); ++lIterMap) {
+		const GA::CMAValues& lValues = lIterMap->second;
 		ioStreamer.openTag("CMAValues", inIndent);
 		ioStreamer.insertAttribute("index", uint2str(lIterMap->first));
+		if(lValues.mModel == GA::CMAValues::eSeparableModel)
+			ioStreamer.insertAttribute("model", "separable");
+		else if(lValues.mModel == GA::CMAValues::eLimitedMemoryModel)
+			ioStreamer.insertAttribute("model", "limited-memory");
 		ioStreamer.openTag("B", inIndent);
 		lIterMap->second.mB.write(ioStreamer, inIndent);
 		ioStreamer.closeTag();
@@ -110,7 +229,420 @@ void GA::CMAHolder::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent)
 		ioStreamer.openTag("Sigma", inIndent);
 		lIterMap->second.mSigma.write(ioStreamer, inIndent);
 		ioStreamer.closeTag();
+		if(lValues.mModel == GA::CMAValues::eLimitedMemoryModel) {
+			const unsigned int lN = lValues.getDimension();
+			const unsigned int lM = lValues.mDirectionGens.size();
+			ioStreamer.openTag("RankOneRate", inIndent);
+			Double(lValues.mRankOneRate).write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+			Matrix lDirections(lM, lN);
+			for(unsigned int i=0; i<lM; ++i) {
+				for(unsigned int j=0; j<lN; ++j) lDirections(i,j) = lValues.mDirections[(i*lN)+j];
+			}
+			ioStreamer.openTag("Directions", inIndent);
+			lDirections.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+			UIntArray lGens(lM);
+			for(unsigned int i=0; i<lM; ++i) lGens[i] = lValues.mDirectionGens[i];
+			ioStreamer.openTag("DirectionGens", inIndent);
+			lGens.write(ioStreamer, inIndent);
+			ioStreamer.closeTag();
+		}
 		ioStreamer.closeTag();
 	}
 	Beagle_StackTraceEndM("void GA::CMAHolder::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const");
 }
+
+
+/*!
+ *  \brief Clear the work buffers, which are rebuilt from the model state at their next use.
+ *
+ *  Must be called whenever B, D or the directions are changed other than by the
+ *  update methods.
+ */
+void GA::CMAValues::clearBuffers()
+{
+	Beagle_StackTraceBeginM();
+	mC.clear();
+	mBDt.clear();
+	mSteps.clear();
+	mInvDirections.clear();
+	mFactorCoefs.clear();
+	mInvFactorCoefs.clear();
+	mDecompositionGen = 0;
+	Beagle_StackTraceEndM("void GA::CMAValues::clearBuffers()");
+}
+
+
+/*!
+ *  \brief Copy a step of the current batch.
+ *  \param inIndex Index of the step in the batch, usually the index of the child bred.
+ *  \param outStep Vector in which the step is copied.
+ *  \throw RunTimeException If the batch has no step of the given index.
+ *
+ *  The steps follow a normal distribution of covariance matrix C. They are B*D*z with the
+ *  full model, D*z with the separable model and A*z with the limited-memory model. As the
+ *  batch is only read here, steps can be copied concurrently.
+ */
+void GA::CMAValues::copyStep(unsigned int inIndex, std::vector<double>& outStep) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = getDimension();
+	outStep.resize(lN);
+	if(lN == 0) return;
+	if(inIndex >= (mSteps.size()/lN)) {
+		std::ostringstream lOSS;
+		lOSS << "The CMA-ES step of index " << inIndex << " is not in the current batch of ";
+		lOSS << (mSteps.size()/lN) << " steps. The steps must be drawn for all the children ";
+		lOSS << "before breeding, as done by the CMA-ES replacement strategy.";
+		throw Beagle_RunTimeExceptionM(lOSS.str());
+	}
+	const double* lStep = &mSteps[inIndex*lN];
+	for(unsigned int i=0; i<lN; ++i) outStep[i] = lStep[i];
+	Beagle_StackTraceEndM("void GA::CMAValues::copyStep(unsigned int,std::vector<double>&) const");
+}
+
+
+/*!
+ *  \brief Compute B and D from the eigendecomposition of the covariance matrix C.
+ *
+ *  Steps drawn before the decomposition are discarded. The caller is responsible for
+ *  recording the generation of the decomposition in mDecompositionGen.
+ */
+void GA::CMAValues::decomposeCovariance()
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(mModel == eFullModel);
+	const unsigned int lN = mD.size();
+	Beagle_AssertM(mC.size() == (lN*lN));
+	Matrix lC(lN, lN);
+	for(unsigned int i=0; i<lN; ++i) {
+		for(unsigned int j=0; j<lN; ++j) lC(i,j) = mC[(i*lN)+j];
+	}
+	lC.computeEigens(mD, mB);     // Principal component analysis
+	for(unsigned int i=0; i<lN; ++i) mD[i] = std::sqrt(mD[i]);
+	updateBDt();
+	mSteps.clear();
+	Beagle_StackTraceEndM("void GA::CMAValues::decomposeCovariance()");
+}
+
+
+/*!
+ *  \brief Draw a batch of steps, with z following a standard normal distribution.
+ *  \param ioRandomizer Randomizer used to draw z.
+ *
+ *  The batch holds the number of steps set by setBatchSize. With the full model, the batch is drawn as a single matrix product Z*(B*D)^T.
+ */
+void GA::CMAValues::drawSteps(Randomizer& ioRandomizer)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = getDimension();
+	const unsigned int lNbSteps = maxOf(mBatchSize, 1u);
+	mWork.resize(lNbSteps*lN);
+	for(unsigned int i=0; i<mWork.size(); ++i) mWork[i] = ioRandomizer.rollGaussian(0.0, 1.0);
+	mSteps.assign(lNbSteps*lN, 0.0);
+	switch(mModel) {
+	case eFullModel: {
+			if(mBDt.size() != (lN*lN)) updateBDt();
+			multiplyAdd(&mSteps[0], &mWork[0], &mBDt[0], lNbSteps, lN, lN);
+			break;
+		}
+	case eSeparableModel: {
+			Beagle_AssertM(mD.size() == lN);
+			for(unsigned int k=0; k<lNbSteps; ++k) {
+				for(unsigned int i=0; i<lN; ++i) {
+					const double lDi = (isNaN(mD[i]) || (mD[i]<0.0)) ? 0.0 : mD[i];
+					mSteps[(k*lN)+i] = lDi * mWork[(k*lN)+i];
+				}
+			}
+			break;
+		}
+	case eLimitedMemoryModel: {
+			for(unsigned int k=0; k<lNbSteps; ++k) multiplyFactor(&mWork[k*lN], &mSteps[k*lN]);
+			break;
+		}
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::drawSteps(Randomizer&)");
+}
+
+
+/*!
+ *  \brief Set the number of steps drawn per batch, discarding the current batch.
+ *  \param inBatchSize Number of steps per batch, usually the number of offspring.
+ */
+void GA::CMAValues::setBatchSize(unsigned int inBatchSize)
+{
+	Beagle_StackTraceBeginM();
+	mBatchSize = inBatchSize;
+	mSteps.clear();
+	Beagle_StackTraceEndM("void GA::CMAValues::setBatchSize(unsigned int)");
+}
+
+
+/*!
+ *  \brief Rebuild the transpose of B*D from B and D.
+ *
+ *  Principal components with a NaN or negative standard deviation are cancelled.
+ */
+void GA::CMAValues::updateBDt()
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = mD.size();
+	mBDt.resize(lN*lN);
+	for(unsigned int i=0; i<lN; ++i) {
+		const double lDi = (isNaN(mD[i]) || (mD[i]<0.0)) ? 0.0 : mD[i];
+		for(unsigned int j=0; j<lN; ++j) mBDt[(i*lN)+j] = mB(j,i) * lDi;
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::updateBDt()");
+}
+
+
+/*!
+ *  \brief Update the covariance matrix C with the rank one and rank mu updates.
+ *  \param inAttenuation Attenuation factor of the old covariance matrix.
+ *  \param inRankOneFactor Factor of the rank one update, made from the P_c cumulation path.
+ *  \param inRankMuFactor Factor of the rank mu update, made from the selected steps in mY.
+ *  \param inWeights Selection weights of the steps in mY.
+ *
+ *  The rank mu update is computed as the single weighted product Y^T W Y.
+ */
+void GA::CMAValues::updateCovariance(double inAttenuation,
+                                     double inRankOneFactor,
+                                     double inRankMuFactor,
+                                     const Vector& inWeights)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = mD.size();
+	const unsigned int lMu = inWeights.size();
+	Beagle_AssertM(mY.size() == (lMu*lN));
+	if(lN == 0) return;
+	if(mC.size() != (lN*lN)) {
+		// Rebuild C = (B*D)*(B*D)^T, as after an initialization or a milestone reading.
+		if(mBDt.size() != (lN*lN)) updateBDt();
+		mC.assign(lN*lN, 0.0);
+		addWeightedGram(&mC[0], &mBDt[0], NULL, lN, lN, 1.0);
+	}
+	for(unsigned int i=0; i<lN; ++i) {
+		double* lRowC = &mC[i*lN];
+		const double lPCi = inRankOneFactor * mPC[i];
+		for(unsigned int j=i; j<lN; ++j) lRowC[j] = (inAttenuation * lRowC[j]) + (lPCi * mPC[j]);
+	}
+	if(lMu > 0) {
+		mWork.resize(lMu);
+		for(unsigned int i=0; i<lMu; ++i) mWork[i] = inWeights[i];
+		addWeightedGram(&mC[0], &mY[0], &mWork[0], lMu, lN, inRankMuFactor);
+	}
+	mirrorUpperTriangle(&mC[0], lN);
+	Beagle_StackTraceEndM("void GA::CMAValues::updateCovariance(double,double,double,const Vector&)");
+}
+
+
+/*!
+ *  \brief Get the diagonal of the covariance matrix C.
+ *  \param outDiagonal Vector in which the diagonal is written.
+ *
+ *  With the limited-memory model, A = a^m*I + Q*V^T, where the columns of V are the
+ *  vectors v_j and the columns of Q the directions p_j scaled by a^(m-1-j)*b_j. The diagonal
+ *  C(i,i) = a^2m + 2*a^m*(Q*V^T)(i,i) + q_i^T*(V^T*V)*q_i is then computed in O(m^2*N).
+ */
+void GA::CMAValues::getCovarianceDiagonal(std::vector<double>& outDiagonal)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = getDimension();
+	outDiagonal.assign(lN, 0.0);
+	switch(mModel) {
+	case eFullModel: {
+			if(mC.size() == (lN*lN)) {
+				for(unsigned int i=0; i<lN; ++i) outDiagonal[i] = mC[(i*lN)+i];
+			} else {
+				for(unsigned int i=0; i<lN; ++i) {
+					for(unsigned int j=0; j<lN; ++j) {
+						const double lBDij = mB(i,j) * mD[j];
+						outDiagonal[i] += (lBDij * lBDij);
+					}
+				}
+			}
+			break;
+		}
+	case eSeparableModel: {
+			for(unsigned int i=0; i<lN; ++i) outDiagonal[i] = mD[i] * mD[i];
+			break;
+		}
+	case eLimitedMemoryModel: {
+			const unsigned int lM = mDirectionGens.size();
+			if(mInvDirections.size() != mDirections.size()) updateFactorCoefs();
+			const double lA = std::sqrt(1.0 - mRankOneRate);
+			std::vector<double> lQCoefs(lM);
+			double lAm = 1.0;
+			for(int j=int(lM)-1; j>=0; --j) {
+				lQCoefs[j] = lAm * mFactorCoefs[j];
+				lAm *= lA;
+			}
+			std::vector<double> lGram(lM*lM, 0.0);
+			for(unsigned int j=0; j<lM; ++j) {
+				for(unsigned int k=j; k<lM; ++k) {
+					double lDot = 0.0;
+					for(unsigned int i=0; i<lN; ++i) {
+						lDot += (mInvDirections[(j*lN)+i] * mInvDirections[(k*lN)+i]);
+					}
+					lGram[(j*lM)+k] = lGram[(k*lM)+j] = lDot;
+				}
+			}
+			std::vector<double> lQi(lM);
+			for(unsigned int i=0; i<lN; ++i) {
+				double lQVii = 0.0;
+				for(unsigned int j=0; j<lM; ++j) {
+					lQi[j] = lQCoefs[j] * mDirections[(j*lN)+i];
+					lQVii += (lQi[j] * mInvDirections[(j*lN)+i]);
+				}
+				double lQGQ = 0.0;
+				for(unsigned int j=0; j<lM; ++j) {
+					for(unsigned int k=0; k<lM; ++k) lQGQ += (lQi[j] * lGram[(j*lM)+k] * lQi[k]);
+				}
+				outDiagonal[i] = (lAm * lAm) + (2.0 * lAm * lQVii) + lQGQ;
+			}
+			break;
+		}
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::getCovarianceDiagonal(std::vector<double>&)");
+}
+
+
+/*!
+ *  \brief Multiply a vector by the factor A of the limited-memory model.
+ *  \param inZ Vector to multiply, of size N.
+ *  \param outX Product A*z, of size N.
+ *
+ *  As A_(j+1) = a*A_j + b_j*p_j*v_j^T, the product is computed in O(m*N) by applying
+ *  x = a*x + b_j*(v_j^T*z)*p_j for each direction, starting with x = z.
+ */
+void GA::CMAValues::multiplyFactor(const double* inZ, double* outX)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(mModel == eLimitedMemoryModel);
+	const unsigned int lN = getDimension();
+	const unsigned int lM = mDirectionGens.size();
+	if(mInvDirections.size() != mDirections.size()) updateFactorCoefs();
+	const double lA = std::sqrt(1.0 - mRankOneRate);
+	for(unsigned int i=0; i<lN; ++i) outX[i] = inZ[i];
+	for(unsigned int j=0; j<lM; ++j) {
+		const double* lVj = &mInvDirections[j*lN];
+		const double* lPj = &mDirections[j*lN];
+		double lDot = 0.0;
+		for(unsigned int i=0; i<lN; ++i) lDot += (lVj[i] * inZ[i]);
+		const double lCoef = mFactorCoefs[j] * lDot;
+		for(unsigned int i=0; i<lN; ++i) outX[i] = (lA * outX[i]) + (lCoef * lPj[i]);
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::multiplyFactor(const double*,double*)");
+}
+
+
+/*!
+ *  \brief Multiply a vector by the inverse of the factor A of the limited-memory model.
+ *  \param inX Vector to multiply, of size N.
+ *  \param outZ Product A^-1*x, of size N.
+ *
+ *  Applies z = z/a - d_j*(v_j^T*z)*v_j for each direction, starting with z = x.
+ */
+void GA::CMAValues::multiplyInverseFactor(const double* inX, double* outZ)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(mModel == eLimitedMemoryModel);
+	const unsigned int lN = getDimension();
+	const unsigned int lM = mDirectionGens.size();
+	if(mInvDirections.size() != mDirections.size()) updateFactorCoefs();
+	const double lInvA = 1.0 / std::sqrt(1.0 - mRankOneRate);
+	for(unsigned int i=0; i<lN; ++i) outZ[i] = inX[i];
+	for(unsigned int j=0; j<lM; ++j) {
+		const double* lVj = &mInvDirections[j*lN];
+		double lDot = 0.0;
+		for(unsigned int i=0; i<lN; ++i) lDot += (lVj[i] * outZ[i]);
+		const double lCoef = mInvFactorCoefs[j] * lDot;
+		for(unsigned int i=0; i<lN; ++i) outZ[i] = (lInvA * outZ[i]) - (lCoef * lVj[i]);
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::multiplyInverseFactor(const double*,double*)");
+}
+
+
+/*!
+ *  \brief Store the P_c cumulation path as a new direction of the limited-memory model.
+ *  \param inGeneration Actual generation.
+ *  \param inMaxDirections Maximum number of directions stored.
+ *  \param inMinGap Targeted minimum number of generations between stored directions.
+ *
+ *  When the memory is full, the direction closest in generations to its predecessor is
+ *  dropped if that gap is below inMinGap, otherwise the oldest direction is dropped. The
+ *  stored directions thus spread over the history of the search.
+ */
+void GA::CMAValues::storeDirection(unsigned int inGeneration,
+                                   unsigned int inMaxDirections,
+                                   unsigned int inMinGap)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(mModel == eLimitedMemoryModel);
+	Beagle_AssertM(inMaxDirections > 0);
+	const unsigned int lN = getDimension();
+	Beagle_AssertM(mPC.size() == lN);
+	if(mDirectionGens.size() >= inMaxDirections) {
+		unsigned int lDropped = 0;
+		if(mDirectionGens.size() > 1) {
+			unsigned int lMinIndex = 1;
+			for(unsigned int j=2; j<mDirectionGens.size(); ++j) {
+				if((mDirectionGens[j]-mDirectionGens[j-1]) <
+				        (mDirectionGens[lMinIndex]-mDirectionGens[lMinIndex-1])) lMinIndex = j;
+			}
+			if((mDirectionGens[lMinIndex]-mDirectionGens[lMinIndex-1]) < inMinGap) lDropped = lMinIndex;
+		}
+		mDirectionGens.erase(mDirectionGens.begin()+lDropped);
+		mDirections.erase(mDirections.begin()+(lDropped*lN), mDirections.begin()+((lDropped+1)*lN));
+	}
+	mDirectionGens.push_back(inGeneration);
+	for(unsigned int i=0; i<lN; ++i) mDirections.push_back(mPC[i]);
+	updateFactorCoefs();
+	mSteps.clear();
+	Beagle_StackTraceEndM("void GA::CMAValues::storeDirection(unsigned int,unsigned int,unsigned int)");
+}
+
+
+/*!
+ *  \brief Recompute the vectors v_j and coefficients b_j and d_j of the stored directions.
+ *
+ *  With a = sqrt(1-c_1) and v_j = A_j^-1*p_j, the coefficients of the Cholesky factor update
+ *  are b_j = a/|v_j|^2 * (sqrt(1+c_1/(1-c_1)*|v_j|^2) - 1) and
+ *  d_j = 1/(a*|v_j|^2) * (1 - 1/sqrt(1+c_1/(1-c_1)*|v_j|^2)). The cost is O(m^2*N).
+ */
+void GA::CMAValues::updateFactorCoefs()
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lN = getDimension();
+	const unsigned int lM = mDirectionGens.size();
+	Beagle_AssertM(mDirections.size() == (lM*lN));
+	const double lA = std::sqrt(1.0 - mRankOneRate);
+	const double lRatio = mRankOneRate / (1.0 - mRankOneRate);
+	mInvDirections.resize(lM*lN);
+	mFactorCoefs.resize(lM);
+	mInvFactorCoefs.resize(lM);
+	for(unsigned int j=0; j<lM; ++j) {
+		// v_j = A_j^-1 * p_j, applying the j first directions.
+		double* lVj = &mInvDirections[j*lN];
+		for(unsigned int i=0; i<lN; ++i) lVj[i] = mDirections[(j*lN)+i];
+		for(unsigned int k=0; k<j; ++k) {
+			const double* lVk = &mInvDirections[k*lN];
+			double lDot = 0.0;
+			for(unsigned int i=0; i<lN; ++i) lDot += (lVk[i] * lVj[i]);
+			const double lCoef = mInvFactorCoefs[k] * lDot;
+			for(unsigned int i=0; i<lN; ++i) lVj[i] = (lVj[i] / lA) - (lCoef * lVk[i]);
+		}
+		double lNormV2 = 0.0;
+		for(unsigned int i=0; i<lN; ++i) lNormV2 += (lVj[i] * lVj[i]);
+		if(lNormV2 <= 0.0) {
+			mFactorCoefs[j] = 0.0;
+			mInvFactorCoefs[j] = 0.0;
+		} else {
+			const double lSqrt = std::sqrt(1.0 + (lRatio * lNormV2));
+			mFactorCoefs[j] = (lA / lNormV2) * (lSqrt - 1.0);
+			mInvFactorCoefs[j] = (1.0 / (lA * lNormV2)) * (1.0 - (1.0 / lSqrt));
+		}
+	}
+	Beagle_StackTraceEndM("void GA::CMAValues::updateFactorCoefs()");
+}
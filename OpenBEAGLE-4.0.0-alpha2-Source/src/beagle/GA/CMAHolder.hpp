@@ -37,6 +37,7 @@
 #define Beagle_GA_CMAHolder_hpp
 
 #include <string>
+#include <vector>
 
 #include "beagle/config.hpp"
 #include "beagle/macros.hpp"
@@ -55,18 +56,85 @@ namespace GA
  *  \brief CMA-ES matrices and vector values.
  *  \ingroup GAF
  *  \ingroup GAFV
+ *
+ *  The covariance matrix C of the mutations is represented according to the model of the
+ *  values. With the full model, C = B*D*D*B^T is stored in O(N^2) memory. With the separable
+ *  model (sep-CMA-ES), C = D*D is diagonal and B is left empty. With the limited-memory model
+ *  (LM-CMA-ES), C = A*A^T, where the factor A is built implicitly from a few stored P_c
+ *  directions, and B and D are left empty.
+ *
+ *  References: Ros, R. and Hansen, N. (2008). A Simple Modification in CMA-ES Achieving Linear
+ *  Time and Space Complexity. PPSN X, pp. 296-305. Loshchilov, I. (2014). A Computationally
+ *  Efficient Limited Memory CMA-ES for Large Scale Optimization. GECCO 2014, pp. 397-404.
  */
 struct CMAValues
 {
+	//! Model of the covariance matrix.
+	enum Model {
+	    eFullModel,          //!< Full covariance matrix C = B*D*D*B^T.
+	    eSeparableModel,     //!< Diagonal covariance matrix C = D*D.
+	    eLimitedMemoryModel  //!< Covariance matrix C = A*A^T, A built from stored directions.
+	};
+
 	Matrix mB;       //!< CMA-ES B matrix.
 	Vector mD;       //!< CMA-ES D matrix.
 	Vector mPC;      //!< CMA-ES P_c cumulation path.
 	Vector mPS;      //!< CMA-ES P_s cumulation path.
 	Vector mXmean;   //!< Mean float vector individual.
 	Double mSigma;   //!< CMA-ES sigma value.
-
-	CMAValues()
+	Model  mModel;   //!< Model of the covariance matrix.
+
+	// Limited-memory model, from the oldest to the newest direction.
+	std::vector<double>       mDirections;     //!< Stored P_c directions p_j, row-major.
+	std::vector<unsigned int> mDirectionGens;  //!< Generation at which each direction was stored.
+	double                    mRankOneRate;    //!< Learning rate c_1 of the factor A.
+
+	// Work buffers, not serialized. They are sized at first use and reused afterward.
+	std::vector<double> mC;      //!< Covariance matrix C, row-major.
+	std::vector<double> mBDt;    //!< Transpose of B*D, row-major (row i is the ith principal axis).
+	std::vector<double> mSteps;  //!< Batch of steps B*D*z drawn for the offspring, row-major.
+	std::vector<double> mY;      //!< Selected steps (x_i-xmean)/sigma, row-major.
+	std::vector<double> mWork;   //!< Scratch buffer.
+	std::vector<double> mInvDirections; //!< Vectors v_j = A_j^-1 p_j of the directions, row-major.
+	std::vector<double> mFactorCoefs;   //!< Coefficients b_j of the directions in A.
+	std::vector<double> mInvFactorCoefs; //!< Coefficients d_j of the directions in A^-1.
+	unsigned int mBatchSize;     //!< Number of steps drawn per batch.
+	unsigned int mDecompositionGen; //!< Generation of the last eigendecomposition of C.
+
+	CMAValues() :
+		mModel(eFullModel),
+		mRankOneRate(0.0),
+		mBatchSize(1),
+		mDecompositionGen(0)
 	{ }
+
+	void clearBuffers();
+	void copyStep(unsigned int inIndex, std::vector<double>& outStep) const;
+	void decomposeCovariance();
+	void drawSteps(Randomizer& ioRandomizer);
+	void getCovarianceDiagonal(std::vector<double>& outDiagonal);
+	void multiplyFactor(const double* inZ, double* outX);
+	void multiplyInverseFactor(const double* inX, double* outZ);
+	void setBatchSize(unsigned int inBatchSize);
+	void storeDirection(unsigned int inGeneration, unsigned int inMaxDirections, unsigned int inMinGap);
+	void updateCovariance(double inAttenuation,
+	                      double inRankOneFactor,
+	                      double inRankMuFactor,
+	                      const Vector& inWeights);
+
+	/*!
+	 *  \return Dimensionality of the problem.
+	 */
+	inline unsigned int getDimension() const
+	{
+		return mXmean.size();
+	}
+
+protected:
+
+	void updateBDt();
+	void updateFactorCoefs();
+
 };
 
 
@@ -37,26 +37,6 @@
 #include <algorithm>
 #include <string>
 
-#if defined(BEAGLE_HAVE_STDTR1_UNORDEREDMAP)	// std::tr1::unordered_map
-#include <tr1/unordered_map>
-typedef std::tr1::unordered_map<int, int> CCXMap;
-#elif defined(BEAGLE_HAVE_UNORDERED_MAP)		// std::unordered_map
-#include <unordered_map>
-typedef std::unordered_map<int, int> CCXMap;
-#elif defined(BEAGLE_HAVE_STD_HASHMAP)			// std::hash_map
-#include <hash_map>
-typedef std::hash_map<int, int> CCXMap;
-#elif defined(BEAGLE_HAVE_STDEXT_HASHMAP)		// stdext::hash_map
-#include <hash_map>
-typedef stdext::hash_map<int, int> CCXMap;
-#elif defined(BEAGLE_HAVE_GNUCXX_HASHMAP)		// __gnu_cxx::hash_map
-#include <ext/hash_map>
-typedef __gnu_cxx::hash_map<int, int> CCXMap;
-#else											// std::map
-#include <map>
-typedef std::map<int, int> CCXMap;
-#endif
-
 
 /*!
  *  \brief Construct a GA cycle crossover operator.
@@ -69,6 +49,19 @@ Beagle::CrossoverOp(inMatingPbName, inName)
 { }
 
 
+/*!
+ *  \brief Initialize the GA cycle crossover operator.
+ *  \param ioSystem System of the evolution.
+ */
+void Beagle::GA::CrossoverCycleOp::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	CrossoverOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::CrossoverCycleOp::init(System&)");
+}
+
+
 /*!
  *  \brief Register the parameters of the GA cycle crossover operator.
  *  \param ioSystem System of the evolution.
@@ -128,39 +121,26 @@ bool Beagle::GA::CrossoverCycleOp::mate(Beagle::Individual& ioIndiv1,
 		GA::IntegerVector::Handle lIndividual2 = castHandleT<IntegerVector>(ioIndiv2[i]);
 
 		unsigned int lSize = minOf<unsigned int>(lIndividual1->size(), lIndividual2->size());
-		CCXMap lParent1;
+		if(lSize == 0) continue;
+		// Position of each value in X, and whether each index is in the cycle
+		unsigned int* lPos1 = mBuffers.getBuffer(2*lSize);
+		unsigned int* lInCycle = lPos1 + lSize;
 		for(unsigned int j = 0; j < lSize; ++j){
-			lParent1.insert(std::make_pair((*lIndividual1)[j], j));
+			Beagle_AssertM((unsigned int)(*lIndividual1)[j] < lSize);
+			lPos1[(*lIndividual1)[j]] = j;
+			lInCycle[j] = 0;
 		}
-		CCXMap lChild1;
-		std::vector<int> lChild2(lSize);
 		
-		// i = 1, X'_i = X_i
-		lChild1.insert(std::make_pair((*lIndividual1)[0], 0));
-		lChild2[0] = (*lIndividual2)[0];
-		// Search for Y_i in X
-		CCXMap::const_iterator lParent1Iter = lParent1.find((*lIndividual2)[0]);
-		// Continue until Y_i is present in X'_i (a cycle)
-		while(lChild1.find(lParent1Iter->first) == lChild1.end()){
-			// Insert Y_i at X_i
-			lChild1.insert(std::make_pair(lParent1Iter->first, lParent1Iter->second));
-			// The two childs are symetric
-			lChild2[lParent1Iter->second] = (*lIndividual2)[lParent1Iter->second];
-			// Search for Y_i in X, set i at the index of Y_i in X
-			lParent1Iter = lParent1.find((*lIndividual2)[lParent1Iter->second]);
-		}
+		// i = 1, X'_i = X_i, then search for Y_i in X, set i at the index of Y_i in X,
+		// and continue until Y_i is present in X' (a cycle)
+		unsigned int lIndex = 0;
+		do {
+			lInCycle[lIndex] = 1;
+			lIndex = lPos1[(*lIndividual2)[lIndex]];
+		} while(!lInCycle[lIndex]);
 		// Complete the childs by swapping what is not contained in the cycle
-		CCXMap lChild1Copy(lChild1.begin(), lChild1.end());
 		for(unsigned int j = 0; j < lSize; ++j){
-			if(lChild1Copy.find((*lIndividual1)[j]) == lChild1Copy.end()){
-				lChild1.insert(std::make_pair((*lIndividual2)[j], j));
-				lChild2[j] = (*lIndividual1)[j];
-			}
-		}
-		// Transfer childs in lIndividuals
-		for(CCXMap::const_iterator lChildIter = lChild1.begin(); lChildIter != lChild1.end() ; ++lChildIter){
-			(*lIndividual1)[lChildIter->second] = lChildIter->first;
-			(*lIndividual2)[lChildIter->second] = lChild2[lChildIter->second];
+			if(!lInCycle[j]) std::swap((*lIndividual1)[j], (*lIndividual2)[j]);
 		}
 	}
 	
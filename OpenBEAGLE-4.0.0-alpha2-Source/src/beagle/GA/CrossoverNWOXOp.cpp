@@ -47,6 +47,19 @@ Beagle::GA::CrossoverNWOXOp::CrossoverNWOXOp(std::string inMatingPbName,
 Beagle::CrossoverOp(inMatingPbName, inName)
 { }
 
+/*!
+ *  \brief Initialize the GA non-wrapping ordered crossover operator.
+ *  \param ioSystem System of the evolution.
+ */
+void Beagle::GA::CrossoverNWOXOp::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	CrossoverOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::CrossoverNWOXOp::init(System&)");
+}
+
+
 /*!
  *  \brief Register the parameters of the GA non-wrapping ordered crossover operator.
  *  \param ioSystem System of the evolution.
@@ -110,36 +123,44 @@ bool Beagle::GA::CrossoverNWOXOp::mate(Beagle::Individual& ioIndiv1,
 		unsigned int b = ioContext1.getSystem().getRandomizer().rollInteger(0, lSize-1);
 		
 		if(a > b){std::swap(a, b);}
-		bool* lHoleSet1 = new bool[lSize];
-		bool* lHoleSet2 = new bool[lSize];
+		unsigned int* lHoleSet1 = mBuffers.getBuffer(4*lSize);
+		unsigned int* lHoleSet2 = lHoleSet1 + lSize;
+		unsigned int* lChild1 = lHoleSet2 + lSize;
+		unsigned int* lChild2 = lChild1 + lSize;
 		for(unsigned int j = 0; j < lSize; ++j){
+			Beagle_AssertM((unsigned int)(*lIndividual1)[j] < lSize);
+			Beagle_AssertM((unsigned int)(*lIndividual2)[j] < lSize);
 			if(j < a || j > b){
-				lHoleSet1[(*lIndividual2)[j]] = false;
-				lHoleSet2[(*lIndividual1)[j]] = false;
+				lHoleSet1[(*lIndividual2)[j]] = 0;
+				lHoleSet2[(*lIndividual1)[j]] = 0;
 			}else{
-				lHoleSet1[(*lIndividual2)[j]] = true;
-				lHoleSet2[(*lIndividual1)[j]] = true;
+				lHoleSet1[(*lIndividual2)[j]] = 1;
+				lHoleSet2[(*lIndividual1)[j]] = 1;
 			}
 		}
-		std::vector<unsigned int> lChild1;
-		std::vector<unsigned int> lChild2;
+		// Keep the values that are not holes in order, leaving room for the section [a,b]
+		const unsigned int lSectionSize = b - a + 1;
+		unsigned int k1 = 0, k2 = 0;
 		for(unsigned int j = 0; j < lSize; ++j){
-			if(!lHoleSet1[(*lIndividual1)[j]])
-				lChild1.push_back((*lIndividual1)[j]);
+			if(!lHoleSet1[(*lIndividual1)[j]]){
+				lChild1[(k1 < a) ? k1 : (k1 + lSectionSize)] = (*lIndividual1)[j];
+				++k1;
+			}
 			
-			if(!lHoleSet2[(*lIndividual2)[j]])
-				lChild2.push_back((*lIndividual2)[j]);
+			if(!lHoleSet2[(*lIndividual2)[j]]){
+				lChild2[(k2 < a) ? k2 : (k2 + lSectionSize)] = (*lIndividual2)[j];
+				++k2;
+			}
+		}
+		for(unsigned int j = a; j <= b; ++j){
+			lChild1[j] = (*lIndividual2)[j];
+			lChild2[j] = (*lIndividual1)[j];
 		}
-		lChild1.insert(lChild1.begin() + a, lIndividual2->begin() + a, lIndividual2->begin() + (b + 1));
-		lChild2.insert(lChild2.begin() + a, lIndividual1->begin() + a, lIndividual1->begin() + (b + 1));
 		// Transfer the child in the ouput individuals
 		for(unsigned int j = 0; j < lSize; ++j){
 			(*lIndividual1)[j] = lChild1[j];
 			(*lIndividual2)[j] = lChild2[j];
 		}
-		
-		delete[] lHoleSet1;
-		delete[] lHoleSet2;
 	}
 	
 	Beagle_LogDebugM(
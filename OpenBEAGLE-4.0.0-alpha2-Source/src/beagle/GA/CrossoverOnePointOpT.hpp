@@ -82,6 +82,11 @@ public:
 	virtual bool mate(Individual& ioIndiv1, Context& ioContext1,
 	                  Individual& ioIndiv2, Context& ioContext2);
 
+protected:
+
+	virtual void swapElements(T& ioGenotype1, T& ioGenotype2,
+	                          unsigned int inBegin, unsigned int inEnd) const;
+
 };
 
 }
@@ -169,11 +174,7 @@ bool Beagle::GA::CrossoverOnePointOpT<T>::mate(Beagle::Individual& ioIndiv1,
 		    uint2ordinal(lMatingPoint+1)+std::string(" element")
 		);
 
-		for(unsigned int i=0; i<lMatingPoint; ++i) {
-			typename T::value_type lTemp = (*lGenotype1)[i];
-			(*lGenotype1)[i] = (*lGenotype2)[i];
-			(*lGenotype2)[i] = lTemp;
-		}
+		swapElements(*lGenotype1, *lGenotype2, 0, lMatingPoint);
 
 		Beagle_LogDebugM(
 		    ioContext1.getSystem().getLogger(),
@@ -235,11 +236,7 @@ bool Beagle::GA::CrossoverOnePointOpT<T>::mate(Beagle::Individual& ioIndiv1,
 		    *lGenotype2
 		);
 
-		for(unsigned int i=0; i<lMatingPoint; ++i) {
-			typename T::value_type lTemp = (*lGenotype1)[i];
-			(*lGenotype1)[i] = (*lGenotype2)[i];
-			(*lGenotype2)[i] = lTemp;
-		}
+		swapElements(*lGenotype1, *lGenotype2, 0, lMatingPoint);
 
 		Beagle_LogDebugM(
 		    ioContext1.getSystem().getLogger(),
@@ -263,4 +260,25 @@ bool Beagle::GA::CrossoverOnePointOpT<T>::mate(Beagle::Individual& ioIndiv1,
 }
 
 
+/*!
+ *  \brief Exchange a range of elements between two genotypes.
+ *  \param ioGenotype1 First genotype mated.
+ *  \param ioGenotype2 Second genotype mated.
+ *  \param inBegin Index of the first element exchanged.
+ *  \param inEnd Index following the last element exchanged.
+ */
+template <class T>
+void Beagle::GA::CrossoverOnePointOpT<T>::swapElements(T& ioGenotype1, T& ioGenotype2,
+        unsigned int inBegin, unsigned int inEnd) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=inBegin; i<inEnd; ++i) {
+		typename T::value_type lTemp = ioGenotype1[i];
+		ioGenotype1[i] = ioGenotype2[i];
+		ioGenotype2[i] = lTemp;
+	}
+	Beagle_StackTraceEndM("void GA::CrossoverOnePointOpT<T>::swapElements(T&,T&,unsigned int,unsigned int) const");
+}
+
+
 #endif // Beagle_GA_CrossoverOnePointOpT_hpp
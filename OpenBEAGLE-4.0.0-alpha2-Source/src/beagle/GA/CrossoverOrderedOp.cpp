@@ -47,6 +47,19 @@ Beagle::GA::CrossoverOrderedOp::CrossoverOrderedOp(std::string inMatingPbName,
 Beagle::CrossoverOp(inMatingPbName, inName)
 { }
 
+/*!
+ *  \brief Initialize the GA ordered crossover operator.
+ *  \param ioSystem System of the evolution.
+ */
+void Beagle::GA::CrossoverOrderedOp::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	CrossoverOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::CrossoverOrderedOp::init(System&)");
+}
+
+
 /*!
  *  \brief Register the parameters of the GA ordered crossover operator.
  *  \param ioSystem System of the evolution.
@@ -110,19 +123,21 @@ bool Beagle::GA::CrossoverOrderedOp::mate(Beagle::Individual& ioIndiv1,
 		unsigned int b = ioContext1.getSystem().getRandomizer().rollInteger(0, lSize-1);
 		
 		if(a > b){std::swap(a, b);}
-		bool* lHoleSet1 = new bool[lSize];
-		bool* lHoleSet2 = new bool[lSize];
+		unsigned int* lHoleSet1 = mBuffers.getBuffer(4*lSize);
+		unsigned int* lHoleSet2 = lHoleSet1 + lSize;
+		unsigned int* lChild1 = lHoleSet2 + lSize;
+		unsigned int* lChild2 = lChild1 + lSize;
 		for(unsigned int j = 0; j < lSize; ++j){
+			Beagle_AssertM((unsigned int)(*lIndividual1)[j] < lSize);
+			Beagle_AssertM((unsigned int)(*lIndividual2)[j] < lSize);
 			if(j < a || j > b){
-				lHoleSet1[(*lIndividual2)[j]] = false;
-				lHoleSet2[(*lIndividual1)[j]] = false;
+				lHoleSet1[(*lIndividual2)[j]] = 0;
+				lHoleSet2[(*lIndividual1)[j]] = 0;
 			}else{
-				lHoleSet1[(*lIndividual2)[j]] = true;
-				lHoleSet2[(*lIndividual1)[j]] = true;
+				lHoleSet1[(*lIndividual2)[j]] = 1;
+				lHoleSet2[(*lIndividual1)[j]] = 1;
 			}
 		}
-		std::vector<unsigned int> lChild1(lSize);
-		std::vector<unsigned int> lChild2(lSize);
 		unsigned int k1 = b + 1, k2 = b + 1;
 		for(unsigned int j = 0; j < lSize; ++j){
 			if(!lHoleSet1[(*lIndividual1)[(j + b + 1)%lSize]]){
@@ -144,9 +159,6 @@ bool Beagle::GA::CrossoverOrderedOp::mate(Beagle::Individual& ioIndiv1,
 				std::swap((*lIndividual1)[j], (*lIndividual2)[j]);
 			}
 		}
-		
-		delete[] lHoleSet1;
-		delete[] lHoleSet2;
 	}
 	
 	Beagle_LogDebugM(
@@ -41,6 +41,7 @@
 #include <beagle/macros.hpp>
 #include <beagle/Object.hpp>
 #include <beagle/CrossoverOp.hpp>
+#include <beagle/GA/PermutationBuffers.hpp>
 
 namespace Beagle {
 namespace GA {
@@ -73,10 +74,14 @@ public:
 	virtual ~CrossoverOrderedOp()
 	{ }
 	
+	virtual void init(System& ioSystem);
 	virtual void registerParams(System& ioSystem);
 	virtual bool mate(Individual& ioIndiv1, Context& ioContext1,
 					  Individual& ioIndiv2, Context& ioContext2);
 	
+protected:
+	PermutationBuffers mBuffers;			//!< Work buffers of the crossover, reused between matings.
+	
 };
 
 }
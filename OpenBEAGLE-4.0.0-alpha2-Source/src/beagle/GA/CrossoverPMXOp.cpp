@@ -47,6 +47,19 @@ Beagle::GA::CrossoverPMXOp::CrossoverPMXOp(std::string inMatingPbName,
 Beagle::CrossoverOp(inMatingPbName, inName)
 { }
 
+/*!
+ *  \brief Initialize the GA partialy matched crossover operator.
+ *  \param ioSystem System of the evolution.
+ */
+void Beagle::GA::CrossoverPMXOp::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	CrossoverOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::CrossoverPMXOp::init(System&)");
+}
+
+
 /*!
  *  \brief Register the parameters of the GA partialy matched crossover operator.
  *  \param ioSystem System of the evolution.
@@ -105,26 +118,34 @@ bool Beagle::GA::CrossoverPMXOp::mate(Beagle::Individual& ioIndiv1,
 		GA::IntegerVector::Handle lIndividual1 = castHandleT<IntegerVector>(ioIndiv1[i]);
 		GA::IntegerVector::Handle lIndividual2 = castHandleT<IntegerVector>(ioIndiv2[i]);
 		
-		std::deque<int> lIndividual1Copy(lIndividual1->begin(), lIndividual1->end());
-		std::deque<int> lIndividual2Copy(lIndividual2->begin(), lIndividual2->end());
-		
 		unsigned int lSize = minOf<unsigned int>(lIndividual1->size(), lIndividual2->size());
 		unsigned int a = ioContext1.getSystem().getRandomizer().rollInteger(0, lSize-1);
 		unsigned int b = ioContext1.getSystem().getRandomizer().rollInteger(0, lSize-1);
 		
 		if(a > b){std::swap(a, b);}
+		// Position of each value in the genotypes, and copy of the matching sections
+		unsigned int* lPos1 = mBuffers.getBuffer(2*lSize + 2*(b-a+1));
+		unsigned int* lPos2 = lPos1 + lSize;
+		unsigned int* lSection1 = lPos2 + lSize;
+		unsigned int* lSection2 = lSection1 + (b-a+1);
+		for(unsigned int k = 0; k < lSize; ++k){
+			Beagle_AssertM((unsigned int)(*lIndividual1)[k] < lSize);
+			Beagle_AssertM((unsigned int)(*lIndividual2)[k] < lSize);
+			lPos1[(*lIndividual1)[k]] = k;
+			lPos2[(*lIndividual2)[k]] = k;
+		}
 		for(unsigned int j = a; j <= b; ++j){
-			for(unsigned int k = 0; k < lSize; ++k){
-				if((*lIndividual1)[k] == lIndividual1Copy[j])
-					(*lIndividual1)[k] = lIndividual2Copy[j];
-				else if((*lIndividual1)[k] == lIndividual2Copy[j])
-					(*lIndividual1)[k] = lIndividual1Copy[j];
-				
-				if((*lIndividual2)[k] == lIndividual1Copy[j])
-					(*lIndividual2)[k] = lIndividual2Copy[j];
-				else if((*lIndividual2)[k] == lIndividual2Copy[j])
-					(*lIndividual2)[k] = lIndividual1Copy[j];
-			}
+			lSection1[j-a] = (*lIndividual1)[j];
+			lSection2[j-a] = (*lIndividual2)[j];
+		}
+		// Exchange each pair of matched values in both genotypes
+		for(unsigned int j = 0; j <= (b-a); ++j){
+			const unsigned int lValue1 = lSection1[j];
+			const unsigned int lValue2 = lSection2[j];
+			std::swap((*lIndividual1)[lPos1[lValue1]], (*lIndividual1)[lPos1[lValue2]]);
+			std::swap(lPos1[lValue1], lPos1[lValue2]);
+			std::swap((*lIndividual2)[lPos2[lValue1]], (*lIndividual2)[lPos2[lValue2]]);
+			std::swap(lPos2[lValue1], lPos2[lValue2]);
 		}
 	}
 	
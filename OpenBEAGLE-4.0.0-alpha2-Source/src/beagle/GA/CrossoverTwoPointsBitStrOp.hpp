@@ -85,6 +85,23 @@ public:
 	virtual ~CrossoverTwoPointsBitStrOp()
 	{ }
 
+protected:
+
+	/*!
+	 *  \brief Exchange a range of bits between two bit strings, a word at a time.
+	 *  \param ioGenotype1 First bit string mated.
+	 *  \param ioGenotype2 Second bit string mated.
+	 *  \param inBegin Index of the first bit exchanged.
+	 *  \param inEnd Index following the last bit exchanged.
+	 */
+	virtual void swapElements(GA::BitString& ioGenotype1, GA::BitString& ioGenotype2,
+	                          unsigned int inBegin, unsigned int inEnd) const
+	{
+		Beagle_StackTraceBeginM();
+		ioGenotype1.swapRange(ioGenotype2, inBegin, inEnd);
+		Beagle_StackTraceEndM("void GA::CrossoverTwoPointsBitStrOp::swapElements(GA::BitString&,GA::BitString&,unsigned int,unsigned int) const");
+	}
+
 };
 
 }
@@ -82,6 +82,11 @@ public:
 	virtual bool mate(Individual& ioIndiv1, Context& ioContext1,
 	                  Individual& ioIndiv2, Context& ioContext2);
 
+protected:
+
+	virtual void swapElements(T& ioGenotype1, T& ioGenotype2,
+	                          unsigned int inBegin, unsigned int inEnd) const;
+
 };
 
 }
@@ -177,11 +182,7 @@ bool Beagle::GA::CrossoverTwoPointsOpT<T>::mate(Beagle::Individual& ioIndiv1,
 		    uint2ordinal(lMatingPoint2+1)+std::string(" element")
 		);
 
-		for(unsigned int i=lMatingPoint1; i<lMatingPoint2; ++i) {
-			typename T::value_type lTemp = (*lGenotype1)[i];
-			(*lGenotype1)[i] = (*lGenotype2)[i];
-			(*lGenotype2)[i] = lTemp;
-		}
+		swapElements(*lGenotype1, *lGenotype2, lMatingPoint1, lMatingPoint2);
 
 		Beagle_LogDebugM(
 		    ioContext1.getSystem().getLogger(),
@@ -253,11 +254,7 @@ bool Beagle::GA::CrossoverTwoPointsOpT<T>::mate(Beagle::Individual& ioIndiv1,
 		    *lGenotype2
 		);
 
-		for(unsigned int i=lMatingPoint1; i<lMatingPoint2; ++i) {
-			typename T::value_type lTemp = (*lGenotype1)[i];
-			(*lGenotype1)[i] = (*lGenotype2)[i];
-			(*lGenotype2)[i] = lTemp;
-		}
+		swapElements(*lGenotype1, *lGenotype2, lMatingPoint1, lMatingPoint2);
 
 		Beagle_LogDebugM(
 		    ioContext1.getSystem().getLogger(),
@@ -281,4 +278,25 @@ bool Beagle::GA::CrossoverTwoPointsOpT<T>::mate(Beagle::Individual& ioIndiv1,
 }
 
 
+/*!
+ *  \brief Exchange a range of elements between two genotypes.
+ *  \param ioGenotype1 First genotype mated.
+ *  \param ioGenotype2 Second genotype mated.
+ *  \param inBegin Index of the first element exchanged.
+ *  \param inEnd Index following the last element exchanged.
+ */
+template <class T>
+void Beagle::GA::CrossoverTwoPointsOpT<T>::swapElements(T& ioGenotype1, T& ioGenotype2,
+        unsigned int inBegin, unsigned int inEnd) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=inBegin; i<inEnd; ++i) {
+		typename T::value_type lTemp = ioGenotype1[i];
+		ioGenotype1[i] = ioGenotype2[i];
+		ioGenotype2[i] = lTemp;
+	}
+	Beagle_StackTraceEndM("void GA::CrossoverTwoPointsOpT<T>::swapElements(T&,T&,unsigned int,unsigned int) const");
+}
+
+
 #endif // Beagle_GA_CrossoverTwoPointsOpT_hpp
@@ -49,6 +49,19 @@ Beagle::GA::CrossoverUPMXOp::CrossoverUPMXOp(std::string inMatingPbName,
 Beagle::CrossoverOp(inMatingPbName, inName), mDistribProbaName(inDistribPbName)
 { }
 
+/*!
+ *  \brief Initialize the GA uniform partialy matched crossover operator.
+ *  \param ioSystem System of the evolution.
+ */
+void Beagle::GA::CrossoverUPMXOp::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	CrossoverOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::CrossoverUPMXOp::init(System&)");
+}
+
+
 /*!
  *  \brief Register the parameters of the GA uniform partialy matched crossover operator.
  *  \param ioSystem System of the evolution.
@@ -126,8 +139,8 @@ bool Beagle::GA::CrossoverUPMXOp::mate(Beagle::Individual& ioIndiv1,
 		
 		unsigned int lSize = lIndividual1->size();
 		
-		unsigned int* lPos1 = new unsigned int[lSize];
-		unsigned int* lPos2 = new unsigned int[lSize];
+		unsigned int* lPos1 = mBuffers.getBuffer(2*lSize);
+		unsigned int* lPos2 = lPos1 + lSize;
 		
 		for(unsigned int j = 0; j < lSize; ++j){
 			lPos1[(*lIndividual1)[j]] = j;
@@ -148,9 +161,6 @@ bool Beagle::GA::CrossoverUPMXOp::mate(Beagle::Individual& ioIndiv1,
 				std::swap(lPos2[lTemp1], lPos2[lTemp2]);
 			}
 		}
-		
-		delete[] lPos1;
-		delete[] lPos2;
 	}
 	
 	Beagle_LogDebugM(
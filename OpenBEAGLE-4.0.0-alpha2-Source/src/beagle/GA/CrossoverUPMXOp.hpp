@@ -41,6 +41,7 @@
 #include <beagle/macros.hpp>
 #include <beagle/Object.hpp>
 #include <beagle/CrossoverOp.hpp>
+#include <beagle/GA/PermutationBuffers.hpp>
 
 namespace Beagle {
 namespace GA {
@@ -74,6 +75,7 @@ public:
 	virtual ~CrossoverUPMXOp()
 	{ }
 	
+	virtual void init(System& ioSystem);
 	virtual void registerParams(System& ioSystem);
 	virtual bool mate(Individual& ioIndiv1, Context& ioContext1,
 					  Individual& ioIndiv2, Context& ioContext2);
@@ -83,6 +85,7 @@ public:
 protected:
 	Float::Handle mDistribProba;		//!< Distribution probability of the uniform partialy matched crossover.
 	std::string   mDistribProbaName;	//!< Name used in the register for the distribution probability.
+	PermutationBuffers mBuffers;		//!< Work buffers of the crossover, reused between matings.
 	
 };
 		
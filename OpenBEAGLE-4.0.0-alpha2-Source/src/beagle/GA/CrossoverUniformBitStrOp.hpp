@@ -37,6 +37,7 @@
 #define Beagle_GA_CrossoverUniformBitStrOp_hpp
 
 #include <string>
+#include <vector>
 
 #include "beagle/config.hpp"
 #include "beagle/macros.hpp"
@@ -87,6 +88,41 @@ public:
 	virtual ~CrossoverUniformBitStrOp()
 	{ }
 
+protected:
+
+	/*!
+	 *  \brief Exchange bits between two bit strings, each with the distribution probability.
+	 *  \param ioGenotype1 First bit string mated.
+	 *  \param ioGenotype2 Second bit string mated.
+	 *  \param ioContext Evolutionary context.
+	 *
+	 *  A random mask of the bits to exchange is drawn, and the masked bits are exchanged a
+	 *  word at a time. With the usual distribution probability of 0.5, the mask words are
+	 *  drawn directly from the randomizer instead of bit by bit.
+	 */
+	virtual void mateGenotypes(GA::BitString& ioGenotype1, GA::BitString& ioGenotype2, Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		const unsigned int lSize = minOf<unsigned int>(ioGenotype1.size(), ioGenotype2.size());
+		const double lDistribProba = mDistribProba->getWrappedValue();
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		std::vector<GA::BitString::Word> lMask((lSize+GA::BitString::eWordBits-1)/GA::BitString::eWordBits, 0);
+		if(lDistribProba == 0.5) {
+			for(unsigned int i=0; i<lMask.size(); ++i) {
+				lMask[i] = (GA::BitString::Word(lRandomizer.rollInteger(0, 0xFFFFFFFFUL)) << 32) |
+				           GA::BitString::Word(lRandomizer.rollInteger(0, 0xFFFFFFFFUL));
+			}
+		} else {
+			for(unsigned int j=lRandomizer.rollGeometric(lDistribProba, lSize); j<lSize;
+			        j+=lRandomizer.rollGeometric(lDistribProba, lSize)+1) {
+				lMask[j/GA::BitString::eWordBits] |=
+				    (GA::BitString::Word(1) << (j%GA::BitString::eWordBits));
+			}
+		}
+		ioGenotype1.swapMasked(ioGenotype2, lMask);
+		Beagle_StackTraceEndM("void GA::CrossoverUniformBitStrOp::mateGenotypes(GA::BitString&,GA::BitString&,Context&)");
+	}
+
 };
 
 }
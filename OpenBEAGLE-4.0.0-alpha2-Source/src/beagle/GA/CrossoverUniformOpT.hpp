@@ -86,6 +86,9 @@ public:
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
 protected:
+
+	virtual void mateGenotypes(T& ioGenotype1, T& ioGenotype2, Context& ioContext);
+
 	Double::Handle mDistribProba;      //!< Distribution probability of the uniform crossover.
 	std::string   mDistribProbaName;  //!< Name used in the register for the distribution probability.
 
@@ -186,15 +189,7 @@ bool Beagle::GA::CrossoverUniformOpT<T>::mate(Beagle::Individual& ioIndiv1,
 	for(unsigned int i=0; i<lNbGenotypes; ++i) {
 		typename T::Handle lGenotype1 = castHandleT<T>(ioIndiv1[i]);
 		typename T::Handle lGenotype2 = castHandleT<T>(ioIndiv2[i]);
-		unsigned int lSize = minOf<unsigned int>(lGenotype1->size(), lGenotype2->size());
-		for(unsigned int j=0; j<lSize; ++j) {
-			double lRolledPb = ioContext1.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mDistribProba->getWrappedValue()) {
-				typename T::value_type lTemp = (*lGenotype1)[j];
-				(*lGenotype1)[j] = (*lGenotype2)[j];
-				(*lGenotype2)[j] = lTemp;
-			}
-		}
+		mateGenotypes(*lGenotype1, *lGenotype2, ioContext1);
 	}
 
 	Beagle_LogDebugM(
@@ -220,6 +215,29 @@ bool Beagle::GA::CrossoverUniformOpT<T>::mate(Beagle::Individual& ioIndiv1,
 }
 
 
+/*!
+ *  \brief Exchange elements between two genotypes, each with the distribution probability.
+ *  \param ioGenotype1 First genotype mated.
+ *  \param ioGenotype2 Second genotype mated.
+ *  \param ioContext Evolutionary context.
+ */
+template <class T>
+void Beagle::GA::CrossoverUniformOpT<T>::mateGenotypes(T& ioGenotype1, T& ioGenotype2, Beagle::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lSize = minOf<unsigned int>(ioGenotype1.size(), ioGenotype2.size());
+	const double lDistribProba = mDistribProba->getWrappedValue();
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	for(unsigned int j=lRandomizer.rollGeometric(lDistribProba, lSize); j<lSize;
+	        j+=lRandomizer.rollGeometric(lDistribProba, lSize)+1) {
+		typename T::value_type lTemp = ioGenotype1[j];
+		ioGenotype1[j] = ioGenotype2[j];
+		ioGenotype2[j] = lTemp;
+	}
+	Beagle_StackTraceEndM("void GA::CrossoverUniformOpT<T>::mateGenotypes(T&,T&,Context&)");
+}
+
+
 /*!
  *  \brief Read a uniform crossover operator from XML iterator.
  *  \param inIter XML iterator to use to read crossover operator.
@@ -90,6 +90,23 @@ void GA::ESVector::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Compute the hash value of the ES vector from its content.
+ *  \return Hash value of the ES vector.
+ */
+unsigned int GA::ESVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lHash = combineHash(0U, (unsigned int)size());
+	for(unsigned int i=0; i<size(); ++i) {
+		lHash = combineHash(lHash, (*this)[i].mValue);
+		lHash = combineHash(lHash, (*this)[i].mStrategy);
+	}
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GA::ESVector::computeHash() const");
+}
+
+
 /*!
  *  \brief Return size (length) of genotype.
  *  \return Size (length) of genotype.
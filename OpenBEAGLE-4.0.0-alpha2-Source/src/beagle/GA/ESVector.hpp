@@ -102,6 +102,7 @@ public:
 	explicit ESVector(unsigned int inSize=0, ESPair inModel=ESPair(0.f,1.f));
 
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual unsigned int        computeHash() const;
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
 	virtual void				swap(unsigned int inI, unsigned inJ);
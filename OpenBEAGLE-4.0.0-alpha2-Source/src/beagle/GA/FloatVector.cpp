@@ -66,6 +66,20 @@ void GA::FloatVector::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Compute the hash value of the float vector from its content.
+ *  \return Hash value of the float vector.
+ */
+unsigned int GA::FloatVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lHash = combineHash(0U, (unsigned int)size());
+	for(unsigned int i=0; i<size(); ++i) lHash = combineHash(lHash, (*this)[i]);
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GA::FloatVector::computeHash() const");
+}
+
+
 /*!
  *  \brief Return size (length) of genotype.
  *  \return Size (length) of genotype.
@@ -81,6 +81,7 @@ public:
 	explicit FloatVector(unsigned int inSize=0, float inModel=0.f);
 
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual unsigned int        computeHash() const;
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
 	virtual void				swap(unsigned int inI, unsigned inJ);
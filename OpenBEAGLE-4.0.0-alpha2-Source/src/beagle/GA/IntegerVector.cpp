@@ -64,6 +64,20 @@ void GA::IntegerVector::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Compute the hash value of the integer vector from its content.
+ *  \return Hash value of the integer vector.
+ */
+unsigned int GA::IntegerVector::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lHash = combineHash(0U, (unsigned int)size());
+	for(unsigned int i=0; i<size(); ++i) lHash = combineHash(lHash, (unsigned int)(*this)[i]);
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GA::IntegerVector::computeHash() const");
+}
+
+
 /*!
  *  \brief Return size (length) of genotype.
  *  \return Size (length) of genotype.
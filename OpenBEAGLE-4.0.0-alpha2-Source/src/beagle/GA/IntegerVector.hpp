@@ -80,6 +80,7 @@ public:
 	explicit IntegerVector(unsigned int inSize=0, int inModel=0);
 
 	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual unsigned int        computeHash() const;
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
 	virtual void				swap(unsigned int inI, unsigned inJ);
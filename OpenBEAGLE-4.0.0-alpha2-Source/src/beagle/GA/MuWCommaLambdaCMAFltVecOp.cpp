@@ -123,6 +123,11 @@ void GA::MuWCommaLambdaCMAFltVecOp::generateChildren(Deme& ioDeme,
 	ioCMAValues.mXmean.resize(inN);
 	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mXmean[i] = (*lMeanFloatVec)[i];
 
+	// The steps of the CMA-ES mutations are drawn in a single batch for all the children,
+	// before breeding, each child using the step of its index.
+	ioCMAValues.setBatchSize(inNbChildren);
+	ioCMAValues.drawSteps(ioContext.getSystem().getRandomizer());
+
 	// Generate lambda children with breeder tree, first build breeder roulette
 	RouletteT<unsigned int> lRoulette;
 	buildRoulette(lRoulette, ioContext);
@@ -150,9 +155,11 @@ void GA::MuWCommaLambdaCMAFltVecOp::generateChildren(Deme& ioDeme,
 	} else ioDeme.clear();
 
 	// Generate the children
+	const unsigned int lOldIndividualIndex = ioContext.getIndividualIndex();
 	Individual::Bag lBagWithMeanInd;
 	lBagWithMeanInd.push_back(lMeanInd);
 	for(unsigned int i=0; i<inNbChildren; ++i) {
+		ioContext.setIndividualIndex(i);
 		unsigned int lIndexBreeder = lRoulette.select(ioContext.getSystem().getRandomizer());
 		BreederNode::Handle lSelectedBreeder=getRootNode();
 		for(unsigned int j=0; j<lIndexBreeder; ++j)
@@ -166,6 +173,7 @@ void GA::MuWCommaLambdaCMAFltVecOp::generateChildren(Deme& ioDeme,
 		Beagle_NonNullPointerAssertM(lBredIndiv);
 		ioDeme.push_back(lBredIndiv);
 	}
+	ioContext.setIndividualIndex(lOldIndividualIndex);
 
 	Beagle_StackTraceEndM("void GA::MuWCommaLambdaCMAFltVecOp::generateChildren(Deme& ioDeme,Context& ioContext,unsigned int inN,unsigned int inNbChildren,GA::CMAValues& ioCMAValues) const");
 }
@@ -218,20 +226,38 @@ GA::CMAValues& GA::MuWCommaLambdaCMAFltVecOp::getCMAValues(unsigned int inIndex,
 	GA::CMAHolder::iterator lIterVal = lCMAHolder->find(ioContext.getDemeIndex());
 	if((ioContext.getGeneration()<=1) || (lIterVal==lCMAHolder->end())) {
 		GA::CMAValues& lValues = (*lCMAHolder)[inIndex];
-		lValues.mB.setIdentity(inN);
-		lValues.mD.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mD[i] = 1.0;
-		lValues.mPC.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mPC[i] = 0.0;
-		lValues.mPS.resize(inN);
-		for(unsigned int i=0; i<inN; ++i) lValues.mPS[i] = 0.0;
-		lValues.mSigma = mSigma->getWrappedValue();
+		initCMAValues(lValues, inN);
 		return lValues;
 	}
 	return lIterVal->second;
 	Beagle_StackTraceEndM("GA::CMAValues& GA::MuWCommaLambdaCMAFltVecOp::getCMAValues(unsigned int inIndex,unsigned int inN,Context& ioContext) const");
 }
 
+
+/*!
+ *  \brief Initialize CMA values with the full covariance model, C being the identity.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ */
+void GA::MuWCommaLambdaCMAFltVecOp::initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mModel = GA::CMAValues::eFullModel;
+	ioCMAValues.mB.setIdentity(inN);
+	ioCMAValues.mD.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = 1.0;
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mXmean.resize(inN);
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	ioCMAValues.mDirections.clear();
+	ioCMAValues.mDirectionGens.clear();
+	ioCMAValues.clearBuffers();
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaCMAFltVecOp::initCMAValues(GA::CMAValues&,unsigned int) const");
+}
+
 /*!
  *  \brief Register the parameters of the operator.
  *  \param ioSystem Reference to the evolutionary system.
@@ -250,6 +276,21 @@ void GA::MuWCommaLambdaCMAFltVecOp::registerParams(System& ioSystem)
 		mSigma = castHandleT<Double>(
 		             ioSystem.getRegister().insertEntry("ga.cmaes.sigma", new Double(0.5), lDescription));
 	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Delay between eigendecompositions of the CMA-ES covariance matrix C, ";
+		lOSS << "as a fraction of 1/(c_cov*N) generations, where N is the dimensionality ";
+		lOSS << "of the problem and c_cov the learning rate of C. B and D are reused ";
+		lOSS << "between decompositions. A value of 0 decomposes C at every generation.";
+		Register::Description lDescription(
+		    "CMA-ES eigendecomposition gap",
+		    "Double",
+		    "0.1",
+		    lOSS.str()
+		);
+		mEigenGap = castHandleT<Double>(
+		                ioSystem.getRegister().insertEntry("ga.cmaes.eigengap", new Double(0.1), lDescription));
+	}
 	{
 		std::ostringstream lOSS;
 		lOSS << "Maximum values assigned to vector's floats. ";
@@ -401,34 +442,22 @@ void GA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 	const double lChiN = std::sqrt(double(inN)) *
 	                     (1.0 - (0.25/double(inN)) + (1.0/(21.0*double(inN)*double(inN))));
 
-	// Compute new xmean
-	Vector lXmean_new(inN, 0.0);
-	for(unsigned int i=0; i<ioDeme.size(); ++i) {
-		GA::FloatVector::Handle lVecI = castHandleT<GA::FloatVector>((*ioDeme[i])[0]);
-		for(unsigned int j=0; j<inN; ++j) lXmean_new[j] += (inSelectionWeights[i] * (*lVecI)[j]);
-	}
+	// Gather the selected steps y_i = (x_i-xmean)/sigma and their weighted mean.
+	Vector lYmean;
+	setSelectedSteps(ioDeme, inN, inSelectionWeights, ioCMAValues, lYmean);
 
-	// Compute zmean
-	Vector lZmean(inN,0.0);
-	const double lSigma=ioCMAValues.mSigma.getWrappedValue();
+	// Update cumulation paths, P_s with B*zmean = B*D^-1*B^T*ymean
+	Vector lZmean(inN, 0.0);
 	for(unsigned int i=0; i<inN; ++i) {
-		lZmean[i] = (lXmean_new[i] - ioCMAValues.mXmean[i]) / lSigma;
+		for(unsigned int j=0; j<inN; ++j) lZmean[i] += (ioCMAValues.mB(j,i) * lYmean[j]);
+		lZmean[i] /= ioCMAValues.mD[i];
 	}
-	Matrix lBt;
-	ioCMAValues.mB.transpose(lBt);
-	lZmean = lBt * lZmean;
-	for(unsigned int i=0; i<inN; ++i) lZmean[i] /= ioCMAValues.mD[i];
-
-	// Update cumulation paths
-	Matrix lBD(inN,inN,0.0);
+	const double lPSFactor = std::sqrt(lCS * (2.0-lCS) * inMuEff);
 	for(unsigned int i=0; i<inN; ++i) {
-		for(unsigned int j=0; j<inN; ++j) lBD(j,i) = ioCMAValues.mB(j,i) * ioCMAValues.mD[i];
+		double lBZm = 0.0;
+		for(unsigned int j=0; j<inN; ++j) lBZm += (ioCMAValues.mB(i,j) * lZmean[j]);
+		ioCMAValues.mPS[i] = ((1.0-lCS) * ioCMAValues.mPS[i]) + (lPSFactor * lBZm);
 	}
-	Vector lBZm;
-	ioCMAValues.mB.multiply((Matrix&)lBZm, lZmean);
-	lBZm            *= std::sqrt(lCS * (2.0-lCS) * inMuEff);
-	ioCMAValues.mPS *= (1.0-lCS);
-	ioCMAValues.mPS += lBZm;
 
 	double lPSnorm = 0.0;
 	for(unsigned int i=0; i<ioCMAValues.mPS.size(); ++i) lPSnorm += (ioCMAValues.mPS[i] * ioCMAValues.mPS[i]);
@@ -440,13 +469,8 @@ void GA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 
 	ioCMAValues.mPC *= (1.0-lCC);
 	if(lHSig) {
-		// Vector lBDZm;
-		// lBD.multiply((Matrix&)lBDZm, lZmean);
-		// lBDZm *= std::sqrt(lCC * (2.0-lCC) * inMuEff);
-		// ioCMAValues.mPC += lBDZm;
-		Vector lXdiff = lXmean_new - ioCMAValues.mXmean;
-		lXdiff *= (std::sqrt(lCC * (2.0-lCC) * inMuEff) / lSigma);
-		ioCMAValues.mPC += lXdiff;
+		const double lPCFactor = std::sqrt(lCC * (2.0-lCC) * inMuEff);
+		for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] += (lPCFactor * lYmean[i]);
 	} else {
 		Beagle_LogTraceM(
 		    ioContext.getSystem().getLogger(),
@@ -456,47 +480,32 @@ void GA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 	}
 
 	// Adapt covariance matrix C
-	Matrix lC, lBDt;
-	lBD.transpose(lBDt);
-	lBD.multiply(lC, lBDt);
-
 	double lAttnC = (1.0-lCCov);    // Attenuation factor
 	if(lHSig == false) lAttnC += (lCCov * lCC * (2.0-lCC) / lMuCov);
-
-	Matrix lR1Upd;                  // Rank one update
-	ioCMAValues.mPC.transpose(lR1Upd);
-	lR1Upd = ioCMAValues.mPC * lR1Upd;
-	lR1Upd *= (lCCov / lMuCov);
-
-	Matrix lRMuUpd(inN,inN,0.0);    // Rank Mu update
-	for(unsigned int i=0; i<ioDeme.size(); ++i) {
-		GA::FloatVector::Handle lVecI = castHandleT<GA::FloatVector>((*ioDeme[i])[0]);
-		Vector lX_I(lVecI->size());
-		for(unsigned int j=0; j<lVecI->size(); ++j) lX_I[j] = (*lVecI)[j];
-		lX_I -= ioCMAValues.mXmean;
-		Matrix lX_It;
-		lX_I.transpose(lX_It);
-		lX_It *= inSelectionWeights[i];
-		lRMuUpd += (lX_I * lX_It);
-	}
-	lRMuUpd *= (lCCov * (1.0 - (1.0/lMuCov)) / (lSigma * lSigma));
-
-	lC *= lAttnC;                   // Attenuate old matrix
-	lC += lR1Upd;                   // Add rank one update
-	lC += lRMuUpd;                  // Add rank mu update
+	ioCMAValues.updateCovariance(lAttnC,
+	                             lCCov / lMuCov,                   // Rank one update
+	                             lCCov * (1.0 - (1.0/lMuCov)),     // Rank mu update
+	                             inSelectionWeights);
 
 	// Adapt step size sigma
 	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
 
-	// Update B and D from C
-	for(unsigned int i=1; i<inN; ++i) {
-		for(unsigned int j=0; j<i; ++j) lC(i,j) = lC(j,i);  // Enforce symetry
-	}
-	lC.computeEigens(ioCMAValues.mD, ioCMAValues.mB);     // Principal component analysis
-
-	// Adjust D as standard deviation
-	for(unsigned int i=0; i<inN; ++i) {
-		ioCMAValues.mD[i] = std::sqrt(ioCMAValues.mD[i]);
+	// Update B and D from C, D being the standard deviations. As the decomposition is O(N^3),
+	// it is done lazily, every ga.cmaes.eigengap/(c_cov*N) generations, B and D being
+	// reused in between.
+	const unsigned int lGeneration = ioContext.getGeneration();
+	const double lEigenGap = mEigenGap->getWrappedValue() / (lCCov * double(inN));
+	if((lGeneration < ioCMAValues.mDecompositionGen) || (ioCMAValues.mDecompositionGen == 0) ||
+	        (double(lGeneration-ioCMAValues.mDecompositionGen) >= lEigenGap)) {
+		ioCMAValues.decomposeCovariance();
+		ioCMAValues.mDecompositionGen = lGeneration;
+	} else {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    "replacement-strategy", "Beagle::GA::MuWCommaLambdaCMAFltVecOp",
+		    std::string("CMA-ES reusing B and D decomposed at generation ")+
+		    uint2str(ioCMAValues.mDecompositionGen)
+		);
 	}
 
 	// Log updated parameters.
@@ -527,3 +536,37 @@ void GA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,
 	);
 	Beagle_StackTraceEndM("void GA::MuWCommaLambdaCMAFltVecOp::updateValues(Deme& ioDeme,Context& ioContext,unsigned int inN,GA::CMAValues& ioCMAValues) const");
 }
+
+
+/*!
+ *  \brief Set the selected steps y_i = (x_i-xmean)/sigma of the CMA values.
+ *  \param ioDeme Deme of the selected individuals, sorted from the best.
+ *  \param inN Dimensionality of the problem.
+ *  \param inSelectionWeights Selection weights.
+ *  \param ioCMAValues CMA values in which the steps are set, in the mY buffer.
+ *  \param outYmean Weighted mean of the steps.
+ */
+void GA::MuWCommaLambdaCMAFltVecOp::setSelectedSteps(Deme& ioDeme,
+        unsigned int inN,
+        const Vector& inSelectionWeights,
+        GA::CMAValues& ioCMAValues,
+        Vector& outYmean) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lMu = ioDeme.size();
+	const double lSigma=ioCMAValues.mSigma.getWrappedValue();
+	Beagle_AssertM(lMu == inSelectionWeights.size());
+	ioCMAValues.mY.resize(lMu*inN);
+	outYmean.resize(inN);
+	for(unsigned int j=0; j<inN; ++j) outYmean[j] = 0.0;
+	for(unsigned int i=0; i<lMu; ++i) {
+		GA::FloatVector::Handle lVecI = castHandleT<GA::FloatVector>((*ioDeme[i])[0]);
+		Beagle_AssertM(lVecI->size() == inN);
+		double* lYI = &ioCMAValues.mY[i*inN];
+		for(unsigned int j=0; j<inN; ++j) {
+			lYI[j] = ((*lVecI)[j] - ioCMAValues.mXmean[j]) / lSigma;
+			outYmean[j] += (inSelectionWeights[i] * lYI[j]);
+		}
+	}
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaCMAFltVecOp::setSelectedSteps(Deme&,unsigned int,const Vector&,GA::CMAValues&,Vector&) const");
+}
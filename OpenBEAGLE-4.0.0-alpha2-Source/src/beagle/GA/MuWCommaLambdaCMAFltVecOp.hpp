@@ -108,6 +108,12 @@ protected:
 	virtual GA::CMAValues& getCMAValues(unsigned int inIndex,
 	                                    unsigned int inN,
 	                                    Context& ioContext) const;
+	virtual void           initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const;
+	void                   setSelectedSteps(Deme& ioDeme,
+	                                        unsigned int inN,
+	                                        const Vector& inSelectionWeights,
+	                                        GA::CMAValues& ioCMAValues,
+	                                        Vector& outYmean) const;
 	virtual void           updateValues(Deme& ioDeme,
 	                                    Context& ioContext,
 	                                    unsigned int inN,
@@ -116,6 +122,7 @@ protected:
 	                                    GA::CMAValues& ioCMAValues) const;
 
 	Double::Handle       mSigma;       //!< Initial CMA-ES sigma value.
+	Double::Handle       mEigenGap;    //!< Generations between decompositions of C, times c_cov*N.
 	DoubleArray::Handle  mMaxValue;    //!< Maximum float vector values.
 	DoubleArray::Handle  mMinValue;    //!< Minimum float vector values.
 
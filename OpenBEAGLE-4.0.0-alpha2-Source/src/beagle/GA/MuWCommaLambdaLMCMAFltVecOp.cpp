@@ -0,0 +1,205 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/MuWCommaLambdaLMCMAFltVecOp.cpp
+ *  \brief  Source code of class GA::MuWCommaLambdaLMCMAFltVecOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.0 $
+ */
+
+#include "beagle/GA.hpp"
+
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Build LM-CMA-ES (Mu_W,Lambda) replacement strategy operator.
+ *  \param inLMRatioName Lamda over Mu parameter name used in the register.
+ *  \param inName Name of the LM-CMA-ES (Mu_W,Lambda) operator.
+ */
+GA::MuWCommaLambdaLMCMAFltVecOp::MuWCommaLambdaLMCMAFltVecOp(std::string inLMRatioName,
+        std::string inName) :
+		MuWCommaLambdaCMAFltVecOp(inLMRatioName,inName)
+{ }
+
+
+/*!
+ *  \brief Register the parameters of the operator.
+ *  \param ioSystem Reference to the evolutionary system.
+ */
+void GA::MuWCommaLambdaLMCMAFltVecOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	MuWCommaLambdaCMAFltVecOp::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Number of cumulation path directions stored by the limited-memory CMA-ES ";
+		lOSS << "to represent the covariance matrix. A value of 0 means 4+floor(3*ln(N)), ";
+		lOSS << "where N is the dimensionality of the problem.";
+		Register::Description lDescription(
+		    "LM-CMA-ES number of directions",
+		    "UInt",
+		    "0",
+		    lOSS.str()
+		);
+		mNbDirections = castHandleT<UInt>(
+		                    ioSystem.getRegister().insertEntry("ga.cmaes.lmdirections", new UInt(0), lDescription));
+	}
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaLMCMAFltVecOp::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Initialize CMA values with the limited-memory model, C being the identity.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ */
+void GA::MuWCommaLambdaLMCMAFltVecOp::initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mModel = GA::CMAValues::eLimitedMemoryModel;
+	ioCMAValues.mB.resize(0,0);
+	ioCMAValues.mD.resize(0);
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mXmean.resize(inN);
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	ioCMAValues.mDirections.clear();
+	ioCMAValues.mDirectionGens.clear();
+	ioCMAValues.mRankOneRate = 1.0 / (10.0 * std::log(double(inN)+1.0));
+	ioCMAValues.clearBuffers();
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaLMCMAFltVecOp::initCMAValues(GA::CMAValues&,unsigned int) const");
+}
+
+
+/*!
+ *  \brief Update the stored directions, cumulation paths and other CMA values.
+ *  \param ioDeme Deme to use to update CMA values.
+ *  \param ioContext Evolutionary context.
+ *  \param inN Dimensionality of the problem.
+ *  \param inMuEff Effective mu.
+ *  \param inSelectionWeights Selection weights.
+ *  \param ioCMAValues Reference to CMA values.
+ *
+ *  The covariance matrix is adapted by rank one updates of its Cholesky factor A with the
+ *  P_c cumulation path, using a learning rate c_1 = 1/(10*ln(N+1)) and a cumulation rate
+ *  c_c = 1/m. Only the last m paths are kept, spread over the search history. The step size
+ *  is adapted by cumulative step-size adaptation, P_s accumulating A^-1*ymean.
+ */
+void GA::MuWCommaLambdaLMCMAFltVecOp::updateValues(Deme& ioDeme,
+        Context& ioContext,
+        unsigned int inN,
+        double inMuEff,
+        const Vector& inSelectionWeights,
+        GA::CMAValues& ioCMAValues) const
+{
+	Beagle_StackTraceBeginM();
+
+	// Log messages
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+	    "Updating stored directions, sigma, and cumulation paths of LM-CMA-ES."
+	);
+
+	// Compute some constants
+	unsigned int lM = mNbDirections->getWrappedValue();
+	if(lM == 0) lM = 4 + (unsigned int)std::floor(3.0 * std::log(double(inN)));
+	const double lCC = 1.0 / double(lM);
+	const double lCS = (inMuEff+2.0) / (double(inN)+inMuEff+3.0);
+	double lDamps = std::sqrt((inMuEff-1.0) / (double(inN)+1.0)) - 1.0;
+	lDamps = 1.0 + (2.0*maxOf(0.0,lDamps)) + lCS;
+	const double lChiN = std::sqrt(double(inN)) *
+	                     (1.0 - (0.25/double(inN)) + (1.0/(21.0*double(inN)*double(inN))));
+
+	// Gather the selected steps y_i = (x_i-xmean)/sigma and their weighted mean.
+	Vector lYmean;
+	setSelectedSteps(ioDeme, inN, inSelectionWeights, ioCMAValues, lYmean);
+	std::vector<double> lY(inN), lZ(inN);
+	for(unsigned int i=0; i<inN; ++i) lY[i] = lYmean[i];
+
+	// Update cumulation paths, P_s with zmean = A^-1*ymean
+	if(inN > 0) ioCMAValues.multiplyInverseFactor(&lY[0], &lZ[0]);
+	const double lPSFactor = std::sqrt(lCS * (2.0-lCS) * inMuEff);
+	double lPSnorm = 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPS[i] = ((1.0-lCS) * ioCMAValues.mPS[i]) + (lPSFactor * lZ[i]);
+		lPSnorm += (ioCMAValues.mPS[i] * ioCMAValues.mPS[i]);
+	}
+	lPSnorm = std::sqrt(lPSnorm);
+	const double lHLeft =
+	    lPSnorm / std::sqrt(1.0-std::pow(1.0-lCS, 2.0*double(ioContext.getGeneration())));
+	const double lHRight = (1.5+(1.0/(double(inN)-0.5))) * lChiN;
+	const bool lHSig = (lHLeft<lHRight);
+
+	ioCMAValues.mPC *= (1.0-lCC);
+	if(lHSig) {
+		const double lPCFactor = std::sqrt(lCC * (2.0-lCC) * inMuEff);
+		for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] += (lPCFactor * lY[i]);
+	} else {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+		    "LM-CMA-ES p_c cumulation path update stalled"
+		);
+	}
+
+	// Adapt the factor A of the covariance matrix by storing P_c as a new direction
+	ioCMAValues.storeDirection(ioContext.getGeneration(), lM, inN);
+
+	// Adapt step size sigma
+	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
+
+	// Log updated parameters.
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+	    std::string("LM-CMA-ES number of stored directions: ")+
+	    uint2str(ioCMAValues.mDirectionGens.size())
+	);
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+	    std::string("LM-CMA-ES updated sigma: ")+ioCMAValues.mSigma.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+	    std::string("LM-CMA-ES updated p_c vector (covariance cumulation path): ")+ioCMAValues.mPC.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaLMCMAFltVecOp",
+	    std::string("LM-CMA-ES updated p_s vector (sigma cumulation path): ")+ioCMAValues.mPS.serialize()
+	);
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaLMCMAFltVecOp::updateValues(Deme&,Context&,unsigned int,double,const Vector&,GA::CMAValues&) const");
+}
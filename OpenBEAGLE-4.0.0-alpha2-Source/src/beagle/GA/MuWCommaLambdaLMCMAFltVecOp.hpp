@@ -0,0 +1,106 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/MuWCommaLambdaLMCMAFltVecOp.hpp
+ *  \brief  Definition of the class GA::MuWCommaLambdaLMCMAFltVecOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.0 $
+ */
+
+
+#ifndef Beagle_GA_MuWCommaLambdaLMCMAFltVecOp_hpp
+#define Beagle_GA_MuWCommaLambdaLMCMAFltVecOp_hpp
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/GA/MuWCommaLambdaCMAFltVecOp.hpp"
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class MuWCommaLambdaLMCMAFltVecOp beagle/GA/MuWCommaLambdaLMCMAFltVecOp.hpp "beagle/GA/MuWCommaLambdaLMCMAFltVecOp.hpp"
+ *  \brief Limited-memory CMA-ES (Mu_W,Lambda) replacement strategy (LM-CMA-ES).
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Variant of the CMA-ES (Mu_W,Lambda) replacement strategy that represents the covariance
+ *  matrix by a Cholesky factor A built from m stored P_c directions, in O(m*N) time and
+ *  memory per sampled individual. It suits problems of a large dimensionality N, where the
+ *  full covariance matrix cannot be stored. Use in conjunction of the CMA-ES mutation operator
+ *  defined in class GA::MutationCMAFltVecOp.
+ *
+ *  Reference: Loshchilov, I. (2014). A Computationally Efficient Limited Memory CMA-ES for
+ *  Large Scale Optimization. GECCO 2014, pp. 397-404.
+ */
+class MuWCommaLambdaLMCMAFltVecOp : public MuWCommaLambdaCMAFltVecOp
+{
+
+public:
+
+	//! MuWCommaLambdaLMCMAFltVecOp allocator type.
+	typedef AllocatorT<MuWCommaLambdaLMCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Alloc>
+	Alloc;
+	//! MuWCommaLambdaLMCMAFltVecOp handle type.
+	typedef PointerT<MuWCommaLambdaLMCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Handle>
+	Handle;
+	//! MuWCommaLambdaLMCMAFltVecOp bag type.
+	typedef ContainerT<MuWCommaLambdaLMCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Bag>
+	Bag;
+
+	explicit MuWCommaLambdaLMCMAFltVecOp(std::string inLMRatioName="ga.cmaes.mulambdaratio",
+	                                     std::string inName="GA-MuWCommaLambdaLMCMAFltVecOp");
+	virtual ~MuWCommaLambdaLMCMAFltVecOp()
+	{ }
+
+	virtual void registerParams(System& ioSystem);
+
+protected:
+
+	virtual void initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const;
+	virtual void updateValues(Deme& ioDeme,
+	                          Context& ioContext,
+	                          unsigned int inN,
+	                          double inMuEff,
+	                          const Vector& inSelectionWeights,
+	                          GA::CMAValues& ioCMAValues) const;
+
+	UInt::Handle mNbDirections;      //!< Number of directions stored.
+
+};
+
+}
+}
+
+#endif // Beagle_GA_MuWCommaLambdaLMCMAFltVecOp_hpp
@@ -0,0 +1,193 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/MuWCommaLambdaSepCMAFltVecOp.cpp
+ *  \brief  Source code of class GA::MuWCommaLambdaSepCMAFltVecOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.0 $
+ */
+
+#include "beagle/GA.hpp"
+
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Build sep-CMA-ES (Mu_W,Lambda) replacement strategy operator.
+ *  \param inLMRatioName Lamda over Mu parameter name used in the register.
+ *  \param inName Name of the sep-CMA-ES (Mu_W,Lambda) operator.
+ */
+GA::MuWCommaLambdaSepCMAFltVecOp::MuWCommaLambdaSepCMAFltVecOp(std::string inLMRatioName,
+        std::string inName) :
+		MuWCommaLambdaCMAFltVecOp(inLMRatioName,inName)
+{ }
+
+
+/*!
+ *  \brief Initialize CMA values with the separable model, C being the identity.
+ *  \param ioCMAValues CMA values to initialize.
+ *  \param inN Dimensionality of the problem to solve.
+ */
+void GA::MuWCommaLambdaSepCMAFltVecOp::initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const
+{
+	Beagle_StackTraceBeginM();
+	ioCMAValues.mModel = GA::CMAValues::eSeparableModel;
+	ioCMAValues.mB.resize(0,0);
+	ioCMAValues.mD.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mD[i] = 1.0;
+	ioCMAValues.mPC.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] = 0.0;
+	ioCMAValues.mPS.resize(inN);
+	for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPS[i] = 0.0;
+	ioCMAValues.mXmean.resize(inN);
+	ioCMAValues.mSigma = mSigma->getWrappedValue();
+	ioCMAValues.mDirections.clear();
+	ioCMAValues.mDirectionGens.clear();
+	ioCMAValues.clearBuffers();
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaSepCMAFltVecOp::initCMAValues(GA::CMAValues&,unsigned int) const");
+}
+
+
+/*!
+ *  \brief Update the diagonal covariance matrix, cumulation paths and other CMA values.
+ *  \param ioDeme Deme to use to update CMA values.
+ *  \param ioContext Evolutionary context.
+ *  \param inN Dimensionality of the problem.
+ *  \param inMuEff Effective mu.
+ *  \param inSelectionWeights Selection weights.
+ *  \param ioCMAValues Reference to CMA values.
+ *
+ *  Same update as the full CMA-ES with B kept to the identity, the learning rate of the
+ *  covariance matrix being raised by a factor (N+2)/3 as only N values are learned.
+ */
+void GA::MuWCommaLambdaSepCMAFltVecOp::updateValues(Deme& ioDeme,
+        Context& ioContext,
+        unsigned int inN,
+        double inMuEff,
+        const Vector& inSelectionWeights,
+        GA::CMAValues& ioCMAValues) const
+{
+	Beagle_StackTraceBeginM();
+
+	// Log messages
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+	    "Updating diagonal covariance matrix, sigma, and cumulation paths of sep-CMA-ES."
+	);
+
+	// Compute some constants
+	const double lCC = 4.0 / (double(inN) + 4.0);
+	const double lCS = (inMuEff+2.0) / (double(inN)+inMuEff+3.0);
+	const double lMuCov = inMuEff;
+	double lCCov = ((2.0*inMuEff)-1.0) / (((double(inN)+2.0)*(double(inN)+2.0)) + inMuEff);
+	lCCov = ((1.0/lMuCov) * (2.0/((double(inN)+1.414)*(double(inN)+1.414)))) +
+	        ((1.0-(1.0/lMuCov)) * minOf(1.0,lCCov));
+	lCCov = minOf(1.0, lCCov * (double(inN)+2.0) / 3.0);
+	double lDamps = std::sqrt((inMuEff-1.0) / (double(inN)+1.0)) - 1.0;
+	lDamps = 1.0 + (2.0*maxOf(0.0,lDamps)) + lCS;
+	const double lChiN = std::sqrt(double(inN)) *
+	                     (1.0 - (0.25/double(inN)) + (1.0/(21.0*double(inN)*double(inN))));
+
+	// Gather the selected steps y_i = (x_i-xmean)/sigma and their weighted mean.
+	Vector lYmean;
+	setSelectedSteps(ioDeme, inN, inSelectionWeights, ioCMAValues, lYmean);
+
+	// Update cumulation paths, P_s with zmean = D^-1*ymean
+	const double lPSFactor = std::sqrt(lCS * (2.0-lCS) * inMuEff);
+	double lPSnorm = 0.0;
+	for(unsigned int i=0; i<inN; ++i) {
+		ioCMAValues.mPS[i] = ((1.0-lCS) * ioCMAValues.mPS[i]) +
+		                     (lPSFactor * lYmean[i] / ioCMAValues.mD[i]);
+		lPSnorm += (ioCMAValues.mPS[i] * ioCMAValues.mPS[i]);
+	}
+	lPSnorm = std::sqrt(lPSnorm);
+	const double lHLeft =
+	    lPSnorm / std::sqrt(1.0-std::pow(1.0-lCS, 2.0*double(ioContext.getGeneration())));
+	const double lHRight = (1.5+(1.0/(double(inN)-0.5))) * lChiN;
+	const bool lHSig = (lHLeft<lHRight);
+
+	ioCMAValues.mPC *= (1.0-lCC);
+	if(lHSig) {
+		const double lPCFactor = std::sqrt(lCC * (2.0-lCC) * inMuEff);
+		for(unsigned int i=0; i<inN; ++i) ioCMAValues.mPC[i] += (lPCFactor * lYmean[i]);
+	} else {
+		Beagle_LogTraceM(
+		    ioContext.getSystem().getLogger(),
+		    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+		    "sep-CMA-ES p_c cumulation path update stalled"
+		);
+	}
+
+	// Adapt the diagonal of covariance matrix C, and D as its square root
+	double lAttnC = (1.0-lCCov);    // Attenuation factor
+	if(lHSig == false) lAttnC += (lCCov * lCC * (2.0-lCC) / lMuCov);
+	const double lRankOneFactor = lCCov / lMuCov;
+	const double lRankMuFactor = lCCov * (1.0 - (1.0/lMuCov));
+	const unsigned int lMu = inSelectionWeights.size();
+	std::vector<double>& lRankMu = ioCMAValues.mWork;
+	lRankMu.assign(inN, 0.0);
+	for(unsigned int i=0; i<lMu; ++i) {
+		const double* lYI = &ioCMAValues.mY[i*inN];
+		for(unsigned int j=0; j<inN; ++j) lRankMu[j] += (inSelectionWeights[i] * lYI[j] * lYI[j]);
+	}
+	for(unsigned int j=0; j<inN; ++j) {
+		const double lCjj = (lAttnC * ioCMAValues.mD[j] * ioCMAValues.mD[j]) +
+		                    (lRankOneFactor * ioCMAValues.mPC[j] * ioCMAValues.mPC[j]) +
+		                    (lRankMuFactor * lRankMu[j]);
+		ioCMAValues.mD[j] = std::sqrt(lCjj);
+	}
+
+	// Adapt step size sigma
+	ioCMAValues.mSigma.getWrappedValue() *= std::exp((lCS/lDamps) * ((lPSnorm/lChiN)-1.0));
+
+	// Log updated parameters.
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+	    std::string("sep-CMA-ES updated D vector (standard deviations): ")+ioCMAValues.mD.serialize()
+	);
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+	    std::string("sep-CMA-ES updated sigma: ")+ioCMAValues.mSigma.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+	    std::string("sep-CMA-ES updated p_c vector (covariance cumulation path): ")+ioCMAValues.mPC.serialize()
+	);
+	Beagle_LogVerboseM(
+	    ioContext.getSystem().getLogger(),
+	    "replacement-strategy", "Beagle::GA::MuWCommaLambdaSepCMAFltVecOp",
+	    std::string("sep-CMA-ES updated p_s vector (sigma cumulation path): ")+ioCMAValues.mPS.serialize()
+	);
+	Beagle_StackTraceEndM("void GA::MuWCommaLambdaSepCMAFltVecOp::updateValues(Deme&,Context&,unsigned int,double,const Vector&,GA::CMAValues&) const");
+}
@@ -0,0 +1,101 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/MuWCommaLambdaSepCMAFltVecOp.hpp
+ *  \brief  Definition of the class GA::MuWCommaLambdaSepCMAFltVecOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.0 $
+ */
+
+
+#ifndef Beagle_GA_MuWCommaLambdaSepCMAFltVecOp_hpp
+#define Beagle_GA_MuWCommaLambdaSepCMAFltVecOp_hpp
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/GA/MuWCommaLambdaCMAFltVecOp.hpp"
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class MuWCommaLambdaSepCMAFltVecOp beagle/GA/MuWCommaLambdaSepCMAFltVecOp.hpp "beagle/GA/MuWCommaLambdaSepCMAFltVecOp.hpp"
+ *  \brief CMA-ES (Mu_W,Lambda) replacement strategy with a diagonal covariance matrix (sep-CMA-ES).
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Variant of the CMA-ES (Mu_W,Lambda) replacement strategy that adapts only the diagonal of
+ *  the covariance matrix, in O(N) time and memory per generation. It suits large and
+ *  nearly separable problems. Use in conjunction of the CMA-ES mutation operator defined in
+ *  class GA::MutationCMAFltVecOp.
+ *
+ *  Reference: Ros, R. and Hansen, N. (2008). A Simple Modification in CMA-ES Achieving Linear
+ *  Time and Space Complexity. PPSN X, pp. 296-305.
+ */
+class MuWCommaLambdaSepCMAFltVecOp : public MuWCommaLambdaCMAFltVecOp
+{
+
+public:
+
+	//! MuWCommaLambdaSepCMAFltVecOp allocator type.
+	typedef AllocatorT<MuWCommaLambdaSepCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Alloc>
+	Alloc;
+	//! MuWCommaLambdaSepCMAFltVecOp handle type.
+	typedef PointerT<MuWCommaLambdaSepCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Handle>
+	Handle;
+	//! MuWCommaLambdaSepCMAFltVecOp bag type.
+	typedef ContainerT<MuWCommaLambdaSepCMAFltVecOp,MuWCommaLambdaCMAFltVecOp::Bag>
+	Bag;
+
+	explicit MuWCommaLambdaSepCMAFltVecOp(std::string inLMRatioName="ga.cmaes.mulambdaratio",
+	                                      std::string inName="GA-MuWCommaLambdaSepCMAFltVecOp");
+	virtual ~MuWCommaLambdaSepCMAFltVecOp()
+	{ }
+
+protected:
+
+	virtual void initCMAValues(GA::CMAValues& ioCMAValues, unsigned int inN) const;
+	virtual void updateValues(Deme& ioDeme,
+	                          Context& ioContext,
+	                          unsigned int inN,
+	                          double inMuEff,
+	                          const Vector& inSelectionWeights,
+	                          GA::CMAValues& ioCMAValues) const;
+
+};
+
+}
+}
+
+#endif // Beagle_GA_MuWCommaLambdaSepCMAFltVecOp_hpp
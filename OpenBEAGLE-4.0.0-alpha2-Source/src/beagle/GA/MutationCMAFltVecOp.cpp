@@ -134,13 +134,22 @@ bool GA::MutationCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioContex
 	GA::CMAValues& lValues = lIterVal->second;
 
 	GA::FloatVector::Handle lVector=castHandleT<GA::FloatVector>(ioIndividual[0]);
-	Beagle_AssertM(lVector->size()==lValues.mD.size());
+	Beagle_AssertM(lVector->size()==lValues.getDimension());
 	const double lSigma=lValues.mSigma.getWrappedValue();
-	Vector lArz(lVector->size());
-	for(unsigned int i=0; i<lArz.size(); ++i) {
+	if(isNaN(lSigma) || (lSigma<0.)) {
+		std::ostringstream lOSS;
+		lOSS << "WARNING: CMA-ES sigma is NaN or negative (" << lSigma << "). ";
+		lOSS << "Mutation of the individual has been cancelled.";
+		Beagle_LogBasicM(
+		    ioContext.getSystem().getLogger(),
+		    "mutation", "Beagle::GA::MutationCMAFltVecOp",
+		    lOSS.str()
+		);
+		return false;
+	}
+	for(unsigned int i=0; i<lValues.mD.size(); ++i) {
 		double lStdErr = lSigma * lValues.mD[i];
 		if(isNaN(lStdErr) || (lStdErr<0.)) {
-			lArz[i] = 0.0;
 			std::ostringstream lOSS;
 			lOSS << "WARNING: standard deviation for CMA-ES mutation over the " << uint2ordinal(i+1);
 			lOSS << " principal component is NaN or negative (" << lStdErr << "). ";
@@ -150,15 +159,16 @@ bool GA::MutationCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioContex
 			    "mutation", "Beagle::GA::MutationCMAFltVecOp",
 			    lOSS.str()
 			);
-		} else lArz[i] = ioContext.getSystem().getRandomizer().rollGaussian(0.0, lStdErr);
+		}
 	}
-	Vector lMutFactor;
-	lValues.mB.multiply((Matrix&)lMutFactor, lArz);
+	// The steps are drawn by the replacement strategy before breeding, indexed by child.
+	std::vector<double> lMutFactor;
+	lValues.copyStep(ioContext.getIndividualIndex(), lMutFactor);
 	Beagle_AssertM(lMutFactor.size()==lVector->size());
 	for(unsigned int i=0; i<lVector->size(); ++i) {
 		const double lMaxVal = i<mMaxValue->size() ? (*mMaxValue)[i] : mMaxValue->back();
 		const double lMinVal = i<mMinValue->size() ? (*mMinValue)[i] : mMinValue->back();
-		(*lVector)[i] += lMutFactor[i];
+		(*lVector)[i] += (lSigma * lMutFactor[i]);
 		if((*lVector)[i] > lMaxVal) (*lVector)[i] = lMaxVal;
 		if((*lVector)[i] < lMinVal) (*lVector)[i] = lMinVal;
 	}
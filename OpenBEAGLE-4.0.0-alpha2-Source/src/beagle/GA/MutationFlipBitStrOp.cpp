@@ -117,13 +117,19 @@ bool GA::MutationFlipBitStrOp::mutate(Beagle::Individual& ioIndividual, Context&
 		    "mutation", "Beagle::GA::MutationFlipBitStrOp",
 		    *lBS
 		);
-		for(unsigned int j=0; j<lBS->size(); j++) {
-			double lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mBitMutateProba->getWrappedValue()) {
-				(*lBS)[j] = !(*lBS)[j];
-				lMutated = true;
-			}
+		// Build a mask of the bits to flip, skipping from one flipped bit to the next,
+		// then flip them a word at a time.
+		std::vector<GA::BitString::Word> lFlipMask(lBS->getNumberWords(), 0);
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		const double lBitMutateProba = mBitMutateProba->getWrappedValue();
+		const unsigned int lSize = lBS->size();
+		for(unsigned int j=lRandomizer.rollGeometric(lBitMutateProba, lSize); j<lSize;
+		        j+=lRandomizer.rollGeometric(lBitMutateProba, lSize)+1) {
+			lFlipMask[j/GA::BitString::eWordBits] |=
+			    (GA::BitString::Word(1) << (j%GA::BitString::eWordBits));
+			lMutated = true;
 		}
+		if(lMutated) lBS->flipMasked(lFlipMask);
 		if(lMutated) {
 			Beagle_LogVerboseM(
 			    ioContext.getSystem().getLogger(),
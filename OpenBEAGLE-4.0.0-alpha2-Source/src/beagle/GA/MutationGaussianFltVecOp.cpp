@@ -213,31 +213,33 @@ bool GA::MutationGaussianFltVecOp::mutate(Beagle::Individual& ioIndividual, Cont
 		    "mutation", "Beagle::GA::MutationGaussianFltVecOp",
 		    *lVector
 		);
-		for(unsigned int j=0; j<lVector->size(); j++) {
-			const float lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mMutateFloatPb->getWrappedValue()) {
-				const double lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
-				const double lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
-				const double lIncVal = j<mIncValue->size() ? (*mIncValue)[j] : mIncValue->back();
-				const double lMu =
-				    j<mMutateGaussMu->size() ? (*mMutateGaussMu)[j] : mMutateGaussMu->back();
-				const double lSigma =
-				    j<mMutateGaussSigma->size() ? (*mMutateGaussSigma)[j] : mMutateGaussSigma->back();
-				Beagle_AssertM(lSigma>=0.0);
-				const double lMValue = ioContext.getSystem().getRandomizer().rollGaussian(lMu,lSigma);
-				(*lVector)[j] += lMValue;
-				if(lIncVal!=0.0) (*lVector)[j] = lIncVal * round((*lVector)[j] / lIncVal);
-				if((*lVector)[j] > lMaxVal) (*lVector)[j] = lMaxVal;
-				if((*lVector)[j] < lMinVal) (*lVector)[j] = lMinVal;
-				lMutated = true;
-				Beagle_LogDebugM(
-				    ioContext.getSystem().getLogger(),
-				    "mutation", "Beagle::GA::MutationGaussianFltVecOp",
-				    string("Gaussian mutating by adding ")+dbl2str(lMValue)+
-				    string(" to the value at the index ")+uint2str(j)+
-				    string(" of the float vector")
-				);
-			}
+		// Skip from one mutated value to the next.
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		const double lMutateFloatPb = mMutateFloatPb->getWrappedValue();
+		const unsigned int lSize = lVector->size();
+		for(unsigned int j=lRandomizer.rollGeometric(lMutateFloatPb, lSize); j<lSize;
+		        j+=lRandomizer.rollGeometric(lMutateFloatPb, lSize)+1) {
+			const double lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
+			const double lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
+			const double lIncVal = j<mIncValue->size() ? (*mIncValue)[j] : mIncValue->back();
+			const double lMu =
+			    j<mMutateGaussMu->size() ? (*mMutateGaussMu)[j] : mMutateGaussMu->back();
+			const double lSigma =
+			    j<mMutateGaussSigma->size() ? (*mMutateGaussSigma)[j] : mMutateGaussSigma->back();
+			Beagle_AssertM(lSigma>=0.0);
+			const double lMValue = ioContext.getSystem().getRandomizer().rollGaussian(lMu,lSigma);
+			(*lVector)[j] += lMValue;
+			if(lIncVal!=0.0) (*lVector)[j] = lIncVal * round((*lVector)[j] / lIncVal);
+			if((*lVector)[j] > lMaxVal) (*lVector)[j] = lMaxVal;
+			if((*lVector)[j] < lMinVal) (*lVector)[j] = lMinVal;
+			lMutated = true;
+			Beagle_LogDebugM(
+			    ioContext.getSystem().getLogger(),
+			    "mutation", "Beagle::GA::MutationGaussianFltVecOp",
+			    string("Gaussian mutating by adding ")+dbl2str(lMValue)+
+			    string(" to the value at the index ")+uint2str(j)+
+			    string(" of the float vector")
+			);
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
@@ -84,6 +84,7 @@ bool GA::MutationMoveSequenceOp::mutate(Beagle::Individual& ioIndividual, Contex
 	Beagle_StackTraceBeginM();
 	
 	bool lMutated = false;
+	GA::SequenceDelta::Handle lDelta = GA::SequenceDelta::attach(ioIndividual);
 	
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		Beagle_LogVerboseM(
@@ -112,6 +113,10 @@ bool GA::MutationMoveSequenceOp::mutate(Beagle::Individual& ioIndividual, Contex
 		if(c > a){
 			lMutated = true;
 			unsigned int lFirst = a, lMiddle = b + 1, lLast = b - a + c + 1, lNext = lMiddle;
+			if(lDelta != NULL) {
+				lDelta->recordBlockExchange(castObjectT<const GA::IntegerVector&>(*ioIndividual[i]),
+				                            i, lFirst, lMiddle, lLast);
+			}
 			while(lFirst != lNext){
 				ioIndividual[i]->swap(lFirst++, lNext++);
 				if(lNext == lLast) lNext = lMiddle;
@@ -120,6 +125,10 @@ bool GA::MutationMoveSequenceOp::mutate(Beagle::Individual& ioIndividual, Contex
 		}else if(c < a){
 			lMutated = true;
 			unsigned int lFirst = c, lMiddle = a, lLast = b + 1, lNext = lMiddle;
+			if(lDelta != NULL) {
+				lDelta->recordBlockExchange(castObjectT<const GA::IntegerVector&>(*ioIndividual[i]),
+				                            i, lFirst, lMiddle, lLast);
+			}
 			while(lFirst != lNext){
 				ioIndividual[i]->swap(lFirst++, lNext++);
 				if(lNext == lLast) lNext = lMiddle;
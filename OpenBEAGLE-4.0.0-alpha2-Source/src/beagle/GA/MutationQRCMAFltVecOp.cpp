@@ -128,6 +128,8 @@ bool GA::MutationQRCMAFltVecOp::mutate(Individual& ioIndividual, Context& ioCont
 		throw Beagle_RunTimeExceptionM(lOSS.str());
 	}
 	GA::CMAValues& lValues = lIterVal->second;
+	if(lValues.mModel != GA::CMAValues::eFullModel) throw Beagle_RunTimeExceptionM(
+		    "Derandomized CMA-ES mutation can only be used with the full covariance model of CMA-ES");
 
 	GA::FloatVector::Handle lVector=castHandleT<GA::FloatVector>(ioIndividual[0]);
 	Beagle_AssertM(lVector->size()==lValues.mD.size());
@@ -84,6 +84,7 @@ bool GA::MutationReverseSequenceOp::mutate(Beagle::Individual& ioIndividual, Con
 	Beagle_StackTraceBeginM();
 	
 	bool lMutated = false;
+	GA::SequenceDelta::Handle lDelta = GA::SequenceDelta::attach(ioIndividual);
 	
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		Beagle_LogVerboseM(
@@ -106,6 +107,9 @@ bool GA::MutationReverseSequenceOp::mutate(Beagle::Individual& ioIndividual, Con
 		unsigned int b = ioContext.getSystem().getRandomizer().rollInteger(0, ioIndividual[i]->getSize()-1);
 		if(a > b) std::swap(a, b);
 		if(a != b) lMutated = true;
+		if(lDelta != NULL) {
+			lDelta->recordReversal(castObjectT<const GA::IntegerVector&>(*ioIndividual[i]), i, a, b);
+		}
 		while(a < b)
 			ioIndividual[i]->swap(a++, b--);
 		
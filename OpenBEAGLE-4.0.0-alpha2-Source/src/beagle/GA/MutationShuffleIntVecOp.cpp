@@ -106,6 +106,7 @@ bool GA::MutationShuffleIntVecOp::mutate(Beagle::Individual& ioIndividual, Conte
 	    dbl2str(mIntMutateProba->getWrappedValue())
 	);
 
+	GA::SequenceDelta::Handle lDelta = GA::SequenceDelta::attach(ioIndividual);
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		GA::IntegerVector::Handle lIV = castHandleT<GA::IntegerVector>(ioIndividual[i]);
 		if(lIV->size() <= 2) continue;
@@ -124,17 +125,18 @@ bool GA::MutationShuffleIntVecOp::mutate(Beagle::Individual& ioIndividual, Conte
 		    "mutation", "Beagle::GA::MutationShuffleIntVecOp",
 		    *lIV
 		);
-		for(unsigned int j=0; j<lIV->size(); j++) {
-			double lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mIntMutateProba->getWrappedValue()) {
-				unsigned int lSwapIndex =
-				    ioContext.getSystem().getRandomizer().rollInteger(0, lIV->size()-2);
-				if(lSwapIndex >= j) ++lSwapIndex;
-				const int lTmpVal = (*lIV)[lSwapIndex];
-				(*lIV)[lSwapIndex] = (*lIV)[j];
-				(*lIV)[j] = lTmpVal;
-				lMutated = true;
-			}
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		const double lIntMutateProba = mIntMutateProba->getWrappedValue();
+		const unsigned int lSize = lIV->size();
+		for(unsigned int j=lRandomizer.rollGeometric(lIntMutateProba, lSize); j<lSize;
+		        j+=lRandomizer.rollGeometric(lIntMutateProba, lSize)+1) {
+			unsigned int lSwapIndex = lRandomizer.rollInteger(0, lSize-2);
+			if(lSwapIndex >= j) ++lSwapIndex;
+			if(lDelta != NULL) lDelta->recordSwap(*lIV, i, j, lSwapIndex);
+			const int lTmpVal = (*lIV)[lSwapIndex];
+			(*lIV)[lSwapIndex] = (*lIV)[j];
+			(*lIV)[j] = lTmpVal;
+			lMutated = true;
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
@@ -84,6 +84,7 @@ bool GA::MutationShuffleSequenceOp::mutate(Beagle::Individual& ioIndividual, Con
 	Beagle_StackTraceBeginM();
 	
 	bool lMutated = false;
+	GA::SequenceDelta::Handle lDelta = GA::SequenceDelta::attach(ioIndividual);
 	
 	for(unsigned int i=0; i<ioIndividual.size(); i++) {
 		Beagle_LogVerboseM(
@@ -107,6 +108,9 @@ bool GA::MutationShuffleSequenceOp::mutate(Beagle::Individual& ioIndividual, Con
 		if(a > b) std::swap(a, b);
 		for(unsigned int j = a; j <= b; ++j){
 			unsigned int lRndIndex = ioContext.getSystem().getRandomizer().rollInteger(a, b);
+			if(lDelta != NULL) {
+				lDelta->recordSwap(castObjectT<const GA::IntegerVector&>(*ioIndividual[i]), i, j, lRndIndex);
+			}
 			ioIndividual[i]->swap(j, lRndIndex);
 		}
 		
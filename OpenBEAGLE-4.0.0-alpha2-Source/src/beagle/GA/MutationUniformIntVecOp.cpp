@@ -152,16 +152,18 @@ bool GA::MutationUniformIntVecOp::mutate(Beagle::Individual& ioIndividual, Conte
 		    "mutation", "Beagle::GA::MutationUniformIntVecOp",
 		    *lIV
 		);
-		for(unsigned int j=0; j<lIV->size(); j++) {
-			double lRolledPb = ioContext.getSystem().getRandomizer().rollUniform();
-			if(lRolledPb <= mIntMutateProba->getWrappedValue()) {
-				const int lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
-				const int lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
-				Beagle_AssertM(lMaxVal >= lMinVal);
-				const int lRandVal = (int)ioContext.getSystem().getRandomizer().rollInteger(0,lMaxVal-lMinVal);
-				(*lIV)[j] = (lRandVal+lMinVal);
-				lMutated = true;
-			}
+		// Skip from one mutated value to the next.
+		Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+		const double lIntMutateProba = mIntMutateProba->getWrappedValue();
+		const unsigned int lSize = lIV->size();
+		for(unsigned int j=lRandomizer.rollGeometric(lIntMutateProba, lSize); j<lSize;
+		        j+=lRandomizer.rollGeometric(lIntMutateProba, lSize)+1) {
+			const int lMaxVal = j<mMaxValue->size() ? (*mMaxValue)[j] : mMaxValue->back();
+			const int lMinVal = j<mMinValue->size() ? (*mMinValue)[j] : mMinValue->back();
+			Beagle_AssertM(lMaxVal >= lMinVal);
+			const int lRandVal = (int)ioContext.getSystem().getRandomizer().rollInteger(0,lMaxVal-lMinVal);
+			(*lIV)[j] = (lRandVal+lMinVal);
+			lMutated = true;
 		}
 		if(lMutated) {
 			Beagle_LogVerboseM(
@@ -62,6 +62,8 @@ void GA::PackageCMAES::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::GA::MutationCMAFltVecOp", new GA::MutationCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::GA::MutationQRCMAFltVecOp", new GA::MutationQRCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::GA::MuWCommaLambdaCMAFltVecOp", new GA::MuWCommaLambdaCMAFltVecOp::Alloc);
+	lFactory.insertAllocator("Beagle::GA::MuWCommaLambdaLMCMAFltVecOp", new GA::MuWCommaLambdaLMCMAFltVecOp::Alloc);
+	lFactory.insertAllocator("Beagle::GA::MuWCommaLambdaSepCMAFltVecOp", new GA::MuWCommaLambdaSepCMAFltVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::GA::PackageCMAES", new GA::PackageCMAES::Alloc);
 	lFactory.insertAllocator("Beagle::GA::TermCMAOp", new GA::TermCMAOp::Alloc);
 
@@ -72,6 +74,8 @@ void GA::PackageCMAES::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::GA::MutationCMAFltVecOp", "GA-MutationCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::GA::MutationQRCMAFltVecOp", "GA-MutationQRCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::GA::MuWCommaLambdaCMAFltVecOp", "GA-MuWCommaLambdaCMAFltVecOp");
+	lFactory.aliasAllocator("Beagle::GA::MuWCommaLambdaLMCMAFltVecOp", "GA-MuWCommaLambdaLMCMAFltVecOp");
+	lFactory.aliasAllocator("Beagle::GA::MuWCommaLambdaSepCMAFltVecOp", "GA-MuWCommaLambdaSepCMAFltVecOp");
 	lFactory.aliasAllocator("Beagle::GA::PackageCMAES", "GA-PackageCMAES");
 	lFactory.aliasAllocator("Beagle::GA::TermCMAOp", "GA-TermCMAOp");
 
@@ -79,6 +83,7 @@ void GA::PackageCMAES::configure(System& ioSystem)
 	lFactory.setConcept("Algorithm", "GA-AlgoCMAES");
 	lFactory.setConcept("InitializationOp", "GA-InitCMAFltVecOp");
 	lFactory.setConcept("MutationOp", "GA-MutationCMAFltVecOp");
+	lFactory.setConcept("ReplacementStrategyOp", "GA-MuWCommaLambdaCMAFltVecOp");
 	lFactory.setConcept("TerminationOp", "GA-TermCMAOp");
 
 	// Add components
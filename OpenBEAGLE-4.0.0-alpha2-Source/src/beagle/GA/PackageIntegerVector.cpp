@@ -78,6 +78,7 @@ void GA::PackageIntegerVector::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::GA::MutationShuffleSequenceOp", new GA::MutationShuffleSequenceOp::Alloc);
 	lFactory.insertAllocator("Beagle::GA::MutationUniformIntVecOp", new GA::MutationUniformIntVecOp::Alloc);
 	lFactory.insertAllocator("Beagle::GA::PackageIntegerVector", new GA::PackageIntegerVector::Alloc);
+	lFactory.insertAllocator("Beagle::GA::SequenceDelta", new GA::SequenceDelta::Alloc);
 
 	// Aliases to short name of operators
 	lFactory.aliasAllocator("Beagle::GA::CrossoverCycleOp", "GA-CrossoverCycleOp");
@@ -101,6 +102,7 @@ void GA::PackageIntegerVector::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::GA::MutationShuffleSequenceOp", "GA-MutationShuffleSequenceOp");
 	lFactory.aliasAllocator("Beagle::GA::MutationUniformIntVecOp", "GA-MutationUniformIntVecOp");
 	lFactory.aliasAllocator("Beagle::GA::PackageIntegerVector", "GA-PackageIntegerVector");
+	lFactory.aliasAllocator("Beagle::GA::SequenceDelta", "GA-SequenceDelta");
 
 	// Set some basic concept-type associations in factory
 	lFactory.setConcept("CrossoverOp", "GA-CrossoverUniformIntVecOp");
@@ -0,0 +1,216 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/src/PackedFloatVectors.cpp
+ *  \brief  Source code of class GA::PackedFloatVectors.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/10 20:32:21 $
+ */
+
+#include "beagle/GA.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct an empty matrix of packed real-valued genotypes.
+ */
+GA::PackedFloatVectors::PackedFloatVectors() :
+		mCols(0),
+		mStride(0),
+		mOffset(0)
+{ }
+
+
+/*!
+ *  \brief Remove all the rows of the matrix.
+ */
+void GA::PackedFloatVectors::clear()
+{
+	Beagle_StackTraceBeginM();
+	mStorage.clear();
+	mRowSizes.clear();
+	mCols = 0;
+	mStride = 0;
+	mOffset = 0;
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::clear()");
+}
+
+
+/*!
+ *  \brief Compute the weighted mean of the rows of the matrix.
+ *  \param inWeights Weights of the rows, an empty vector meaning equal weights.
+ *  \param outMean Mean of the rows, of the size of the longest row.
+ *
+ *  Each value of the mean is normalized by the sum of the weights of the rows having that
+ *  value, so that rows shorter than others don't pull the mean toward zero.
+ */
+void GA::PackedFloatVectors::computeWeightedMean(const std::vector<double>& inWeights,
+        std::vector<double>& outMean) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inWeights.empty() || (inWeights.size() == mRowSizes.size()));
+	outMean.assign(mCols, 0.0);
+	if(mCols == 0) return;
+	mWeightSums.assign(mCols, 0.0);
+	double* lMean = &outMean[0];
+	double* lWeightSum = &mWeightSums[0];
+	for(unsigned int i=0; i<mRowSizes.size(); ++i) {
+		const double* lRow = getRow(i);
+		const unsigned int lRowSize = mRowSizes[i];
+		const double lWeight = inWeights.empty() ? 1.0 : inWeights[i];
+		for(unsigned int j=0; j<lRowSize; ++j) lMean[j] += lWeight * lRow[j];
+		for(unsigned int j=0; j<lRowSize; ++j) lWeightSum[j] += lWeight;
+	}
+	for(unsigned int j=0; j<mCols; ++j) lMean[j] /= lWeightSum[j];
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::computeWeightedMean(const std::vector<double>&, std::vector<double>&) const");
+}
+
+
+/*!
+ *  \brief Pack the values and strategy parameters of an ES vector genotype of individuals.
+ *  \param inIndividuals Individuals to pack, one per row.
+ *  \param inGenotype Index of the ES vector genotype to pack in the individuals.
+ *  \param outStrategies Matrix to pack the strategy parameters into, the values being packed
+ *    into this matrix.
+ *
+ *  An individual without the given genotype gives an empty row.
+ */
+void GA::PackedFloatVectors::packES(const Individual::Bag& inIndividuals,
+                                    unsigned int inGenotype,
+                                    PackedFloatVectors& outStrategies)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(&outStrategies != this);
+	unsigned int lCols = 0;
+	for(unsigned int i=0; i<inIndividuals.size(); ++i) {
+		if(inGenotype >= inIndividuals[i]->size()) continue;
+		const GA::ESVector* lGenotype =
+		    castObjectT<const GA::ESVector*>((*inIndividuals[i])[inGenotype].getPointer());
+		lCols = maxOf<unsigned int>(lCols, lGenotype->size());
+	}
+	resize(inIndividuals.size(), lCols);
+	outStrategies.resize(inIndividuals.size(), lCols);
+	for(unsigned int i=0; i<inIndividuals.size(); ++i) {
+		if(inGenotype >= inIndividuals[i]->size()) {
+			mRowSizes[i] = outStrategies.mRowSizes[i] = 0;
+			continue;
+		}
+		const GA::ESVector& lGenotype =
+		    castObjectT<const GA::ESVector&>(*(*inIndividuals[i])[inGenotype]);
+		double* lValues = getRow(i);
+		double* lStrategies = outStrategies.getRow(i);
+		mRowSizes[i] = outStrategies.mRowSizes[i] = lGenotype.size();
+		for(unsigned int j=0; j<lGenotype.size(); ++j) {
+			lValues[j] = lGenotype[j].mValue;
+			lStrategies[j] = lGenotype[j].mStrategy;
+		}
+	}
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::packES(const Individual::Bag&, unsigned int, GA::PackedFloatVectors&)");
+}
+
+
+/*!
+ *  \brief Pack a float vector genotype of individuals.
+ *  \param inIndividuals Individuals to pack, one per row.
+ *  \param inGenotype Index of the float vector genotype to pack in the individuals.
+ *
+ *  An individual without the given genotype gives an empty row.
+ */
+void GA::PackedFloatVectors::packFloat(const Individual::Bag& inIndividuals, unsigned int inGenotype)
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lCols = 0;
+	for(unsigned int i=0; i<inIndividuals.size(); ++i) {
+		if(inGenotype >= inIndividuals[i]->size()) continue;
+		const GA::FloatVector* lGenotype =
+		    castObjectT<const GA::FloatVector*>((*inIndividuals[i])[inGenotype].getPointer());
+		lCols = maxOf<unsigned int>(lCols, lGenotype->size());
+	}
+	resize(inIndividuals.size(), lCols);
+	for(unsigned int i=0; i<inIndividuals.size(); ++i) {
+		if(inGenotype >= inIndividuals[i]->size()) {
+			mRowSizes[i] = 0;
+			continue;
+		}
+		const GA::FloatVector& lGenotype =
+		    castObjectT<const GA::FloatVector&>(*(*inIndividuals[i])[inGenotype]);
+		mRowSizes[i] = lGenotype.size();
+		if(mRowSizes[i] != 0) std::copy(lGenotype.begin(), lGenotype.end(), getRow(i));
+	}
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::packFloat(const Individual::Bag&, unsigned int)");
+}
+
+
+/*!
+ *  \brief Resize the matrix, with all values set to zero.
+ *  \param inRows Number of rows.
+ *  \param inCols Number of values of each row.
+ *
+ *  The storage is reused when it is large enough, so that packing the same population
+ *  generation after generation doesn't reallocate it.
+ */
+void GA::PackedFloatVectors::resize(unsigned int inRows, unsigned int inCols)
+{
+	Beagle_StackTraceBeginM();
+	mCols = inCols;
+	mStride = ((inCols + eAlignment - 1) / eAlignment) * eAlignment;
+	mRowSizes.assign(inRows, inCols);
+	const unsigned int lSize = inRows * mStride;
+	if(mStorage.size() < (lSize + eAlignment)) mStorage.resize(lSize + eAlignment);
+	const std::size_t lAddress = reinterpret_cast<std::size_t>(&mStorage[0]);
+	const std::size_t lAlignBytes = eAlignment * sizeof(double);
+	mOffset = ((lAlignBytes - (lAddress % lAlignBytes)) % lAlignBytes) / sizeof(double);
+	std::fill(mStorage.begin()+mOffset, mStorage.begin()+mOffset+lSize, 0.0);
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::resize(unsigned int, unsigned int)");
+}
+
+
+/*!
+ *  \brief Unpack the rows of the matrix into a float vector genotype of individuals.
+ *  \param ioIndividuals Individuals to unpack the rows into, one per row.
+ *  \param inGenotype Index of the float vector genotype to unpack into.
+ *
+ *  The genotypes are resized to the size of their row.
+ */
+void GA::PackedFloatVectors::unpackFloat(Individual::Bag& ioIndividuals, unsigned int inGenotype) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(ioIndividuals.size() == mRowSizes.size());
+	for(unsigned int i=0; i<ioIndividuals.size(); ++i) {
+		if(inGenotype >= ioIndividuals[i]->size()) continue;
+		GA::FloatVector::Handle lGenotype = castHandleT<GA::FloatVector>((*ioIndividuals[i])[inGenotype]);
+		const double* lRow = getRow(i);
+		lGenotype->assign(lRow, lRow+mRowSizes[i]);
+	}
+	Beagle_StackTraceEndM("void GA::PackedFloatVectors::unpackFloat(Individual::Bag&, unsigned int) const");
+}
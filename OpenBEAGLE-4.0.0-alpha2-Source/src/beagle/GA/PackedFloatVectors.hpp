@@ -0,0 +1,158 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/PackedFloatVectors.hpp
+ *  \brief  Definition of the class GA::PackedFloatVectors.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#ifndef Beagle_GA_PackedFloatVectors_hpp
+#define Beagle_GA_PackedFloatVectors_hpp
+
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Individual.hpp"
+
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class PackedFloatVectors beagle/GA/PackedFloatVectors.hpp "beagle/GA/PackedFloatVectors.hpp"
+ *  \brief Real-valued genotypes of a group of individuals packed into one contiguous matrix.
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Row i of the matrix holds the values of a given genotype of the ith individual. Rows are
+ *  aligned and padded with zeros to a multiple of eAlignment values, so that loops over the
+ *  whole matrix, or over a row, run on contiguous memory and can be vectorized. Rows may be
+ *  of different sizes, the size of each row being kept apart.
+ *
+ *  The matrix is a copy of the genotypes: they are packed before the population-wide
+ *  computation, and unpacked back into the individuals afterward if they were modified.
+ */
+class PackedFloatVectors
+{
+
+public:
+
+	enum {
+	    eAlignment = 4   //!< Alignment of the rows, in number of values.
+	};
+
+	PackedFloatVectors();
+
+	void clear();
+	void computeWeightedMean(const std::vector<double>& inWeights, std::vector<double>& outMean) const;
+	void packES(const Individual::Bag& inIndividuals, unsigned int inGenotype, PackedFloatVectors& outStrategies);
+	void packFloat(const Individual::Bag& inIndividuals, unsigned int inGenotype=0);
+	void resize(unsigned int inRows, unsigned int inCols);
+	void unpackFloat(Individual::Bag& ioIndividuals, unsigned int inGenotype=0) const;
+
+	/*!
+	 *  \return Number of values of the longest row.
+	 */
+	inline unsigned int getCols() const
+	{
+		return mCols;
+	}
+
+	/*!
+	 *  \return Number of rows, i.e. of individuals packed.
+	 */
+	inline unsigned int getRows() const
+	{
+		return mRowSizes.size();
+	}
+
+	/*!
+	 *  \param inRow Index of the row.
+	 *  \return Pointer to the first value of the row, aligned on eAlignment values.
+	 */
+	inline double* getRow(unsigned int inRow)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inRow,mRowSizes.size()-1);
+		return &mStorage[mOffset + inRow*mStride];
+		Beagle_StackTraceEndM("double* GA::PackedFloatVectors::getRow(unsigned int)");
+	}
+
+	/*!
+	 *  \param inRow Index of the row.
+	 *  \return Constant pointer to the first value of the row, aligned on eAlignment values.
+	 */
+	inline const double* getRow(unsigned int inRow) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inRow,mRowSizes.size()-1);
+		return &mStorage[mOffset + inRow*mStride];
+		Beagle_StackTraceEndM("const double* GA::PackedFloatVectors::getRow(unsigned int) const");
+	}
+
+	/*!
+	 *  \param inRow Index of the row.
+	 *  \return Number of values in the row.
+	 */
+	inline unsigned int getRowSize(unsigned int inRow) const
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inRow,mRowSizes.size()-1);
+		return mRowSizes[inRow];
+		Beagle_StackTraceEndM("unsigned int GA::PackedFloatVectors::getRowSize(unsigned int) const");
+	}
+
+	/*!
+	 *  \return Distance between the beginning of two consecutive rows, in number of values.
+	 */
+	inline unsigned int getStride() const
+	{
+		return mStride;
+	}
+
+protected:
+
+	std::vector<double>         mStorage;     //!< Values of the matrix, with room for the alignment.
+	std::vector<unsigned int>   mRowSizes;    //!< Number of values of each row.
+	mutable std::vector<double> mWeightSums;  //!< Sums of the weights of each column, kept for reuse.
+	unsigned int                mCols;        //!< Number of values of the longest row.
+	unsigned int                mStride;      //!< Distance between two consecutive rows.
+	unsigned int                mOffset;      //!< Index in the storage of the first aligned value.
+
+};
+
+}
+}
+
+#endif // Beagle_GA_PackedFloatVectors_hpp
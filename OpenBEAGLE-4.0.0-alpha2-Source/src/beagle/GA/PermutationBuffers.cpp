@@ -0,0 +1,91 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/src/PermutationBuffers.cpp
+ *  \brief  Source code of class GA::PermutationBuffers.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#include "beagle/GA.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct empty permutation work buffers.
+ */
+GA::PermutationBuffers::PermutationBuffers()
+{ }
+
+
+/*!
+ *  \brief Create one empty work buffer per thread.
+ *  \param ioSystem Evolutionary system.
+ *
+ *  The buffers are only grown on first use, to the size needed by the crossover.
+ */
+void GA::PermutationBuffers::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioSystem.getComponent("OpenMP"));
+	if(mBuffers.size() < lOpenMP->getMaxNumThreads()) mBuffers.resize(lOpenMP->getMaxNumThreads());
+#else
+	if(mBuffers.empty()) mBuffers.resize(1);
+#endif
+	Beagle_StackTraceEndM("void GA::PermutationBuffers::init(System&)");
+}
+
+
+/*!
+ *  \brief Get the work buffer of the calling thread.
+ *  \param inSize Number of values needed in the buffer.
+ *  \return Pointer to the first of at least inSize values, of unspecified content.
+ *
+ *  The buffer is only grown when needed, so that the pointer returned stays valid until
+ *  the next call by the same thread with a larger size. With OpenMP, the buffers of all the
+ *  threads must have been created by init(), as they are never added concurrently.
+ */
+unsigned int* GA::PermutationBuffers::getBuffer(unsigned int inSize)
+{
+	Beagle_StackTraceBeginM();
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	const unsigned int lThread = omp_get_thread_num();
+	Beagle_AssertM(mBuffers.empty() == false);
+	Beagle_UpperBoundCheckAssertM(lThread, mBuffers.size()-1);
+	std::vector<unsigned int>& lBuffer = mBuffers[lThread];
+#else
+	if(mBuffers.empty()) mBuffers.resize(1);
+	std::vector<unsigned int>& lBuffer = mBuffers[0];
+#endif
+	if(lBuffer.size() < inSize) lBuffer.resize(inSize);
+	return lBuffer.empty() ? NULL : &lBuffer[0];
+	Beagle_StackTraceEndM("unsigned int* GA::PermutationBuffers::getBuffer(unsigned int)");
+}
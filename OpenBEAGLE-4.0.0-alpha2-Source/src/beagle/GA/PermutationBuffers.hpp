@@ -0,0 +1,82 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/PermutationBuffers.hpp
+ *  \brief  Definition of the class GA::PermutationBuffers.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#ifndef Beagle_GA_PermutationBuffers_hpp
+#define Beagle_GA_PermutationBuffers_hpp
+
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/System.hpp"
+
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class PermutationBuffers beagle/GA/PermutationBuffers.hpp "beagle/GA/PermutationBuffers.hpp"
+ *  \brief Work buffers of the permutation crossover operators, one per thread.
+ *  \ingroup GAIV
+ *
+ *  Permutation crossovers need position-index arrays (the inverse permutations of the
+ *  genotypes mated) and some other temporaries of the size of the genotypes. These buffers
+ *  are kept between matings, so that a mating does no heap allocation once the buffers are
+ *  large enough. With OpenMP, crossovers are applied concurrently, so each thread gets its
+ *  own buffer.
+ */
+class PermutationBuffers
+{
+
+public:
+
+	PermutationBuffers();
+
+	void          init(System& ioSystem);
+	unsigned int* getBuffer(unsigned int inSize);
+
+protected:
+
+	std::vector< std::vector<unsigned int> > mBuffers;  //!< Work buffer of each thread.
+
+};
+
+}
+}
+
+#endif // Beagle_GA_PermutationBuffers_hpp
@@ -0,0 +1,85 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/src/RecombinationBuffers.cpp
+ *  \brief  Source code of class GA::RecombinationBuffers.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#include "beagle/GA.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct empty recombination work buffers.
+ */
+GA::RecombinationBuffers::RecombinationBuffers()
+{ }
+
+
+/*!
+ *  \brief Allocate one set of work buffers per thread.
+ *  \param ioSystem Evolutionary system.
+ */
+void GA::RecombinationBuffers::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioSystem.getComponent("OpenMP"));
+	if(mBuffers.size() < lOpenMP->getMaxNumThreads()) mBuffers.resize(lOpenMP->getMaxNumThreads());
+#else
+	if(mBuffers.empty()) mBuffers.resize(1);
+#endif
+	Beagle_StackTraceEndM("void GA::RecombinationBuffers::init(System&)");
+}
+
+
+/*!
+ *  \brief Get the work buffers of the calling thread.
+ *  \return Work buffers of the calling thread.
+ *
+ *  With OpenMP, the buffers of all the threads must have been created by init(), as they are
+ *  never added concurrently. The reference returned thus stays valid.
+ */
+GA::RecombinationBuffers::Buffers& GA::RecombinationBuffers::getBuffers()
+{
+	Beagle_StackTraceBeginM();
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	const unsigned int lThread = omp_get_thread_num();
+	Beagle_AssertM(mBuffers.empty() == false);
+	Beagle_UpperBoundCheckAssertM(lThread, mBuffers.size()-1);
+	return mBuffers[lThread];
+#else
+	if(mBuffers.empty()) mBuffers.resize(1);
+	return mBuffers[0];
+#endif
+	Beagle_StackTraceEndM("GA::RecombinationBuffers::Buffers& GA::RecombinationBuffers::getBuffers()");
+}
@@ -0,0 +1,95 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/RecombinationBuffers.hpp
+ *  \brief  Definition of the class GA::RecombinationBuffers.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#ifndef Beagle_GA_RecombinationBuffers_hpp
+#define Beagle_GA_RecombinationBuffers_hpp
+
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/System.hpp"
+#include "beagle/GA/PackedFloatVectors.hpp"
+
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class RecombinationBuffers beagle/GA/RecombinationBuffers.hpp "beagle/GA/RecombinationBuffers.hpp"
+ *  \brief Work buffers of the real-valued recombination operators, one set per thread.
+ *  \ingroup GAF
+ *  \ingroup GAFV
+ *
+ *  Recombination packs the parents genotypes into matrices and computes the child as their
+ *  mean. The matrices and means are kept between recombinations, so that a recombination
+ *  only allocates the child once the buffers are large enough. Each thread gets its own set
+ *  of buffers, in case recombinations are applied concurrently.
+ */
+class RecombinationBuffers
+{
+
+public:
+
+	/*!
+	 *  \brief Work buffers of one thread.
+	 */
+	struct Buffers
+	{
+		PackedFloatVectors  mValues;          //!< Packed float vectors, or values of ES vectors.
+		PackedFloatVectors  mStrategies;      //!< Packed strategy parameters of ES vectors.
+		std::vector<double> mMeanValues;      //!< Mean of the packed values.
+		std::vector<double> mMeanStrategies;  //!< Mean of the packed strategy parameters.
+		std::vector<double> mWeights;         //!< Weights of the parents.
+	};
+
+	RecombinationBuffers();
+
+	void     init(System& ioSystem);
+	Buffers& getBuffers();
+
+protected:
+
+	std::vector<Buffers> mBuffers;  //!< Work buffers of each thread.
+
+};
+
+}
+}
+
+#endif // Beagle_GA_RecombinationBuffers_hpp
@@ -56,6 +56,19 @@ Beagle::GA::RecombinationFltVecOp::RecombinationFltVecOp(std::string inRecombPbN
 { }
 
 
+/*!
+ *  \brief Initialize the operator.
+ *  \param ioSystem Evolutionary system.
+ */
+void Beagle::GA::RecombinationFltVecOp::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	RecombinationOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::RecombinationFltVecOp::init(System&)");
+}
+
+
 /*!
  *  \brief Recombine individuals by averaging to generate a new individual.
  *  \param inIndivPool Parents being recombined.
@@ -67,44 +80,25 @@ Individual::Handle Beagle::GA::RecombinationFltVecOp::recombine(Individual::Bag&
 {
 	Beagle_StackTraceBeginM();
 
-	// Recombine parents to generate new individual.
+	// Recombine parents to generate new individual, a genotype at a time on packed rows.
 	const Factory& lFactory = ioContext.getSystem().getFactory();
 	Individual::Alloc::Handle lIndivAlloc =
 	    castHandleT<Individual::Alloc>(lFactory.getConceptAllocator("Individual"));
 	Genotype::Alloc::Handle lGenotypeAlloc =
 		castHandleT<Genotype::Alloc>(lFactory.getConceptAllocator("Genotype"));
 	Individual::Handle lChildIndiv = castHandleT<Individual>(lIndivAlloc->allocate());
-	std::vector< std::vector<unsigned int> > lCountGenoSum;
+	unsigned int lNbGenotypes = 0;
 	for(unsigned int i=0; i<inIndivPool.size(); ++i) {
-		const unsigned int lPoolISize = inIndivPool[i]->size();
-		const unsigned int lChildSize = lChildIndiv->size();
-		if(lPoolISize > lChildSize) {
-			lCountGenoSum.resize(lPoolISize);
-			lChildIndiv->resize(lPoolISize);
-			for(unsigned int j=lChildSize; j<lPoolISize; ++j) {
-				(*lChildIndiv)[j] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
-			}
-		}
-		for(unsigned int j=0; j<lPoolISize; ++j) {
-			GA::FloatVector::Handle lChildGenoJ = castHandleT<GA::FloatVector>((*lChildIndiv)[j]);
-			GA::FloatVector::Handle lPoolIGenoJ = castHandleT<GA::FloatVector>((*inIndivPool[i])[j]);
-			const unsigned int lPoolIGenoJSize = lPoolIGenoJ->size();
-			if(lPoolIGenoJSize > lChildGenoJ->size()) {
-				lChildGenoJ->resize(lPoolIGenoJSize,0.0);
-				lCountGenoSum[j].resize(lPoolIGenoJSize,0);
-			}
-			for(unsigned int k=0; k<lPoolIGenoJSize; ++k) {
-				(*lChildGenoJ)[k] += (*lPoolIGenoJ)[k];
-				++lCountGenoSum[j][k];
-			}
-
-		}
+		lNbGenotypes = maxOf<unsigned int>(lNbGenotypes, inIndivPool[i]->size());
 	}
-	for(unsigned int i=0; i<lChildIndiv->size(); ++i) {
-		GA::FloatVector::Handle lChildGenoI = castHandleT<GA::FloatVector>((*lChildIndiv)[i]);
-		for(unsigned int j=0; j<lChildGenoI->size(); ++j) {
-			(*lChildGenoI)[j] /= double(lCountGenoSum[i][j]);
-		}
+	lChildIndiv->resize(lNbGenotypes);
+	RecombinationBuffers::Buffers& lBuffers = mBuffers.getBuffers();
+	lBuffers.mWeights.clear();
+	for(unsigned int j=0; j<lNbGenotypes; ++j) {
+		GA::FloatVector::Handle lChildGenoJ = castHandleT<GA::FloatVector>(lGenotypeAlloc->allocate());
+		lBuffers.mValues.packFloat(inIndivPool, j);
+		lBuffers.mValues.computeWeightedMean(lBuffers.mWeights, *lChildGenoJ);
+		(*lChildIndiv)[j] = lChildGenoJ;
 	}
 
 	Beagle_LogDebugM(
@@ -56,6 +56,19 @@ Beagle::GA::RecombinationWeightedESVecOp::RecombinationWeightedESVecOp(std::stri
 { }
 
 
+/*!
+ *  \brief Initialize the operator.
+ *  \param ioSystem Evolutionary system.
+ */
+void Beagle::GA::RecombinationWeightedESVecOp::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	RecombinationOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::RecombinationWeightedESVecOp::init(System&)");
+}
+
+
 /*!
  *  \brief Recombine individuals by weighted mean to generate a new individual.
  *  \param inIndivPool Parents being recombined.
@@ -68,52 +81,39 @@ Individual::Handle Beagle::GA::RecombinationWeightedESVecOp::recombine(Individua
 	Beagle_StackTraceBeginM();
 
 	// Compute recombination weights.
-	std::vector<double> lWeights(inIndivPool.size());
+	RecombinationBuffers::Buffers& lBuffers = mBuffers.getBuffers();
+	std::vector<double>& lWeights = lBuffers.mWeights;
+	lWeights.resize(inIndivPool.size());
 	for(unsigned int i=0; i<lWeights.size(); ++i) {
 		lWeights[i] =  std::log(double(lWeights.size()+1));
 		lWeights[i] -= std::log(double(i+1));
 	}
 
-	// Recombine parents to generate new individual.
+	// Recombine parents to generate new individual, a genotype at a time on packed rows.
 	const Factory& lFactory = ioContext.getSystem().getFactory();
 	Individual::Alloc::Handle lIndivAlloc =
 	    castHandleT<Individual::Alloc>(lFactory.getConceptAllocator("Individual"));
 	Genotype::Alloc::Handle lGenotypeAlloc =
 		castHandleT<Genotype::Alloc>(lFactory.getConceptAllocator("Genotype"));
 	Individual::Handle lChildIndiv = castHandleT<Individual>(lIndivAlloc->allocate());
-	std::vector< std::vector<double> > lCountGenoSum;
+	unsigned int lNbGenotypes = 0;
 	for(unsigned int i=0; i<inIndivPool.size(); ++i) {
-		const unsigned int lPoolISize = inIndivPool[i]->size();
-		const unsigned int lChildSize = lChildIndiv->size();
-		if(lPoolISize > lChildSize) {
-			lCountGenoSum.resize(lPoolISize);
-			lChildIndiv->resize(lPoolISize);
-			for(unsigned int j=lChildSize; j<lPoolISize; ++j) {
-				(*lChildIndiv)[j] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
-			}
-		}
-		for(unsigned int j=0; j<lPoolISize; ++j) {
-			GA::ESVector::Handle lChildGenoJ = castHandleT<GA::ESVector>((*lChildIndiv)[j]);
-			GA::ESVector::Handle lPoolIGenoJ = castHandleT<GA::ESVector>((*inIndivPool[i])[j]);
-			const unsigned int lPoolIGenoJSize = lPoolIGenoJ->size();
-			if(lPoolIGenoJSize > lChildGenoJ->size()) {
-				lChildGenoJ->resize(lPoolIGenoJSize,0.0);
-				lCountGenoSum[j].resize(lPoolIGenoJSize,0);
-			}
-			for(unsigned int k=0; k<lPoolIGenoJSize; ++k) {
-				(*lChildGenoJ)[k].mValue += (lWeights[i] * (*lPoolIGenoJ)[k].mValue);
-				(*lChildGenoJ)[k].mStrategy += (lWeights[i] * (*lPoolIGenoJ)[k].mStrategy);
-				lCountGenoSum[j][k] += lWeights[i];
-			}
-
-		}
+		lNbGenotypes = maxOf<unsigned int>(lNbGenotypes, inIndivPool[i]->size());
 	}
-	for(unsigned int i=0; i<lChildIndiv->size(); ++i) {
-		GA::ESVector::Handle lChildGenoI = castHandleT<GA::ESVector>((*lChildIndiv)[i]);
-		for(unsigned int j=0; j<lChildGenoI->size(); ++j) {
-			(*lChildGenoI)[j].mValue /= lCountGenoSum[i][j];
-			(*lChildGenoI)[j].mStrategy /= lCountGenoSum[i][j];
+	lChildIndiv->resize(lNbGenotypes);
+	std::vector<double>& lMeanValues = lBuffers.mMeanValues;
+	std::vector<double>& lMeanStrategies = lBuffers.mMeanStrategies;
+	for(unsigned int j=0; j<lNbGenotypes; ++j) {
+		lBuffers.mValues.packES(inIndivPool, j, lBuffers.mStrategies);
+		lBuffers.mValues.computeWeightedMean(lWeights, lMeanValues);
+		lBuffers.mStrategies.computeWeightedMean(lWeights, lMeanStrategies);
+		GA::ESVector::Handle lChildGenoJ = castHandleT<GA::ESVector>(lGenotypeAlloc->allocate());
+		lChildGenoJ->resize(lMeanValues.size());
+		for(unsigned int k=0; k<lMeanValues.size(); ++k) {
+			(*lChildGenoJ)[k].mValue = lMeanValues[k];
+			(*lChildGenoJ)[k].mStrategy = lMeanStrategies[k];
 		}
+		(*lChildIndiv)[j] = lChildGenoJ;
 	}
 
 	Beagle_LogDebugM(
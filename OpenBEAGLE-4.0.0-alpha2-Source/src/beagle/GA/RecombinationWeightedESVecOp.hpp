@@ -41,6 +41,7 @@
 #include "beagle/macros.hpp"
 #include "beagle/Object.hpp"
 #include "beagle/RecombinationOp.hpp"
+#include "beagle/GA/RecombinationBuffers.hpp"
 
 namespace Beagle
 {
@@ -75,8 +76,13 @@ public:
 	virtual ~RecombinationWeightedESVecOp()
 	{ }
 
+	virtual void               init(System& ioSystem);
 	virtual Individual::Handle recombine(Individual::Bag& inIndivPool, Context& ioContext);
 
+protected:
+
+	RecombinationBuffers mBuffers;  //!< Work buffers of the recombination, reused between calls.
+
 };
 
 }
@@ -56,6 +56,19 @@ Beagle::GA::RecombinationWeightedFltVecOp::RecombinationWeightedFltVecOp(std::st
 { }
 
 
+/*!
+ *  \brief Initialize the operator.
+ *  \param ioSystem Evolutionary system.
+ */
+void Beagle::GA::RecombinationWeightedFltVecOp::init(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	RecombinationOp::init(ioSystem);
+	mBuffers.init(ioSystem);
+	Beagle_StackTraceEndM("void GA::RecombinationWeightedFltVecOp::init(System&)");
+}
+
+
 /*!
  *  \brief Recombine individuals by weighted mean to generate a new individual.
  *  \param inIndivPool Parents being recombined.
@@ -68,50 +81,31 @@ Individual::Handle Beagle::GA::RecombinationWeightedFltVecOp::recombine(Individu
 	Beagle_StackTraceBeginM();
 
 	// Compute recombination weights.
-	std::vector<double> lWeights(inIndivPool.size());
+	RecombinationBuffers::Buffers& lBuffers = mBuffers.getBuffers();
+	std::vector<double>& lWeights = lBuffers.mWeights;
+	lWeights.resize(inIndivPool.size());
 	for(unsigned int i=0; i<lWeights.size(); ++i) {
 		lWeights[i] =  std::log(double(lWeights.size()+1));
 		lWeights[i] -= std::log(double(i+1));
 	}
 
-	// Recombine parents to generate new individual.
+	// Recombine parents to generate new individual, a genotype at a time on packed rows.
 	const Factory& lFactory = ioContext.getSystem().getFactory();
 	Individual::Alloc::Handle lIndivAlloc =
 	    castHandleT<Individual::Alloc>(lFactory.getConceptAllocator("Individual"));
 	Genotype::Alloc::Handle lGenotypeAlloc =
 		castHandleT<Genotype::Alloc>(lFactory.getConceptAllocator("Genotype"));
 	Individual::Handle lChildIndiv = castHandleT<Individual>(lIndivAlloc->allocate());
-	std::vector< std::vector<double> > lCountGenoSum;
+	unsigned int lNbGenotypes = 0;
 	for(unsigned int i=0; i<inIndivPool.size(); ++i) {
-		const unsigned int lPoolISize = inIndivPool[i]->size();
-		const unsigned int lChildSize = lChildIndiv->size();
-		if(lPoolISize > lChildSize) {
-			lCountGenoSum.resize(lPoolISize);
-			lChildIndiv->resize(lPoolISize);
-			for(unsigned int j=lChildSize; j<lPoolISize; ++j) {
-				(*lChildIndiv)[j] = castHandleT<Genotype>(lGenotypeAlloc->allocate());
-			}
-		}
-		for(unsigned int j=0; j<lPoolISize; ++j) {
-			GA::FloatVector::Handle lChildGenoJ = castHandleT<GA::FloatVector>((*lChildIndiv)[j]);
-			GA::FloatVector::Handle lPoolIGenoJ = castHandleT<GA::FloatVector>((*inIndivPool[i])[j]);
-			const unsigned int lPoolIGenoJSize = lPoolIGenoJ->size();
-			if(lPoolIGenoJSize > lChildGenoJ->size()) {
-				lChildGenoJ->resize(lPoolIGenoJSize,0.0);
-				lCountGenoSum[j].resize(lPoolIGenoJSize,0);
-			}
-			for(unsigned int k=0; k<lPoolIGenoJSize; ++k) {
-				(*lChildGenoJ)[k] += (lWeights[i] * (*lPoolIGenoJ)[k]);
-				lCountGenoSum[j][k] += lWeights[i];
-			}
-
-		}
+		lNbGenotypes = maxOf<unsigned int>(lNbGenotypes, inIndivPool[i]->size());
 	}
-	for(unsigned int i=0; i<lChildIndiv->size(); ++i) {
-		GA::FloatVector::Handle lChildGenoI = castHandleT<GA::FloatVector>((*lChildIndiv)[i]);
-		for(unsigned int j=0; j<lChildGenoI->size(); ++j) {
-			(*lChildGenoI)[j] /= lCountGenoSum[i][j];
-		}
+	lChildIndiv->resize(lNbGenotypes);
+	for(unsigned int j=0; j<lNbGenotypes; ++j) {
+		GA::FloatVector::Handle lChildGenoJ = castHandleT<GA::FloatVector>(lGenotypeAlloc->allocate());
+		lBuffers.mValues.packFloat(inIndivPool, j);
+		lBuffers.mValues.computeWeightedMean(lWeights, *lChildGenoJ);
+		(*lChildIndiv)[j] = lChildGenoJ;
 	}
 
 	Beagle_LogDebugM(
@@ -0,0 +1,255 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/src/SequenceDelta.cpp
+ *  \brief  Source code of class GA::SequenceDelta.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/10 20:32:21 $
+ */
+
+#include "beagle/GA.hpp"
+
+#include <algorithm>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Attach a new sequence delta to an individual of valid fitness.
+ *  \param ioIndividual Individual about to be modified.
+ *  \return Sequence delta in which to record the changes, NULL if the fitness of the
+ *    individual is not valid or if its genotypes are not all integer vectors, in which case
+ *    the changes are not to be recorded.
+ */
+GA::SequenceDelta::Handle GA::SequenceDelta::attach(Individual& ioIndividual)
+{
+	Beagle_StackTraceBeginM();
+	if((ioIndividual.getFitness() == NULL) || (ioIndividual.getFitness()->isValid() == false)) {
+		return NULL;
+	}
+	for(unsigned int i=0; i<ioIndividual.size(); ++i) {
+		if(dynamic_cast<GA::IntegerVector*>(ioIndividual[i].getPointer()) == NULL) return NULL;
+	}
+	ioIndividual.removeMember("FitnessDelta");
+	GA::SequenceDelta::Handle lDelta = new GA::SequenceDelta;
+	ioIndividual.addMember(lDelta);
+	return lDelta;
+	Beagle_StackTraceEndM("GA::SequenceDelta::Handle GA::SequenceDelta::attach(Individual&)");
+}
+
+
+/*!
+ *  \brief Make a copy of given sequence delta.
+ *  \param inOriginal Sequence delta to copy.
+ *  \param ioSystem Evolutionary system.
+ */
+void GA::SequenceDelta::copy(const Member& inOriginal, System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	const GA::SequenceDelta& lOriginal = castObjectT<const GA::SequenceDelta&>(inOriginal);
+	mAddedLinks = lOriginal.mAddedLinks;
+	mRemovedLinks = lOriginal.mRemovedLinks;
+	Beagle_StackTraceEndM("void GA::SequenceDelta::copy(const Member&,System&)");
+}
+
+
+/*!
+ *  \return Exact type of the sequence delta, "GA-SequenceDelta".
+ */
+const std::string& GA::SequenceDelta::getType() const
+{
+	Beagle_StackTraceBeginM();
+	const static std::string lType("GA-SequenceDelta");
+	return lType;
+	Beagle_StackTraceEndM("const std::string& GA::SequenceDelta::getType() const");
+}
+
+
+/*!
+ *  \brief Read sequence delta from XML.
+ *  \param inIter Iterator to XML structure to read sequence delta from.
+ *  \param ioContext Evolutionary context.
+ *  \throw Beagle::IOException If XML format is not valid.
+ */
+void GA::SequenceDelta::readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if((inIter->getType()!=PACC::XML::eData) || (inIter->getValue()!=getName())) {
+		std::ostringstream lOSS;
+		lOSS << "tag <" << getName() << "> expected!";
+		throw Beagle_IOExceptionNodeM(*inIter, lOSS.str());
+	}
+	std::string lType = inIter->getAttribute("type");
+	if((lType.empty()==false) && (lType!=getType())) {
+		std::ostringstream lOSS;
+		lOSS << "type given '" << lType << "' mismatch type of the sequence delta '";
+		lOSS << getType() << "'!";
+		throw Beagle_IOExceptionNodeM(*inIter, lOSS.str());
+	}
+	mAddedLinks.clear();
+	mRemovedLinks.clear();
+	for(PACC::XML::ConstIterator lChild=inIter->getFirstChild(); lChild; ++lChild) {
+		if(lChild->getType() != PACC::XML::eData) continue;
+		const bool lAdded = (lChild->getValue() == "Added");
+		if((lAdded == false) && (lChild->getValue() != "Removed")) {
+			throw Beagle_IOExceptionNodeM(*lChild, "tag <Added> or <Removed> expected!");
+		}
+		Link lLink;
+		lLink.mGenotype = str2uint(lChild->getAttribute("genotype"));
+		lLink.mFirst = str2int(lChild->getAttribute("first"));
+		lLink.mSecond = str2int(lChild->getAttribute("second"));
+		if(lAdded) mAddedLinks.push_back(lLink);
+		else mRemovedLinks.push_back(lLink);
+	}
+	Beagle_StackTraceEndM("void GA::SequenceDelta::readWithContext(PACC::XML::ConstIterator,Context&)");
+}
+
+
+/*!
+ *  \brief Record the exchange of two adjacent blocks of an integer vector.
+ *  \param inVector Integer vector, before the exchange.
+ *  \param inGenotype Index of the integer vector in the individual.
+ *  \param inBegin Index of the first element of the first block.
+ *  \param inMiddle Index of the first element of the second block.
+ *  \param inEnd Index following the last element of the second block.
+ *
+ *  Moving a sequence of an integer vector is an exchange of the sequence with the adjacent
+ *  block it is moved over.
+ */
+void GA::SequenceDelta::recordBlockExchange(const IntegerVector& inVector,
+        unsigned int inGenotype,
+        unsigned int inBegin,
+        unsigned int inMiddle,
+        unsigned int inEnd)
+{
+	Beagle_StackTraceBeginM();
+	if((inBegin >= inMiddle) || (inMiddle >= inEnd)) return;
+	const int lBeforeBegin = getElement(inVector, int(inBegin)-1);
+	const int lBegin       = getElement(inVector, inBegin);
+	const int lBeforeMid   = getElement(inVector, int(inMiddle)-1);
+	const int lMiddle      = getElement(inVector, inMiddle);
+	const int lBeforeEnd   = getElement(inVector, int(inEnd)-1);
+	const int lEnd         = getElement(inVector, inEnd);
+	mRemovedLinks.push_back(Link(inGenotype, lBeforeBegin, lBegin));
+	mRemovedLinks.push_back(Link(inGenotype, lBeforeMid, lMiddle));
+	mRemovedLinks.push_back(Link(inGenotype, lBeforeEnd, lEnd));
+	mAddedLinks.push_back(Link(inGenotype, lBeforeBegin, lMiddle));
+	mAddedLinks.push_back(Link(inGenotype, lBeforeEnd, lBegin));
+	mAddedLinks.push_back(Link(inGenotype, lBeforeMid, lEnd));
+	Beagle_StackTraceEndM("void GA::SequenceDelta::recordBlockExchange(const IntegerVector&,unsigned int,unsigned int,unsigned int,unsigned int)");
+}
+
+
+/*!
+ *  \brief Record the reversal of a sequence of an integer vector.
+ *  \param inVector Integer vector, before the reversal.
+ *  \param inGenotype Index of the integer vector in the individual.
+ *  \param inFirst Index of the first element of the sequence reversed.
+ *  \param inLast Index of the last element of the sequence reversed.
+ */
+void GA::SequenceDelta::recordReversal(const IntegerVector& inVector,
+                                       unsigned int inGenotype,
+                                       unsigned int inFirst,
+                                       unsigned int inLast)
+{
+	Beagle_StackTraceBeginM();
+	if(inFirst >= inLast) return;
+	const int lBefore = getElement(inVector, int(inFirst)-1);
+	const int lFirst  = getElement(inVector, inFirst);
+	const int lLast   = getElement(inVector, inLast);
+	const int lAfter  = getElement(inVector, inLast+1);
+	mRemovedLinks.push_back(Link(inGenotype, lBefore, lFirst));
+	mRemovedLinks.push_back(Link(inGenotype, lLast, lAfter));
+	mAddedLinks.push_back(Link(inGenotype, lBefore, lLast));
+	mAddedLinks.push_back(Link(inGenotype, lFirst, lAfter));
+	Beagle_StackTraceEndM("void GA::SequenceDelta::recordReversal(const IntegerVector&,unsigned int,unsigned int,unsigned int)");
+}
+
+
+/*!
+ *  \brief Record the swap of two elements of an integer vector.
+ *  \param inVector Integer vector, before the swap.
+ *  \param inGenotype Index of the integer vector in the individual.
+ *  \param inI Index of the first element swapped.
+ *  \param inJ Index of the second element swapped.
+ */
+void GA::SequenceDelta::recordSwap(const IntegerVector& inVector,
+                                   unsigned int inGenotype,
+                                   unsigned int inI,
+                                   unsigned int inJ)
+{
+	Beagle_StackTraceBeginM();
+	if(inI > inJ) std::swap(inI, inJ);
+	if(inI == inJ) return;
+	if((inI+1) == inJ) {
+		recordReversal(inVector, inGenotype, inI, inJ);
+		return;
+	}
+	const int lBeforeI = getElement(inVector, int(inI)-1);
+	const int lI       = getElement(inVector, inI);
+	const int lAfterI  = getElement(inVector, inI+1);
+	const int lBeforeJ = getElement(inVector, int(inJ)-1);
+	const int lJ       = getElement(inVector, inJ);
+	const int lAfterJ  = getElement(inVector, inJ+1);
+	mRemovedLinks.push_back(Link(inGenotype, lBeforeI, lI));
+	mRemovedLinks.push_back(Link(inGenotype, lI, lAfterI));
+	mRemovedLinks.push_back(Link(inGenotype, lBeforeJ, lJ));
+	mRemovedLinks.push_back(Link(inGenotype, lJ, lAfterJ));
+	mAddedLinks.push_back(Link(inGenotype, lBeforeI, lJ));
+	mAddedLinks.push_back(Link(inGenotype, lJ, lAfterI));
+	mAddedLinks.push_back(Link(inGenotype, lBeforeJ, lI));
+	mAddedLinks.push_back(Link(inGenotype, lI, lAfterJ));
+	Beagle_StackTraceEndM("void GA::SequenceDelta::recordSwap(const IntegerVector&,unsigned int,unsigned int,unsigned int)");
+}
+
+
+/*!
+ *  \brief Write sequence delta into XML.
+ *  \param ioStreamer XML streamer to write sequence delta into.
+ *  \param inIndent Whether XML output should be indented.
+ */
+void GA::SequenceDelta::writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<mRemovedLinks.size(); ++i) {
+		ioStreamer.openTag("Removed", inIndent);
+		ioStreamer.insertAttribute("genotype", uint2str(mRemovedLinks[i].mGenotype));
+		ioStreamer.insertAttribute("first", int2str(mRemovedLinks[i].mFirst));
+		ioStreamer.insertAttribute("second", int2str(mRemovedLinks[i].mSecond));
+		ioStreamer.closeTag();
+	}
+	for(unsigned int i=0; i<mAddedLinks.size(); ++i) {
+		ioStreamer.openTag("Added", inIndent);
+		ioStreamer.insertAttribute("genotype", uint2str(mAddedLinks[i].mGenotype));
+		ioStreamer.insertAttribute("first", int2str(mAddedLinks[i].mFirst));
+		ioStreamer.insertAttribute("second", int2str(mAddedLinks[i].mSecond));
+		ioStreamer.closeTag();
+	}
+	Beagle_StackTraceEndM("void GA::SequenceDelta::writeContent(PACC::XML::Streamer&,bool) const");
+}
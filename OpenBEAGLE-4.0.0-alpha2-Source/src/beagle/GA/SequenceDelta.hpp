@@ -0,0 +1,163 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GA/SequenceDelta.hpp
+ *  \brief  Definition of the class GA::SequenceDelta.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: 1.1 $
+ *  $Date: 2007/08/08 19:26:34 $
+ */
+
+#ifndef Beagle_GA_SequenceDelta_hpp
+#define Beagle_GA_SequenceDelta_hpp
+
+#include <climits>
+#include <string>
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Individual.hpp"
+#include "beagle/FitnessDelta.hpp"
+#include "beagle/GA/IntegerVector.hpp"
+
+
+namespace Beagle
+{
+namespace GA
+{
+
+/*!
+ *  \class SequenceDelta beagle/GA/SequenceDelta.hpp "beagle/GA/SequenceDelta.hpp"
+ *  \brief Links between consecutive elements of integer vectors removed and added by
+ *    sequence mutations, since the fitness was last valid.
+ *  \ingroup GAF
+ *  \ingroup GAIV
+ *
+ *  An integer vector is seen as an open path whose both ends are linked to an exterior
+ *  node, noted eExterior. The reversal, move and swap mutations of a sequence change only a
+ *  few links of the path, whatever its size. Recording the links removed and added, by the
+ *  values of their elements, lets an evaluation operator whose fitness is a sum of costs over
+ *  the links, such as a symmetric tour length, update the former fitness in constant time.
+ *  The links of a reversed sequence are considered unchanged, their direction aside.
+ *
+ *  The changes must be recorded before being applied to the integer vector.
+ */
+class SequenceDelta : public FitnessDelta
+{
+
+public:
+
+	//! GA::SequenceDelta allocator type.
+	typedef AllocatorT<SequenceDelta,FitnessDelta::Alloc> Alloc;
+	//! GA::SequenceDelta handle type.
+	typedef PointerT<SequenceDelta,FitnessDelta::Handle> Handle;
+	//! GA::SequenceDelta bag type.
+	typedef ContainerT<SequenceDelta,FitnessDelta::Bag> Bag;
+
+	//! Value of the exterior node linked to both ends of the integer vectors.
+	enum {eExterior=INT_MIN};
+
+	/*!
+	 *  \brief Link between two consecutive elements of an integer vector.
+	 */
+	struct Link
+	{
+		unsigned int mGenotype;  //!< Index of the integer vector in the individual.
+		int          mFirst;     //!< Value of the first element linked.
+		int          mSecond;    //!< Value of the second element linked.
+
+		Link(unsigned int inGenotype=0, int inFirst=eExterior, int inSecond=eExterior) :
+			mGenotype(inGenotype),
+			mFirst(inFirst),
+			mSecond(inSecond)
+		{ }
+	};
+
+	SequenceDelta()
+	{ }
+	virtual ~SequenceDelta()
+	{ }
+
+	static Handle attach(Individual& ioIndividual);
+
+	virtual void                copy(const Member& inOriginal, System& ioSystem);
+	virtual const std::string&  getType() const;
+	virtual void                readWithContext(PACC::XML::ConstIterator inIter, Context& ioContext);
+	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
+
+	void recordBlockExchange(const IntegerVector& inVector, unsigned int inGenotype,
+	                         unsigned int inBegin, unsigned int inMiddle, unsigned int inEnd);
+	void recordReversal(const IntegerVector& inVector, unsigned int inGenotype,
+	                    unsigned int inFirst, unsigned int inLast);
+	void recordSwap(const IntegerVector& inVector, unsigned int inGenotype,
+	                unsigned int inI, unsigned int inJ);
+
+	/*!
+	 *  \return Links added to the integer vectors.
+	 */
+	inline const std::vector<Link>& getAddedLinks() const
+	{
+		return mAddedLinks;
+	}
+
+	/*!
+	 *  \return Links removed from the integer vectors.
+	 */
+	inline const std::vector<Link>& getRemovedLinks() const
+	{
+		return mRemovedLinks;
+	}
+
+protected:
+
+	/*!
+	 *  \brief Get an element of an integer vector, the exterior node outside of it.
+	 *  \param inVector Integer vector.
+	 *  \param inIndex Index of the element, possibly -1 or the size of the vector.
+	 *  \return Value of the element, eExterior if the index is outside of the vector.
+	 */
+	static inline int getElement(const IntegerVector& inVector, int inIndex)
+	{
+		if((inIndex < 0) || (inIndex >= int(inVector.size()))) return eExterior;
+		return inVector[inIndex];
+	}
+
+	std::vector<Link> mAddedLinks;    //!< Links added, in the order of the changes.
+	std::vector<Link> mRemovedLinks;  //!< Links removed, in the order of the changes.
+
+};
+
+}
+}
+
+#endif // Beagle_GA_SequenceDelta_hpp
@@ -128,7 +128,7 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	GA::CMAValues& lValues = lIterVal->second;
 
 	// Get dimensionality of the problem.
-	const unsigned int lN = lValues.mD.size();
+	const unsigned int lN = lValues.getDimension();
 	if(lN == 0) {
 		std::ostringstream lOSS;
 		lOSS << "CMA-ES termination criteria not tested as the dimensionality of CMA values for holder ";
@@ -142,18 +142,21 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 		return false;
 	}
 
-	// Compute some general matrices used to evaluate termination conditions.
-	Matrix lC, lBDt, lBD(lN,lN,0.0);
-	for(unsigned int i=0; i<lN; ++i) {
-		for(unsigned int j=0; j<lN; ++j) lBD(j,i) = lValues.mB(j,i) * lValues.mD[i];
-	}
-	lBD.transpose(lBDt);
-	lBD.multiply(lC, lBDt);
+	// Get the diagonal of C, used to evaluate termination conditions. With the full model,
+	// it is read from the up-to-date C when available, as B and D are only refreshed at the
+	// lazy decompositions.
+	std::vector<double> lCii;
+	lValues.getCovarianceDiagonal(lCii);
+
+	// The principal components of C are known, through B and D, except for the
+	// limited-memory model, for which the conditioncov and noeffectaxis criteria are skipped.
+	const bool lHasPrincipalAxes = (lValues.mModel != GA::CMAValues::eLimitedMemoryModel);
 
-	// conditioncov: whether condition number of matrix C exceed some value.
+	// conditioncov: whether condition number of matrix C exceed some value. The eigenvalues
+	// are those of the last decomposition of C.
 	double lNormC  = 0.0;
 	double lNormCi = 0.0;
-	for(unsigned int i=0; i<lN; ++i) {
+	for(unsigned int i=0; lHasPrincipalAxes && (i<lN); ++i) {
 		const double ldi2 = lValues.mD[i] * lValues.mD[i];
 		if(ldi2 > lNormC) lNormC = ldi2;
 		if((1.0/ldi2) > lNormCi) lNormCi = (1.0 / ldi2);
@@ -181,7 +184,7 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	// distribution on all components is smaller than TolX.
 	unsigned int lTolXCiiCount=0;
 	for(unsigned int i=0; i<lN; ++i) {
-		if((lSigma_g * std::sqrt(lC(i,i))) < lTolVal) ++lTolXCiiCount;
+		if((lSigma_g * std::sqrt(lCii[i])) < lTolVal) ++lTolXCiiCount;
 		else break;
 	}
 
@@ -196,7 +199,7 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 		std::ostringstream lOSS;
 		lOSS << "Terminating as all standard deviations of matrix C (i.e. C(i,i) * sigma_g) (";
 		for(unsigned int i=0; i<lN; ++i) {
-			lOSS << (lSigma_g * std::sqrt(lC(i,i)));
+			lOSS << (lSigma_g * std::sqrt(lCii[i]));
 			if(i!=(lN-1)) lOSS << ";";
 		}
 		lOSS << ") and all components of cumulation path (i.e. |sigma_g * P_c|) (";
@@ -214,16 +217,17 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 		return true;
 	}
 
-	// noeffectaxis: whether modifications over all the principal components of C
-	// does not change xmean.
+	// noeffectaxis: whether modifications over all the principal components of C, as of
+	// its last decomposition, does not change xmean.
+	// With the separable model, B is the identity.
 	unsigned int lNoEffectAxisCount = 0;
-	for(unsigned int i=0; i<lN; ++i) {
-		Vector lBDColI;
-		lBD.extractColumn((Matrix&)lBDColI, i);
-		lBDColI *= lValues.mSigma.getWrappedValue();
+	for(unsigned int i=0; lHasPrincipalAxes && (i<lN); ++i) {
+		const double lSigmaDi = lValues.mSigma.getWrappedValue() * lValues.mD[i];
 		unsigned int lNoEffectAxisCountJ = 0;
 		for(unsigned int j=0; j<lN; ++j) {
-			double lXModJ = lValues.mXmean[j] + lBDColI[j];
+			const double lBji = (lValues.mModel == GA::CMAValues::eSeparableModel) ?
+			                    ((i==j) ? 1.0 : 0.0) : lValues.mB(j,i);
+			double lXModJ = lValues.mXmean[j] + (lBji * lSigmaDi);
 			if(lXModJ == lValues.mXmean[j]) ++lNoEffectAxisCountJ;
 			else break;
 		}
@@ -249,7 +253,7 @@ bool GA::TermCMAOp::terminate(const Deme& ioDeme, Context& ioContext)
 	unsigned int lNoEffectCoordCount = 0;
 	for(unsigned int i=0; i<lN; ++i) {
 		const double lXModI =
-		    lValues.mXmean[i] + (lValues.mSigma.getWrappedValue() * std::sqrt(lC(i,i)));
+		    lValues.mXmean[i] + (lValues.mSigma.getWrappedValue() * std::sqrt(lCii[i]));
 		if(lXModI == lValues.mXmean[i]) ++lNoEffectCoordCount;
 		else break;
 	}
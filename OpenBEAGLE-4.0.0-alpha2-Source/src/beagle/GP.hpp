@@ -61,14 +61,17 @@
 #include "beagle/GP/MaxTimeExecutionException.hpp"
 #include "beagle/GP/Context.hpp"
 #include "beagle/GP/Datum.hpp"
+#include "beagle/GP/PackedBool.hpp"
 #include "beagle/GP/Individual.hpp"
 #include "beagle/GP/Primitive.hpp"
 #include "beagle/GP/PrimitiveMap.hpp"
 #include "beagle/GP/PrimitiveSet.hpp"
 #include "beagle/GP/PrimitiveSuperSet.hpp"
 #include "beagle/GP/Tree.hpp"
+#include "beagle/GP/SubTreeCache.hpp"
 #include "beagle/GP/PrimitiveInline.hpp"
 #include "beagle/GP/FitnessKoza.hpp"
+#include "beagle/GP/StatsMeasureTree.hpp"
 #include "beagle/GP/StatsCalcFitnessSimpleOp.hpp"
 #include "beagle/GP/StatsCalcFitnessKozaOp.hpp"
 #include "beagle/GP/PrimitiveUsageStatsOp.hpp"
@@ -105,6 +108,7 @@
 // GP Primitives
 
 #include "beagle/GP/TokenT.hpp"
+#include "beagle/GP/TokenBool.hpp"
 #include "beagle/GP/Invoker.hpp"
 #include "beagle/GP/Argument.hpp"
 #include "beagle/GP/ArgumentT.hpp"
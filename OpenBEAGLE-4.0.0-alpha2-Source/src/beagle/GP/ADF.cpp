@@ -141,7 +141,7 @@ void GP::ADF::invoke(GP::Datum& outResult, GP::Tree::Handle ioTree, GP::Context&
 	unsigned int lOldGenotypeIndex = ioContext.getGenotypeIndex();
 	ioContext.setGenotypeHandle(ioTree);
 	ioContext.setGenotypeIndex(mIndex);
-	ioContext.incrementNodesExecuted();
+	ioContext.countTreeExecution(*ioTree);
 	ioContext.pushCallStack(0);
 	(*ioTree)[0].mPrimitive->execute(outResult, ioContext);
 	ioContext.popCallStack();
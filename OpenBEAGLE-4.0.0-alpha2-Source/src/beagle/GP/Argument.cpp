@@ -158,33 +158,37 @@ void GP::Argument::execute(GP::Datum& outResult, GP::Context& ioContext)
 	    "evaluation", "Beagle::GP::Argument",
 	    std::string("Executing the ")+uint2ordinal(mIndex+1)+" argument"
 	);
+	const unsigned int lFrameIndex = ioContext.getArgumentsFrameIndex();
 	switch (mSharedData->mEvalMode) {
-	case ePreCompute:
+	case ePreCompute: {
 		// The result of evaluating the argument has already been calculated.
-		Beagle_AssertM(mIndex < mSharedData->mCaches.back()->size());
-		mSharedData->mTypeAllocator->copy(outResult, *(*mSharedData->mCaches.back())[mIndex]);
+		GP::Context::ArgumentsFrame& lFrame = ioContext.getArgumentsFrame(lFrameIndex);
+		Beagle_AssertM(mIndex < lFrame.mComputed.size());
+		mSharedData->mTypeAllocator->copy(outResult, *lFrame.mValues[mIndex]);
 		break;
+	}
 	case eJustInTime:
 		// Evaluate the argument because we're not caching them.
 		forceEvaluation(outResult, ioContext);
 		break;
-	case eCaching:
+	case eCaching: {
 		// Check first if the argument has been evaluated (i.e. is it in the cache?)
 		// If it has been evaluated then get it from the cache; otherwise evaluate it.
-		Beagle_AssertM(mIndex < mSharedData->mCaches.back()->size());
-		if((*mSharedData->mCaches.back())[mIndex]!=NULL) {
+		GP::Context::ArgumentsFrame& lFrame = ioContext.getArgumentsFrame(lFrameIndex);
+		Beagle_AssertM(mIndex < lFrame.mComputed.size());
+		if(lFrame.mComputed[mIndex]) {
 			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
 			    "evaluation", "Beagle::GP::Argument",
 			    "Getting result from the cache"
 			);
-			mSharedData->mTypeAllocator->copy(outResult, *(*mSharedData->mCaches.back())[mIndex]);
+			mSharedData->mTypeAllocator->copy(outResult, *lFrame.mValues[mIndex]);
 		} else {
-			Object::Bag::Handle lCurrentCache = mSharedData->mCaches.back();
-			mSharedData->mCaches.pop_back();
 			forceEvaluation(outResult, ioContext);
-			mSharedData->mCaches.push_back(lCurrentCache);
-			(*lCurrentCache)[mIndex] = mSharedData->mTypeAllocator->clone(outResult);
+			// The evaluation may have pushed frames, get the frame again.
+			GP::Context::ArgumentsFrame& lEvalFrame = ioContext.getArgumentsFrame(lFrameIndex);
+			mSharedData->mTypeAllocator->copy(*lEvalFrame.mValues[mIndex], outResult);
+			lEvalFrame.mComputed[mIndex] = true;
 			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
 			    "evaluation", "Beagle::GP::Argument",
@@ -192,6 +196,7 @@ void GP::Argument::execute(GP::Datum& outResult, GP::Context& ioContext)
 			);
 		}
 		break;
+	}
 	default:
 		throw Beagle_InternalExceptionM(std::string("Undefined evaluation mode (")+
 		                                uint2str(mSharedData->mEvalMode)+std::string(") for arguments!"));
@@ -200,31 +205,43 @@ void GP::Argument::execute(GP::Datum& outResult, GP::Context& ioContext)
 	Beagle_StackTraceEndM("void GP::Argument::execute(GP::Datum& outResult, GP::Context& ioContext)");
 }
 
+
+/*!
+ *  \brief Evaluate the argument into the invoking tree.
+ *  \param outResult Result containing value of argument.
+ *  \param ioContext Evolutionary context.
+ *
+ *  The sub-tree of the invoker primitive giving the argument is executed with the
+ *  context set as when the invoker was executed, that is with the invoking tree as
+ *  genotype and the frame of the invoking tree as actual arguments frame. The state of
+ *  the context is restored afterward. Limits and counters of the execution are those of
+ *  the given context, which is the only one used.
+ */
 void GP::Argument::forceEvaluation(GP::Datum& outResult, GP::Context& ioContext)
 {
+	Beagle_StackTraceBeginM();
 	Beagle_LogDebugM(
 	    ioContext.getSystem().getLogger(),
 	    "evaluation", "Beagle::GP::Argument",
 	    std::string("Evaluating the ")+uint2ordinal(mIndex+1)+" argument"
 	);
-
-	GP::Context::Handle lActualContext = mSharedData->mEvalContext.back();
-	mSharedData->mEvalContext.pop_back();
-	lActualContext->setAllowedNodesExecution(ioContext.getAllowedNodesExecution());
-	lActualContext->setAllowedExecutionTime(ioContext.getAllowedExecutionTime());
-	lActualContext->setNodesExecutionCount(ioContext.getNodesExecutionCount());
-	lActualContext->getExecutionTimer() = ioContext.getExecutionTimer();
-	getArgument(mIndex, outResult, *lActualContext);
-	ioContext.getExecutionTimer() = lActualContext->getExecutionTimer();
-	ioContext.setNodesExecutionCount(lActualContext->getNodesExecutionCount());
-	ioContext.setAllowedExecutionTime(lActualContext->getAllowedExecutionTime());
-	ioContext.setAllowedNodesExecution(lActualContext->getAllowedNodesExecution());
-	mSharedData->mEvalContext.push_back(lActualContext);
+	const unsigned int lFrameIndex = ioContext.getArgumentsFrameIndex();
+	GP::Context::ArgumentsFrame& lFrame = ioContext.getArgumentsFrame(lFrameIndex);
+	GP::Tree::Handle lOldGenotypeHandle = ioContext.getGenotypeHandle();
+	const unsigned int lOldGenotypeIndex = ioContext.getGenotypeIndex();
+	ioContext.setGenotypeHandle(lFrame.mCallerTree);
+	ioContext.setGenotypeIndex(lFrame.mCallerTreeIndex);
+	ioContext.setArgumentsFrameIndex(lFrame.mCallerFrame);
+	ioContext.pushCallStack(lFrame.mInvokerNode);
+	getArgument(mIndex, outResult, ioContext);
+	ioContext.popCallStack();
+	ioContext.setArgumentsFrameIndex(lFrameIndex);
+	ioContext.setGenotypeIndex(lOldGenotypeIndex);
+	ioContext.setGenotypeHandle(lOldGenotypeHandle);
+	Beagle_StackTraceEndM("void GP::Argument::forceEvaluation(GP::Datum& outResult, GP::Context& ioContext)");
 }
 
 
-
-
 /*!
  *  \brief Return whether selection weight is stable for given number of arguments.
  *  \param inNumberArguments Number of arguments to test weight stability.
@@ -243,74 +260,56 @@ bool GP::Argument::isSelectionWeightStable(unsigned int inNumberArguments) const
  *  \brief Push execution context to prepare the execution of the argument.
  *  \param inNumberArguments Number of arguments of called tree.
  *  \param ioContext Evolutionary context.
+ *
+ *  An arguments frame is pushed into the context, recording the invoker primitive
+ *  actually executed. The values of the frame are allocated the first time the frame is
+ *  used, and then reused by the following invocations.
  */
 void GP::Argument::pushExecutionContext(unsigned int inNumberArguments, GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
-	switch(mSharedData->mEvalMode) {
-	case eCaching: {
-		Object::Bag::Handle lNewCache = new Object::Bag(inNumberArguments, NULL);
-		mSharedData->mCaches.push_back(lNewCache);
-		Context::Alloc::Handle lContextAlloc =
-			castHandleT<Context::Alloc>(ioContext.getSystem().getFactory().getConceptAllocator("Context"));
-		GP::Context::Handle lNewEvalContext =
-			castHandleT<GP::Context>(lContextAlloc->clone(ioContext));
-		mSharedData->mEvalContext.push_back(lNewEvalContext);
-		break;
+	const unsigned int lEvalMode = mSharedData->mEvalMode;
+	if((lEvalMode!=eCaching) && (lEvalMode!=eJustInTime) && (lEvalMode!=ePreCompute)) {
+		throw Beagle_InternalExceptionM(std::string("Undefined evaluation mode (")+
+		                                uint2str(lEvalMode)+std::string(") for the arguments!"));
 	}
-	case eJustInTime: {
-		Context::Alloc::Handle lContextAlloc =
-		    castHandleT<Context::Alloc>(ioContext.getSystem().getFactory().getConceptAllocator("Context"));
-		GP::Context::Handle lNewEvalContext =
-		    castHandleT<GP::Context>(lContextAlloc->clone(ioContext));
-		mSharedData->mEvalContext.push_back(lNewEvalContext);
-		break;
+	const unsigned int lFrameIndex = ioContext.pushArgumentsFrame();
+	GP::Context::ArgumentsFrame& lFrame = ioContext.getArgumentsFrame(lFrameIndex);
+	lFrame.mCallerTree = ioContext.getGenotypeHandle();
+	lFrame.mCallerTreeIndex = ioContext.getGenotypeIndex();
+	lFrame.mInvokerNode = ioContext.getCallStackTop();
+	if(lEvalMode != eJustInTime) {
+		if(lFrame.mValueAlloc != mSharedData->mTypeAllocator) {
+			lFrame.mValues.clear();
+			lFrame.mValueAlloc = mSharedData->mTypeAllocator;
+		}
+		while(lFrame.mValues.size() < inNumberArguments) {
+			lFrame.mValues.push_back(mSharedData->mTypeAllocator->allocate());
+		}
+		lFrame.mComputed.assign(inNumberArguments, false);
 	}
-	case ePreCompute: {
-		Object::Bag::Handle lNewCache = new Object::Bag(inNumberArguments, NULL);
-		lNewCache->resize(inNumberArguments);
+	if(lEvalMode == ePreCompute) {
+		// Arguments are evaluated in the invoking tree, with its frame still actual.
 		for(unsigned int i=0; i<inNumberArguments; ++i) {
-			Object::Handle lArgI = mSharedData->mTypeAllocator->allocate();
+			Object::Handle lArgI = ioContext.getArgumentsFrame(lFrameIndex).mValues[i];
 			getArgument(i, *lArgI, ioContext);
-			(*lNewCache)[i] = lArgI;
 		}
-		mSharedData->mCaches.push_back(lNewCache);
-	}
-	default: {
-		throw Beagle_InternalExceptionM(std::string("Undefined evaluation mode (")+
-		                                uint2str(mSharedData->mEvalMode)+std::string(") for the arguments!"));
-	}
+		ioContext.getArgumentsFrame(lFrameIndex).mComputed.assign(inNumberArguments, true);
 	}
+	ioContext.setArgumentsFrameIndex(lFrameIndex);
 	Beagle_StackTraceEndM("void GP::Argument::pushExecutionContext(unsigned int inNumberArguments, GP::Context& ioContext)");
 }
 
 
 /*!
  *  \brief Pop execution context as the execution of the argument is done.
+ *  \param ioContext Evolutionary context.
  */
-void GP::Argument::popExecutionContext()
+void GP::Argument::popExecutionContext(GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
-	switch(mSharedData->mEvalMode) {
-	case eCaching: {
-		mSharedData->mCaches.pop_back();
-		mSharedData->mEvalContext.pop_back();
-		break;
-	}
-	case eJustInTime: {
-		mSharedData->mEvalContext.pop_back();
-		break;
-	}
-	case ePreCompute: {
-		mSharedData->mCaches.pop_back();
-		break;
-	}
-	default: {
-		throw Beagle_InternalExceptionM(std::string("Undefined evaluation mode (")+
-		                                uint2str(mSharedData->mEvalMode)+std::string(") for the arguments!"));
-	}
-	}
-	Beagle_StackTraceEndM("void GP::Argument::popExecutionContext()");
+	ioContext.popArgumentsFrame();
+	Beagle_StackTraceEndM("void GP::Argument::popExecutionContext(GP::Context& ioContext)");
 }
 
 
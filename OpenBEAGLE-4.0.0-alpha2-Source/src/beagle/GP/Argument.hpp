@@ -116,7 +116,7 @@ public:
 	virtual bool isSelectionWeightStable(unsigned int inNumberArguments) const;
 	virtual void readWithContext(PACC::XML::ConstIterator inIter, GP::Context& ioContext);
 	virtual void pushExecutionContext(unsigned int inNumberArguments, GP::Context& ioContext);
-	virtual void popExecutionContext();
+	virtual void popExecutionContext(GP::Context& ioContext);
 	virtual bool validate(GP::Context& ioContext) const;
 	virtual void writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
@@ -144,6 +144,11 @@ protected:
 
 	/*!
 	 *  \brief Class defining an internal data structure of the arguments.
+	 *
+	 *  The shared data is not modified during the execution of the arguments, the argument
+	 *  values and evaluation state being kept into the arguments frames of the GP context
+	 *  (see GP::Context::ArgumentsFrame). Individuals using the arguments can then be
+	 *  executed concurrently with different contexts.
 	 */
 class SharedData : public Beagle::Object
 	{
@@ -159,22 +164,12 @@ class SharedData : public Beagle::Object
 		                    unsigned int inEvalMode=GP::Argument::eJustInTime) :
 				mTypeAllocator(inCacheAlloc),
 				mEvalMode(inEvalMode)
-		{
-			clear();
-		}
+		{ }
 
 		virtual ~SharedData()
 		{ }
 
-		void clear()
-		{
-			mEvalContext.clear();
-			mCaches.clear();
-		}
-
 		Object::Alloc::Handle mTypeAllocator; //!< Allocator of type of data processed.
-		GP::Context::Bag      mEvalContext;   //!< Stack of evolutionary context for args evaluation.
-		Container::Bag        mCaches;        //!< Stack of argument values.
 		unsigned int          mEvalMode;      //!< Evaluation mode of the arguments.
 	};
 
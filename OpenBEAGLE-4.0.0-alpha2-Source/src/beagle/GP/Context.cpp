@@ -45,6 +45,13 @@ using namespace Beagle;
 GP::Context::Context() :
 		mAllowedExecutionTime(0.0),
 		mNodesExecutionCount(0),
-		mAllowedNodesExecution(UINT_MAX)
+		mAllowedNodesExecution(UINT_MAX),
+		mCountNodesPerTree(false),
+		mTimeCheckPeriod(1),
+		mTimeChecksBeforeRead(1),
+		mBitParallel(false),
+		mSubTreeMemo(NULL),
+		mArgumentsFramesSize(0),
+		mArgumentsFrameIndex(UINT_MAX)
 { }
 
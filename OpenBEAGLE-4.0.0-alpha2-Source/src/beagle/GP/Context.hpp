@@ -36,6 +36,9 @@
 #ifndef Beagle_GP_Context_hpp
 #define Beagle_GP_Context_hpp
 
+#include <climits>
+#include <vector>
+
 #include "PACC/Util.hpp"
 
 #include "beagle/config.hpp"
@@ -57,6 +60,9 @@ namespace Beagle
 namespace GP
 {
 
+// Forward declaration
+class SubTreeMemo;
+
 
 /*!
  *  \class Context beagle/GP/Context.hpp "beagle/GP/Context.hpp"
@@ -79,6 +85,68 @@ public:
 	typedef ContainerT<Context,Beagle::Context::Bag>
 	Bag;
 
+	/*!
+	 *  \brief Frame of the arguments of an invoked tree, pushed by GP::Argument.
+	 *
+	 *  A frame records where the invoker primitive is, so that the arguments of the invoked
+	 *  tree can be evaluated in the invoking tree, and keeps the cached argument values. The
+	 *  frames of a context are reused from one invocation to the next.
+	 */
+	struct ArgumentsFrame
+	{
+		unsigned int                mCallerFrame;      //!< Index of the frame of the invoking tree.
+		GP::Tree::Handle            mCallerTree;       //!< Invoking tree.
+		unsigned int                mCallerTreeIndex;  //!< Index of the invoking tree.
+		unsigned int                mInvokerNode;      //!< Node index of the invoker primitive.
+		Object::Alloc::Handle       mValueAlloc;       //!< Allocator of the argument values.
+		std::vector<Object::Handle> mValues;           //!< Argument values.
+		std::vector<bool>           mComputed;         //!< Whether each argument value is computed.
+
+		ArgumentsFrame() :
+			mCallerFrame(UINT_MAX), mCallerTreeIndex(0), mInvokerNode(0)
+		{ }
+
+		/*!
+		 *  \brief Copy a frame, cloning its argument values.
+		 *
+		 *  The values are cloned rather than shared, so that a copied context (one per
+		 *  thread) never writes into the argument values of the original context.
+		 */
+		ArgumentsFrame(const ArgumentsFrame& inOriginal) :
+			mCallerFrame(inOriginal.mCallerFrame),
+			mCallerTree(inOriginal.mCallerTree),
+			mCallerTreeIndex(inOriginal.mCallerTreeIndex),
+			mInvokerNode(inOriginal.mInvokerNode),
+			mValueAlloc(inOriginal.mValueAlloc),
+			mComputed(inOriginal.mComputed)
+		{
+			cloneValues(inOriginal);
+		}
+
+		ArgumentsFrame& operator=(const ArgumentsFrame& inOriginal)
+		{
+			if(this == &inOriginal) return *this;
+			mCallerFrame     = inOriginal.mCallerFrame;
+			mCallerTree      = inOriginal.mCallerTree;
+			mCallerTreeIndex = inOriginal.mCallerTreeIndex;
+			mInvokerNode     = inOriginal.mInvokerNode;
+			mValueAlloc      = inOriginal.mValueAlloc;
+			mComputed        = inOriginal.mComputed;
+			cloneValues(inOriginal);
+			return *this;
+		}
+
+	private:
+		void cloneValues(const ArgumentsFrame& inOriginal)
+		{
+			mValues.resize(inOriginal.mValues.size());
+			for(unsigned int i=0; i<inOriginal.mValues.size(); ++i) {
+				if((inOriginal.mValues[i] == NULL) || (mValueAlloc == NULL)) mValues[i] = NULL;
+				else mValues[i] = mValueAlloc->clone(*inOriginal.mValues[i]);
+			}
+		}
+	};
+
 	Context();
 	virtual ~Context()
 	{ }
@@ -101,11 +169,19 @@ public:
 	 *  \brief Check if execution time is more or less than allowed execution time. Test is done
 	 *    only when allowed execution time is greater than 0.
 	 *  \throw Beagle::GP::MaxTimeExecutionException If execution time is more than allowed time.
+	 *
+	 *  The execution timer is read only once every getExecutionTimeCheckPeriod() calls, as
+	 *  reading the clock is much more costly than executing most primitives.
 	 */
 	inline void checkExecutionTime() const
 	{
 		Beagle_StackTraceBeginM();
 		if(mAllowedExecutionTime > 0.0) {
+			if(mTimeChecksBeforeRead > 1) {
+				--mTimeChecksBeforeRead;
+				return;
+			}
+			mTimeChecksBeforeRead = mTimeCheckPeriod;
 			const double lTimeElapsed = mExecutionTimer.getValue();
 			if(lTimeElapsed > mAllowedExecutionTime) {
 				throw GP::MaxTimeExecutionException(
@@ -118,6 +194,41 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::checkExecutionTime() const");
 	}
 
+	/*!
+	 *  \brief Count the execution of the root node of a tree.
+	 *  \param inTree Tree executed.
+	 *  \throw GP::MaxNodesExecutionException If the maximum number of nodes execution is exceeded.
+	 *
+	 *  When the nodes are counted per tree, the whole tree is counted at once, instead of
+	 *  counting each node as it is executed.
+	 */
+	inline void countTreeExecution(const GP::Tree& inTree)
+	{
+		Beagle_StackTraceBeginM();
+		if(mCountNodesPerTree) countNodesExecution(inTree.size());
+		else countNodesExecution(1);
+		Beagle_StackTraceEndM("void GP::Context::countTreeExecution(const GP::Tree& inTree)");
+	}
+
+	/*!
+	 *  \brief Add a number of nodes to the executed nodes counter.
+	 *  \param inNbNodes Number of nodes executed.
+	 *  \throw GP::MaxNodesExecutionException If the maximum number of nodes execution is exceeded.
+	 */
+	inline void countNodesExecution(unsigned int inNbNodes)
+	{
+		Beagle_StackTraceBeginM();
+		mNodesExecutionCount += inNbNodes;
+		if(mNodesExecutionCount > mAllowedNodesExecution) {
+			throw Beagle::GP::MaxNodesExecutionException(
+			    std::string("Number of GP nodes executed exceeded maximum allowed"),
+			    mNodesExecutionCount,
+			    mAllowedNodesExecution
+			);
+		}
+		Beagle_StackTraceEndM("void GP::Context::countNodesExecution(unsigned int inNbNodes)");
+	}
+
 	/*!
 	 *  \brief Empty the call stack.
 	 */
@@ -150,6 +261,30 @@ public:
 		Beagle_StackTraceEndM("unsigned int GP::Context::getAllowedNodesExecution() const");
 	}
 
+	/*!
+	 *  \brief Return a frame of the arguments of the invoked trees.
+	 *  \param inFrameIndex Index of the frame.
+	 *  \return Reference to the frame, valid until another frame is pushed.
+	 */
+	inline ArgumentsFrame& getArgumentsFrame(unsigned int inFrameIndex)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inFrameIndex, mArgumentsFramesSize-1);
+		return mArgumentsFrames[inFrameIndex];
+		Beagle_StackTraceEndM("GP::Context::ArgumentsFrame& GP::Context::getArgumentsFrame(unsigned int)");
+	}
+
+	/*!
+	 *  \brief Return the index of the arguments frame of the tree actually executed.
+	 *  \return Index of the frame, UINT_MAX if the tree executed is not invoked.
+	 */
+	inline unsigned int getArgumentsFrameIndex() const
+	{
+		Beagle_StackTraceBeginM();
+		return mArgumentsFrameIndex;
+		Beagle_StackTraceEndM("unsigned int GP::Context::getArgumentsFrameIndex() const");
+	}
+
 	/*!
 	 *  \brief Return the call stack.
 	 *  \return Cosntant reference to the call stack.
@@ -210,6 +345,16 @@ public:
 		Beagle_StackTraceEndM("unsigned int GP::Context::getCallStackTop() const");
 	}
 
+	/*!
+	 *  \return Number of execution time checks between two readings of the execution timer.
+	 */
+	inline unsigned int getExecutionTimeCheckPeriod() const
+	{
+		Beagle_StackTraceBeginM();
+		return mTimeCheckPeriod;
+		Beagle_StackTraceEndM("unsigned int GP::Context::getExecutionTimeCheckPeriod() const");
+	}
+
 	/*!
 	 *  \return Reference to context execution timer, used to time execution time of GP individuals.
 	 */
@@ -304,6 +449,17 @@ public:
 		Beagle_StackTraceEndM("GP::Individual::Handle GP::Context::getIndividualHandle()");
 	}
 
+	/*!
+	 *  \brief Return the sub-tree outputs memo installed for the actual evaluation.
+	 *  \return Pointer to the memo, NULL when the sub-tree outputs are not memoized.
+	 */
+	inline GP::SubTreeMemo* getSubTreeMemo() const
+	{
+		Beagle_StackTraceBeginM();
+		return mSubTreeMemo;
+		Beagle_StackTraceEndM("GP::SubTreeMemo* GP::Context::getSubTreeMemo() const");
+	}
+
 	/*!
 	 *  \brief Return value of execution counter, used to interrupt individuals evaluation.
 	 *  \return Number of nodes evaluated.
@@ -316,12 +472,14 @@ public:
 	}
 
 	/*!
-	 *  \brief Increment executed nodes counter.
+	 *  \brief Increment executed nodes counter. Nothing is done when the nodes are counted
+	 *    per tree, the nodes being already counted with their tree.
 	 *  \throw GP::MaxNodesExecutionException If the maximum number of nodes execution is exceeded.
 	 */
 	inline void incrementNodesExecuted()
 	{
 		Beagle_StackTraceBeginM();
+		if(mCountNodesPerTree) return;
 		if((++mNodesExecutionCount) > mAllowedNodesExecution) {
 			throw Beagle::GP::MaxNodesExecutionException(
 			    std::string("Number of GP nodes executed exceeded maximum allowed"),
@@ -332,6 +490,29 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::incrementNodesExecuted()");
 	}
 
+	/*!
+	 *  \brief Return whether the executed nodes are counted per tree.
+	 *  \return True if each tree executed counts for all its nodes, false if each node
+	 *    is counted as it is executed.
+	 */
+	inline bool isCountingNodesPerTree() const
+	{
+		Beagle_StackTraceBeginM();
+		return mCountNodesPerTree;
+		Beagle_StackTraceEndM("bool GP::Context::isCountingNodesPerTree() const");
+	}
+
+	/*!
+	 *  \brief Return whether the Boolean primitives operate on packed words of fitness cases.
+	 *  \return True if the context is in bit-parallel mode, false if not.
+	 */
+	inline bool isBitParallel() const
+	{
+		Beagle_StackTraceBeginM();
+		return mBitParallel;
+		Beagle_StackTraceEndM("bool GP::Context::isBitParallel() const");
+	}
+
 	/*!
 	 *  \brief Pop the call stack.
 	 *  \throw Beagle::AssertException If the call stack is empty.
@@ -344,6 +525,35 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::popCallStack()");
 	}
 
+	/*!
+	 *  \brief Pop the frame on top of the arguments frame stack, and make the frame of its
+	 *    invoking tree the actual one.
+	 */
+	inline void popArgumentsFrame()
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_AssertM(mArgumentsFramesSize > 0);
+		--mArgumentsFramesSize;
+		mArgumentsFrameIndex = mArgumentsFrames[mArgumentsFramesSize].mCallerFrame;
+		Beagle_StackTraceEndM("void GP::Context::popArgumentsFrame()");
+	}
+
+	/*!
+	 *  \brief Push a frame on top of the arguments frame stack.
+	 *  \return Index of the frame pushed, to make actual with setArgumentsFrameIndex.
+	 *
+	 *  The actual frame is recorded as the frame of the invoking tree. The frame pushed is
+	 *  reused from a previous invocation when possible, with its allocated values.
+	 */
+	inline unsigned int pushArgumentsFrame()
+	{
+		Beagle_StackTraceBeginM();
+		if(mArgumentsFramesSize == mArgumentsFrames.size()) mArgumentsFrames.push_back(ArgumentsFrame());
+		mArgumentsFrames[mArgumentsFramesSize].mCallerFrame = mArgumentsFrameIndex;
+		return mArgumentsFramesSize++;
+		Beagle_StackTraceEndM("unsigned int GP::Context::pushArgumentsFrame()");
+	}
+
 	/*!
 	 *  \brief Push a node index on the call stack.
 	 *  \param inNodeIndex Node index to push.
@@ -355,6 +565,60 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::pushCallStack(unsigned int inNodeIndex)");
 	}
 
+	/*!
+	 *  \brief Empty the arguments frame stack, keeping the frames for reuse.
+	 *
+	 *  Called at the start of each execution, so that frames left pushed by an execution
+	 *  aborted by an exception do not leak into the next one.
+	 */
+	inline void resetArgumentsFrames()
+	{
+		Beagle_StackTraceBeginM();
+		mArgumentsFramesSize = 0;
+		mArgumentsFrameIndex = UINT_MAX;
+		Beagle_StackTraceEndM("void GP::Context::resetArgumentsFrames()");
+	}
+
+	/*!
+	 *  \brief Set the arguments frame of the tree actually executed.
+	 *  \param inFrameIndex Index of the frame, UINT_MAX if the tree executed is not invoked.
+	 */
+	inline void setArgumentsFrameIndex(unsigned int inFrameIndex)
+	{
+		Beagle_StackTraceBeginM();
+		mArgumentsFrameIndex = inFrameIndex;
+		Beagle_StackTraceEndM("void GP::Context::setArgumentsFrameIndex(unsigned int inFrameIndex)");
+	}
+
+	/*!
+	 *  \brief Set whether the executed nodes are counted per tree.
+	 *  \param inCountNodesPerTree True to count all the nodes of a tree when its root is
+	 *    executed, false to count each node as it is executed.
+	 *
+	 *  Counting per tree removes the counting from the execution of each node. The count is
+	 *  then an upper bound for trees with conditional primitives, and primitives executing
+	 *  an argument more than once must count the extra executions with countNodesExecution.
+	 */
+	inline void setCountNodesPerTree(bool inCountNodesPerTree)
+	{
+		Beagle_StackTraceBeginM();
+		mCountNodesPerTree = inCountNodesPerTree;
+		Beagle_StackTraceEndM("void GP::Context::setCountNodesPerTree(bool inCountNodesPerTree)");
+	}
+
+	/*!
+	 *  \brief Set the number of execution time checks between two readings of the timer.
+	 *  \param inExecutionTimeCheckPeriod Number of checks between two timer readings, 0 or 1
+	 *    to read the timer at each check.
+	 */
+	inline void setExecutionTimeCheckPeriod(unsigned int inExecutionTimeCheckPeriod)
+	{
+		Beagle_StackTraceBeginM();
+		mTimeCheckPeriod = (inExecutionTimeCheckPeriod == 0) ? 1 : inExecutionTimeCheckPeriod;
+		mTimeChecksBeforeRead = mTimeCheckPeriod;
+		Beagle_StackTraceEndM("void GP::Context::setExecutionTimeCheckPeriod(unsigned int inExecutionTimeCheckPeriod)");
+	}
+
 	/*!
 	 *  \brief Set the execution time allowed for an individual execution.
 	 *    Allowed execution time of 0 means there is no execution time limit.
@@ -378,6 +642,18 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::setAllowedNodesExecution(unsigned int inAllowedNodesExecution)");
 	}
 
+	/*!
+	 *  \brief Set the bit-parallel mode of the Boolean primitives.
+	 *  \param inBitParallel True if the Boolean primitives and tokens exchange GP::PackedBool
+	 *    words of fitness cases, false if they exchange Bool values.
+	 */
+	inline void setBitParallel(bool inBitParallel)
+	{
+		Beagle_StackTraceBeginM();
+		mBitParallel = inBitParallel;
+		Beagle_StackTraceEndM("void GP::Context::setBitParallel(bool inBitParallel)");
+	}
+
 	/*!
 	 *  \brief Set an handle to the actual GP tree.
 	 *  \param inTreeHandle Actual GP tree handle.
@@ -400,6 +676,17 @@ public:
 		Beagle_StackTraceEndM("void GP::Context::setIndividualHandle(GP::Individual::Handle inIndividualHandle)");
 	}
 
+	/*!
+	 *  \brief Install a sub-tree outputs memo for the actual evaluation.
+	 *  \param inSubTreeMemo Pointer to the memo, NULL to stop memoizing the sub-tree outputs.
+	 */
+	inline void setSubTreeMemo(GP::SubTreeMemo* inSubTreeMemo)
+	{
+		Beagle_StackTraceBeginM();
+		mSubTreeMemo = inSubTreeMemo;
+		Beagle_StackTraceEndM("void GP::Context::setSubTreeMemo(GP::SubTreeMemo* inSubTreeMemo)");
+	}
+
 	/*!
 	 *  \brief Set number of nodes executed value.
 	 *  \param inNodesExecutionCount Count of the number of nodes executed.
@@ -418,6 +705,14 @@ protected:
 	double                    mAllowedExecutionTime;  //!< Allowed execution time for ind. execution.
 	unsigned int              mNodesExecutionCount;   //!< Count the number of GP nodes executed.
 	unsigned int              mAllowedNodesExecution; //!< Maximum allowed of GP nodes execution.
+	bool                      mCountNodesPerTree;     //!< Nodes are counted per tree executed.
+	unsigned int              mTimeCheckPeriod;       //!< Time checks between two timer readings.
+	mutable unsigned int      mTimeChecksBeforeRead;  //!< Time checks left before reading the timer.
+	bool                      mBitParallel;           //!< Boolean primitives operate on packed words.
+	GP::SubTreeMemo*          mSubTreeMemo;           //!< Sub-tree outputs memo, NULL when not memoized.
+	std::vector<ArgumentsFrame> mArgumentsFrames;     //!< Arguments frames, reused between invocations.
+	unsigned int              mArgumentsFramesSize;   //!< Number of arguments frames in use.
+	unsigned int              mArgumentsFrameIndex;   //!< Frame of the tree actually executed.
 
 };
 
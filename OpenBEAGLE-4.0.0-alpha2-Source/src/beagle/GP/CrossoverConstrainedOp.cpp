@@ -55,116 +55,77 @@ GP::CrossoverConstrainedOp::CrossoverConstrainedOp(std::string inMatingPbName,
 
 
 /*!
- *  \brief Build a roulette of nodes that can be selected following the constraints penalties.
- *  \param ioRoulette Roulette of nodes that can be selected following the constraints given.
- *  \param inSelectABranch True if node to select must be a branch, false if it must a leaf.
- *  \param inMaxSubTreeDepth Maximum sub tree depth allowed of the node to be selected.
- *  \param inMaxSubTreeSize Maximum sub tree size allowed of the node to be selected.
- *  \param inActualIndex Index in actual tree of the node processed.
- *  \param inTree Tree processed.
+ *  \brief Index the nodes of an individual that can be choosen as second crossover point.
+ *  \param outCandidates Nodes of the individual, with the properties checked when mating.
+ *  \param inIndividual Individual to index.
  *  \param ioContext Evolutionary context.
- *  \return Max depth of subtree processed.
+ *
+ *  The candidates are built once per mating, the constraints of each crossover attempt being
+ *  then checked on the flat array instead of visiting the trees again.
  */
-unsigned int GP::CrossoverConstrainedOp::buildRoulette(
-    RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette,
-    bool inSelectABranch,
-    unsigned int inMaxSubTreeDepth,
-    unsigned int inMaxSubTreeSize,
-    unsigned int inActualIndex,
-    GP::Tree& inTree,
-    GP::Context& ioContext) const
+void GP::CrossoverConstrainedOp::buildCandidates(std::vector<MatingCandidate>& outCandidates,
+        GP::Individual& inIndividual,
+        GP::Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
-	const unsigned int lNbArgs = inTree[inActualIndex].mPrimitive->getNumberArguments();
-	const unsigned int lSubTreeSize = inTree[inActualIndex].mSubTreeSize;
-	const bool lGoodArity = ((inTree.size()==1) || ((lNbArgs==0) != inSelectABranch));
-	ioContext.pushCallStack(inActualIndex);
-	unsigned int lChildIndex = inActualIndex+1;
-	unsigned int lMaxDepthDown = 0;
-	for(unsigned int i=0; i<lNbArgs; ++i) {
-		unsigned int lChildDepth = buildRoulette(ioRoulette,
-		                           inSelectABranch,
-		                           inMaxSubTreeDepth,
-		                           inMaxSubTreeSize,
-		                           lChildIndex,
-		                           inTree,
-		                           ioContext);
-		lChildIndex += inTree[lChildIndex].mSubTreeSize;
-		if(lChildDepth > lMaxDepthDown) lMaxDepthDown = lChildDepth;
-	}
-	++lMaxDepthDown;
-	const unsigned int lMaxDepthUp = ioContext.getCallStackSize();
-	ioContext.popCallStack();
-	if(lGoodArity && (lSubTreeSize<=inMaxSubTreeSize) &&
-	        (lMaxDepthDown<=inMaxSubTreeDepth) && (lMaxDepthUp<=inMaxSubTreeDepth)) {
-		std::pair<unsigned int,unsigned int> lPair(ioContext.getGenotypeIndex(), inActualIndex);
-		ioRoulette.insert(lPair, 1.0);
+	outCandidates.clear();
+	GP::Tree::Handle lOldTreeHandle = ioContext.getGenotypeHandle();
+	const unsigned int lOldTreeIndex = ioContext.getGenotypeIndex();
+	ioContext.emptyCallStack();
+	for(unsigned int i=0; i<inIndividual.size(); ++i) {
+		if(inIndividual[i]->empty()) continue;
+		ioContext.setGenotypeHandle(inIndividual[i]);
+		ioContext.setGenotypeIndex(i);
+		buildCandidatesOfSubTree(outCandidates, 0, *inIndividual[i], ioContext);
 	}
-	return lMaxDepthDown;
-	Beagle_StackTraceEndM("unsigned int GP::CrossoverConstrainedOp::buildRoulette(RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette, bool inSelectABranch, unsigned int inMaxSubTreeDepth, unsigned int inMaxSubTreeSize, unsigned int inActualIndex, GP::Tree& inTree, GP::Context& ioContext) const");
+	ioContext.setGenotypeIndex(lOldTreeIndex);
+	ioContext.setGenotypeHandle(lOldTreeHandle);
+	Beagle_StackTraceEndM("void GP::CrossoverConstrainedOp::buildCandidates(std::vector<MatingCandidate>&,GP::Individual&,GP::Context&) const");
 }
 
 
-#ifdef BEAGLE_HAVE_RTTI
-
 /*!
- *  \brief Build a roulette of nodes that can be selected following the constraints penalties.
- *  \param ioRoulette Roulette of nodes that can be selected following the constraints given.
- *  \param inSelectABranch True if node to select must be a branch, false if it must a leaf.
- *  \param inNodeReturnType Desired return type for the nodes to be selected.
- *  \param inMaxSubTreeDepth Maximum sub tree depth allowed of the node to be selected.
- *  \param inMaxSubTreeSize Maximum sub tree size allowed of the node to be selected.
+ *  \brief Index the nodes of a sub-tree that can be choosen as second crossover point.
+ *  \param ioCandidates Nodes indexed, to which the nodes of the sub-tree are appended.
  *  \param inActualIndex Index in actual tree of the node processed.
  *  \param inTree Tree processed.
  *  \param ioContext Evolutionary context.
  *  \return Max depth of subtree processed.
  */
-unsigned int GP::CrossoverConstrainedOp::buildRouletteWithType(
-    RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette,
-    bool inSelectABranch,
-    const std::type_info* inNodeReturnType,
-    unsigned int inMaxSubTreeDepth,
-    unsigned int inMaxSubTreeSize,
-    unsigned int inActualIndex,
-    GP::Tree& inTree,
-    GP::Context& ioContext) const
+unsigned int GP::CrossoverConstrainedOp::buildCandidatesOfSubTree(std::vector<MatingCandidate>& ioCandidates,
+        unsigned int inActualIndex,
+        GP::Tree& inTree,
+        GP::Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
 	const unsigned int lNbArgs = inTree[inActualIndex].mPrimitive->getNumberArguments();
-	const unsigned int lSubTreeSize = inTree[inActualIndex].mSubTreeSize;
-	const bool lGoodArity = ((inTree.size()==1) || ((lNbArgs==0) != inSelectABranch));
 	ioContext.pushCallStack(inActualIndex);
-	const std::type_info* lNodeType = inTree[inActualIndex].mPrimitive->getReturnType(ioContext);
-	const bool lCompatibleTyping = ((inNodeReturnType==NULL) || (lNodeType==NULL) ||
-	                                (inNodeReturnType==lNodeType));
+	MatingCandidate lCandidate;
+	lCandidate.mTreeIndex   = ioContext.getGenotypeIndex();
+	lCandidate.mNodeIndex   = inActualIndex;
+	lCandidate.mSubTreeSize = inTree[inActualIndex].mSubTreeSize;
+	lCandidate.mDepthUp     = ioContext.getCallStackSize();
+	lCandidate.mAsBranch    = ((inTree.size()==1) || (lNbArgs!=0));
+	lCandidate.mAsLeaf      = ((inTree.size()==1) || (lNbArgs==0));
+#ifdef BEAGLE_HAVE_RTTI
+	lCandidate.mReturnType  = inTree[inActualIndex].mPrimitive->getReturnType(ioContext);
+#endif // BEAGLE_HAVE_RTTI
+	const unsigned int lCandidateIndex = ioCandidates.size();
+	ioCandidates.push_back(lCandidate);
 	unsigned int lChildIndex = inActualIndex+1;
 	unsigned int lMaxDepthDown = 0;
 	for(unsigned int i=0; i<lNbArgs; ++i) {
-		unsigned int lChildDepth = buildRouletteWithType(ioRoulette,
-		                           inSelectABranch,
-		                           inNodeReturnType,
-		                           inMaxSubTreeDepth,
-		                           inMaxSubTreeSize,
-		                           lChildIndex,
-		                           inTree,
-		                           ioContext);
+		unsigned int lChildDepth = buildCandidatesOfSubTree(ioCandidates, lChildIndex, inTree, ioContext);
 		lChildIndex += inTree[lChildIndex].mSubTreeSize;
 		if(lChildDepth > lMaxDepthDown) lMaxDepthDown = lChildDepth;
 	}
 	++lMaxDepthDown;
-	const unsigned int lMaxDepthUp = ioContext.getCallStackSize();
+	ioCandidates[lCandidateIndex].mDepthDown = lMaxDepthDown;
 	ioContext.popCallStack();
-	if(lGoodArity && lCompatibleTyping && (lSubTreeSize<=inMaxSubTreeSize) &&
-	        (lMaxDepthDown<=inMaxSubTreeDepth) && (lMaxDepthUp<=inMaxSubTreeDepth)) {
-		std::pair<unsigned int,unsigned int> lPair(ioContext.getGenotypeIndex(), inActualIndex);
-		ioRoulette.insert(lPair, 1.0);
-	}
 	return lMaxDepthDown;
-	Beagle_StackTraceEndM("unsigned int GP::CrossoverConstrainedOp::buildRouletteWithType(RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette, bool inSelectABranch, const std::type_info* inNodeReturnType, unsigned int inMaxSubTreeDepth, unsigned int inMaxSubTreeSize, unsigned int inActualIndex, GP::Tree& inTree, GP::Context& ioContext) const");
+	Beagle_StackTraceEndM("unsigned int GP::CrossoverConstrainedOp::buildCandidatesOfSubTree(std::vector<MatingCandidate>&,unsigned int,GP::Tree&,GP::Context&) const");
 }
 
-#endif // BEAGLE_HAVE_RTTI
-
 
 /*!
  *  \brief Mate two GP individuals for a constrained tree crossover.
@@ -200,6 +161,15 @@ bool GP::CrossoverConstrainedOp::mate(Beagle::Individual& ioIndiv1, Beagle::Cont
 	unsigned int     lSizeIndiv1     = 0;
 	for(unsigned int i=0; i<lIndiv1.size(); i++) lSizeIndiv1 += lIndiv1[i]->size();
 
+	// Branches and leaves of the first individual's trees, indexed the first time a tree is
+	// choosen, and nodes of the second individual, indexed once for all the attempts.
+	// The second individual is left unchanged by a failed attempt, as the crossover is undone.
+	std::vector< std::vector<unsigned int> > lBranches1(lIndiv1.size());
+	std::vector< std::vector<unsigned int> > lLeaves1(lIndiv1.size());
+	std::vector<MatingCandidate> lCandidates2;
+	std::vector<unsigned int> lMatching2;
+	buildCandidates(lCandidates2, lIndiv2, lContext2);
+
 	Beagle_LogDebugM(
 	    ioContext1.getSystem().getLogger(),
 	    "crossover",
@@ -235,16 +205,19 @@ bool GP::CrossoverConstrainedOp::mate(Beagle::Individual& ioIndiv1, Beagle::Cont
 		}
 		Beagle_AssertM(lChoosenTree1 < lIndiv1.size());
 
-		// Choose a type of node (branch or leaf) following the distribution probability and change the
-		// node for another node of the same tree if the types mismatch.
+		// Choose a type of node (branch or leaf) following the distribution probability and draw the
+		// node among the nodes of that type of the same tree.
 		GP::Tree& lTree1 = *lIndiv1[lChoosenTree1];
 		const unsigned int lPrimitiveSetIndex1 = lTree1.getPrimitiveSetIndex();
 		if(lTree1.size() > 1) {
 			bool lTypeNode1 =
 			    (lContext1.getSystem().getRandomizer().rollUniform(0.0, 1.0) < lDistrProba);
-			while((lTree1[lChoosenNode1].mPrimitive->getNumberArguments() != 0) != lTypeNode1) {
-				lChoosenNode1 = lContext1.getSystem().getRandomizer().rollInteger(0, lTree1.size()-1);
+			if(lBranches1[lChoosenTree1].empty()) {
+				lTree1.indexNodesByArity(lBranches1[lChoosenTree1], lLeaves1[lChoosenTree1]);
 			}
+			const std::vector<unsigned int>& lNodes1 =
+			    lTypeNode1 ? lBranches1[lChoosenTree1] : lLeaves1[lChoosenTree1];
+			lChoosenNode1 = lNodes1[lContext1.getSystem().getRandomizer().rollInteger(0, lNodes1.size()-1)];
 		}
 
 		// Choose type of node (branch or leaf) for the second node.
@@ -263,25 +236,20 @@ bool GP::CrossoverConstrainedOp::mate(Beagle::Individual& ioIndiv1, Beagle::Cont
 
 #ifdef BEAGLE_HAVE_RTTI
 		const std::type_info* lDesiredType = lTree1[lChoosenNode1].mPrimitive->getReturnType(lContext1);
-		bool lGoodSelect = selectNodeToMateWithType(lChoosenTree2,
-		                   lChoosenNode2,
-		                   lTypeNode2,
-		                   lDesiredType,
-		                   lPrimitiveSetIndex1,
-		                   lMaxDepthTree2,
-		                   UINT_MAX,
-		                   lIndiv2,
-		                   lContext2);
-#else // BEAGLE_HAVE_RTTI
-		bool lGoodSelect = selectNodeToMate(lChoosenTree2,
-											lChoosenNode2,
-											lTypeNode2,
-											lPrimitiveSetIndex1,
-											lMaxDepthTree2,
-											UINT_MAX,
-											lIndiv2,
-											lContext2);
 #endif // BEAGLE_HAVE_RTTI
+		bool lGoodSelect = selectCandidate(lChoosenTree2,
+		                                   lChoosenNode2,
+		                                   lTypeNode2,
+#ifdef BEAGLE_HAVE_RTTI
+		                                   lDesiredType,
+#endif // BEAGLE_HAVE_RTTI
+		                                   lPrimitiveSetIndex1,
+		                                   lMaxDepthTree2,
+		                                   UINT_MAX,
+		                                   lCandidates2,
+		                                   lMatching2,
+		                                   lIndiv2,
+		                                   lContext2);
 
 		// Check to see that there is at least one node that can be selected
 		if(lGoodSelect==false) {
@@ -375,58 +343,6 @@ bool GP::CrossoverConstrainedOp::mate(Beagle::Individual& ioIndiv1, Beagle::Cont
 }
 
 
-/*!
- *  \brief Select a node for mating in the given individual, following the constraints penalties.
- *  \param outSelectTreeIndex Tree index of the selected node.
- *  \param outSelectNodeIndex Index of the selected node.
- *  \param inSelectABranch True if node to select must be a branch, false if it must a leaf.
- *  \param inPrimitSetIndex Primitive set index to which the tree must be associated.
- *  \param inMaxSubTreeDepth Maximum sub tree depth allowed of the node to be selected.
- *  \param inMaxSubTreeSize Maximum sub tree size allowed of the node to be selected.
- *  \param inIndividual Individual to select the node from.
- *  \param ioContext Evolutionary context.
- *  \return True if there was node to select, false if no node respected all constraints.
- */
-bool GP::CrossoverConstrainedOp::selectNodeToMate(unsigned int& outSelectTreeIndex,
-        unsigned int& outSelectNodeIndex,
-        bool inSelectABranch,
-        unsigned int inPrimitSetIndex,
-        unsigned int inMaxSubTreeDepth,
-        unsigned int inMaxSubTreeSize,
-        GP::Individual& inIndividual,
-        GP::Context& ioContext) const
-{
-	Beagle_StackTraceBeginM();
-	RouletteT< std::pair<unsigned int,unsigned int> > lRoulette;
-	GP::Tree::Handle lOldTreeHandle = ioContext.getGenotypeHandle();
-	const unsigned int lOldTreeIndex = ioContext.getGenotypeIndex();
-	ioContext.emptyCallStack();
-	for(unsigned int i=0; i<inIndividual.size(); ++i) {
-		if(inIndividual[i]->getPrimitiveSetIndex() != inPrimitSetIndex) continue;
-		ioContext.setGenotypeHandle(inIndividual[i]);
-		ioContext.setGenotypeIndex(i);
-		buildRoulette(lRoulette,
-		              inSelectABranch,
-		              inMaxSubTreeDepth,
-		              inMaxSubTreeSize,
-		              0,
-		              *inIndividual[i],
-		              ioContext);
-	}
-	ioContext.setGenotypeIndex(lOldTreeIndex);
-	ioContext.setGenotypeHandle(lOldTreeHandle);
-	if(lRoulette.size() == 0) return false;
-	std::pair<unsigned int,unsigned int> lSelectedNode =
-	    lRoulette.select(ioContext.getSystem().getRandomizer());
-	outSelectTreeIndex = lSelectedNode.first;
-	outSelectNodeIndex = lSelectedNode.second;
-	return true;
-	Beagle_StackTraceEndM("bool GP::CrossoverConstrainedOp::selectNodeToMate(unsigned int& outSelectTreeIndex, unsigned int& outSelectNodeIndex, bool inSelectABranch, unsigned int inPrimitSetIndex, unsigned int inMaxSubTreeDepth, unsigned int inMaxSubTreeSize, GP::Individual& inIndividual, GP::Context& ioContext) const");
-}
-
-
-#ifdef BEAGLE_HAVE_RTTI
-
 /*!
  *  \brief Select a node for mating in the given individual, following the constraints penalties.
  *  \param outSelectTreeIndex Tree index of the selected node.
@@ -436,47 +352,45 @@ bool GP::CrossoverConstrainedOp::selectNodeToMate(unsigned int& outSelectTreeInd
  *  \param inPrimitSetIndex Primitive set index to which the tree must be associated.
  *  \param inMaxSubTreeDepth Maximum sub tree depth allowed of the node to be selected.
  *  \param inMaxSubTreeSize Maximum sub tree size allowed of the node to be selected.
+ *  \param inCandidates Nodes of the individual, as indexed by buildCandidates.
+ *  \param ioMatching Work buffer for the candidates meeting the constraints.
  *  \param inIndividual Individual to select the node from.
  *  \param ioContext Evolutionary context.
  *  \return True if there was node to select, false if no node respected all constraints.
  */
-bool GP::CrossoverConstrainedOp::selectNodeToMateWithType(unsigned int& outSelectTreeIndex,
+bool GP::CrossoverConstrainedOp::selectCandidate(unsigned int& outSelectTreeIndex,
         unsigned int& outSelectNodeIndex,
         bool inSelectABranch,
+#ifdef BEAGLE_HAVE_RTTI
         const std::type_info* inNodeReturnType,
+#endif // BEAGLE_HAVE_RTTI
         unsigned int inPrimitSetIndex,
         unsigned int inMaxSubTreeDepth,
         unsigned int inMaxSubTreeSize,
+        const std::vector<MatingCandidate>& inCandidates,
+        std::vector<unsigned int>& ioMatching,
         GP::Individual& inIndividual,
         GP::Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
-	RouletteT< std::pair<unsigned int,unsigned int> > lRoulette;
-	GP::Tree::Handle lOldTreeHandle = ioContext.getGenotypeHandle();
-	const unsigned int lOldTreeIndex = ioContext.getGenotypeIndex();
-	ioContext.emptyCallStack();
-	for(unsigned int i=0; i<inIndividual.size(); ++i) {
-		if(inIndividual[i]->getPrimitiveSetIndex() != inPrimitSetIndex) continue;
-		ioContext.setGenotypeHandle(inIndividual[i]);
-		ioContext.setGenotypeIndex(i);
-		buildRouletteWithType(lRoulette,
-		                      inSelectABranch,
-		                      inNodeReturnType,
-		                      inMaxSubTreeDepth,
-		                      inMaxSubTreeSize,
-		                      0,
-		                      *inIndividual[i],
-		                      ioContext);
+	ioMatching.clear();
+	for(unsigned int i=0; i<inCandidates.size(); ++i) {
+		const MatingCandidate& lCandidate = inCandidates[i];
+		if((inSelectABranch ? lCandidate.mAsBranch : lCandidate.mAsLeaf) == false) continue;
+		if(lCandidate.mSubTreeSize > inMaxSubTreeSize) continue;
+		if((lCandidate.mDepthDown > inMaxSubTreeDepth) || (lCandidate.mDepthUp > inMaxSubTreeDepth)) continue;
+#ifdef BEAGLE_HAVE_RTTI
+		if((inNodeReturnType != NULL) && (lCandidate.mReturnType != NULL) &&
+		        (inNodeReturnType != lCandidate.mReturnType)) continue;
+#endif // BEAGLE_HAVE_RTTI
+		if(inIndividual[lCandidate.mTreeIndex]->getPrimitiveSetIndex() != inPrimitSetIndex) continue;
+		ioMatching.push_back(i);
 	}
-	ioContext.setGenotypeIndex(lOldTreeIndex);
-	ioContext.setGenotypeHandle(lOldTreeHandle);
-	if(lRoulette.size() == 0) return false;
-	std::pair<unsigned int,unsigned int> lSelectedNode =
-	    lRoulette.select(ioContext.getSystem().getRandomizer());
-	outSelectTreeIndex = lSelectedNode.first;
-	outSelectNodeIndex = lSelectedNode.second;
+	if(ioMatching.empty()) return false;
+	const MatingCandidate& lSelected =
+	    inCandidates[ioMatching[ioContext.getSystem().getRandomizer().rollInteger(0, ioMatching.size()-1)]];
+	outSelectTreeIndex = lSelected.mTreeIndex;
+	outSelectNodeIndex = lSelected.mNodeIndex;
 	return true;
-	Beagle_StackTraceEndM("bool GP::CrossoverConstrainedOp::selectNodeToMateWithType(unsigned int& outSelectTreeIndex, unsigned int& outSelectNodeIndex, bool inSelectABranch, const std::type_info* inNodeReturnType, unsigned int inPrimitSetIndex, unsigned int inMaxSubTreeDepth, unsigned int inMaxSubTreeSize, GP::Individual& inIndividual, GP::Context& ioContext) const");
+	Beagle_StackTraceEndM("bool GP::CrossoverConstrainedOp::selectCandidate(unsigned int&,unsigned int&,bool,unsigned int,unsigned int,unsigned int,const std::vector<MatingCandidate>&,std::vector<unsigned int>&,GP::Individual&,GP::Context&) const");
 }
-
-#endif // BEAGLE_HAVE_RTTI
@@ -37,6 +37,7 @@
 #define Beagle_GP_CrossoverConstrainedOp_hpp
 
 #include <string>
+#include <vector>
 
 #include "beagle/config.hpp"
 #include "beagle/macros.hpp"
@@ -91,44 +92,43 @@ public:
 
 protected:
 
-
-	unsigned int buildRoulette(RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette,
-	                           bool inSelectABranch,
-	                           unsigned int inMaxSubTreeDepth,
-	                           unsigned int inMaxSubTreeSize,
-	                           unsigned int inActualIndex,
-	                           GP::Tree& inTree,
-	                           GP::Context& ioContext) const;
-
-	bool selectNodeToMate(unsigned int& outSelectTreeIndex,
-	                      unsigned int& outSelectNodeIndex,
-	                      bool inSelectABranch,
-	                      unsigned int inPrimitSetIndex,
-	                      unsigned int inMaxSubTreeDepth,
-	                      unsigned int inMaxSubTreeSize,
-	                      GP::Individual& inIndividual,
-	                      GP::Context& ioContext) const;
-
+	/*!
+	 *  \brief Node of an individual that can be choosen as the second crossover point.
+	 */
+	struct MatingCandidate
+	{
+		unsigned int          mTreeIndex;    //!< Index of the tree of the node.
+		unsigned int          mNodeIndex;    //!< Index of the node in its tree.
+		unsigned int          mSubTreeSize;  //!< Size of the sub-tree rooted at the node.
+		unsigned int          mDepthDown;    //!< Depth of the sub-tree rooted at the node.
+		unsigned int          mDepthUp;      //!< Depth of the node in its tree, the root being at 1.
+		bool                  mAsBranch;     //!< Whether the node can be choosen as a branch.
+		bool                  mAsLeaf;       //!< Whether the node can be choosen as a leaf.
+#ifdef BEAGLE_HAVE_RTTI
+		const std::type_info* mReturnType;   //!< Return type of the node.
+#endif // BEAGLE_HAVE_RTTI
+	};
+
+	void         buildCandidates(std::vector<MatingCandidate>& outCandidates,
+	                             GP::Individual& inIndividual,
+	                             GP::Context& ioContext) const;
+	unsigned int buildCandidatesOfSubTree(std::vector<MatingCandidate>& ioCandidates,
+	                                      unsigned int inActualIndex,
+	                                      GP::Tree& inTree,
+	                                      GP::Context& ioContext) const;
+	bool         selectCandidate(unsigned int& outSelectTreeIndex,
+	                             unsigned int& outSelectNodeIndex,
+	                             bool inSelectABranch,
 #ifdef BEAGLE_HAVE_RTTI
-	unsigned int buildRouletteWithType(RouletteT< std::pair<unsigned int,unsigned int> >& ioRoulette,
-	                                   bool inSelectABranch,
-	                                   const std::type_info* inNodeReturnType,
-	                                   unsigned int inMaxSubTreeDepth,
-	                                   unsigned int inMaxSubTreeSize,
-	                                   unsigned int inActualIndex,
-	                                   GP::Tree& inTree,
-	                                   GP::Context& ioContext) const;
-
-	bool selectNodeToMateWithType(unsigned int& outSelectTreeIndex,
-	                              unsigned int& outSelectNodeIndex,
-	                              bool inSelectABranch,
-	                              const std::type_info* inNodeReturnType,
-	                              unsigned int inPrimitSetIndex,
-	                              unsigned int inMaxSubTreeDepth,
-	                              unsigned int inMaxSubTreeSize,
-	                              GP::Individual& inIndividual,
-	                              GP::Context& ioContext) const;
+	                             const std::type_info* inNodeReturnType,
 #endif // BEAGLE_HAVE_RTTI
+	                             unsigned int inPrimitSetIndex,
+	                             unsigned int inMaxSubTreeDepth,
+	                             unsigned int inMaxSubTreeSize,
+	                             const std::vector<MatingCandidate>& inCandidates,
+	                             std::vector<unsigned int>& ioMatching,
+	                             GP::Individual& inIndividual,
+	                             GP::Context& ioContext) const;
 
 };
 
@@ -150,6 +150,12 @@ bool GP::CrossoverOp::mate(Beagle::Individual& ioIndiv1, Beagle::Context& ioCont
 	unsigned int     lSizeIndiv1     = 0;
 	for(unsigned int i=0; i<lIndiv1.size(); i++) lSizeIndiv1 += lIndiv1[i]->size();
 
+	// Branches and leaves of the trees, indexed the first time a tree is choosen
+	std::vector< std::vector<unsigned int> > lBranches1(lIndiv1.size());
+	std::vector< std::vector<unsigned int> > lLeaves1(lIndiv1.size());
+	std::vector< std::vector<unsigned int> > lBranches2(lIndiv2.size());
+	std::vector< std::vector<unsigned int> > lLeaves2(lIndiv2.size());
+
 	Beagle_LogDebugM(
 	    ioContext1.getSystem().getLogger(),
 	    "crossover",
@@ -187,16 +193,19 @@ bool GP::CrossoverOp::mate(Beagle::Individual& ioIndiv1, Beagle::Context& ioCont
 		Beagle_AssertM(lChoosenTree1 < lIndiv1.size());
 
 		// Choose a type of node (branch or leaf) following the
-		// distribution probability and change the node for another node
-		// of the same tree if the types mismatch.
+		// distribution probability and draw the node among the nodes
+		// of that type of the same tree.
 		GP::Tree& lTree1 = *lIndiv1[lChoosenTree1];
 		const unsigned int lPrimitiveSetIndex1 = lTree1.getPrimitiveSetIndex();
 		if(lTree1.size() > 1) {
 			bool lTypeNode1 =
 			    (lContext1.getSystem().getRandomizer().rollUniform(0.0, 1.0) < lDistrProba);
-			while((lTree1[lChoosenNode1].mPrimitive->getNumberArguments() != 0) != lTypeNode1) {
-				lChoosenNode1 = lContext1.getSystem().getRandomizer().rollInteger(0, lTree1.size()-1);
+			if(lBranches1[lChoosenTree1].empty()) {
+				lTree1.indexNodesByArity(lBranches1[lChoosenTree1], lLeaves1[lChoosenTree1]);
 			}
+			const std::vector<unsigned int>& lNodes1 =
+			    lTypeNode1 ? lBranches1[lChoosenTree1] : lLeaves1[lChoosenTree1];
+			lChoosenNode1 = lNodes1[lContext1.getSystem().getRandomizer().rollInteger(0, lNodes1.size()-1)];
 		}
 
 		// Choose a node in the second individual from a tree with the same primitive set index.
@@ -235,14 +244,17 @@ bool GP::CrossoverOp::mate(Beagle::Individual& ioIndiv1, Beagle::Context& ioCont
 		GP::Tree& lTree2 = *lIndiv2[lChoosenTree2];
 
 		// Choose a type of node (branch or leaf) following the
-		// distribution probability and change the node for another node
-		// of the same tree if the types mismatch.
+		// distribution probability and draw the node among the nodes
+		// of that type of the same tree.
 		if(lTree2.size() > 1) {
 			bool lTypeNode2 =
 			    (lContext2.getSystem().getRandomizer().rollUniform(0.0, 1.0) < lDistrProba);
-			while((lTree2[lChoosenNode2].mPrimitive->getNumberArguments() != 0) != lTypeNode2) {
-				lChoosenNode2 = lContext2.getSystem().getRandomizer().rollInteger(0, lTree2.size()-1);
+			if(lBranches2[lChoosenTree2].empty()) {
+				lTree2.indexNodesByArity(lBranches2[lChoosenTree2], lLeaves2[lChoosenTree2]);
 			}
+			const std::vector<unsigned int>& lNodes2 =
+			    lTypeNode2 ? lBranches2[lChoosenTree2] : lLeaves2[lChoosenTree2];
+			lChoosenNode2 = lNodes2[lContext2.getSystem().getRandomizer().rollInteger(0, lNodes2.size()-1)];
 		}
 
 		// Set the first context to the node of the first tree.
@@ -370,10 +382,14 @@ void GP::CrossoverOp::mateTrees(GP::Tree& ioTree1, unsigned int inNode1, GP::Con
 		ioTree1.erase(ioTree1.begin()+inNode1+lSwapSize2, ioTree1.begin()+inNode1+lSwapSize1);
 	}
 	int lDiffSize = lSwapSize1 - lSwapSize2;
-	for(unsigned int i=0; i<(ioContext1.getCallStackSize()-1); i++)
+	for(unsigned int i=0; i<(ioContext1.getCallStackSize()-1); i++) {
 		ioTree1[ioContext1.getCallStackElement(i)].mSubTreeSize -= lDiffSize;
-	for(unsigned int j=0; j<(ioContext2.getCallStackSize()-1); j++)
+		ioTree1[ioContext1.getCallStackElement(i)].mSubTreeDepth = 0;
+	}
+	for(unsigned int j=0; j<(ioContext2.getCallStackSize()-1); j++) {
 		ioTree2[ioContext2.getCallStackElement(j)].mSubTreeSize += lDiffSize;
+		ioTree2[ioContext2.getCallStackElement(j)].mSubTreeDepth = 0;
+	}
 	Beagle_StackTraceEndM("void GP::CrossoverOp::mateTrees(GP::Tree& ioTree1, unsigned int inNode1, GP::Context& ioContext1, GP::Tree& ioTree2, unsigned int inNode2, GP::Context& ioContext2)");
 }
 
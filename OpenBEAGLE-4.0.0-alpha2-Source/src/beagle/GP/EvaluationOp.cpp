@@ -59,21 +59,104 @@ Fitness::Handle GP::EvaluationOp::evaluate(Beagle::Individual& inIndividual,
         Beagle::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
-	return evaluate(castObjectT<GP::Individual&>(inIndividual), castObjectT<GP::Context&>(ioContext));
+	GP::Context& lGPContext = castObjectT<GP::Context&>(ioContext);
+	if(mCountNodesPerTree != NULL) {
+		lGPContext.setCountNodesPerTree(mCountNodesPerTree->getWrappedValue());
+		lGPContext.setExecutionTimeCheckPeriod(mTimeCheckPeriod->getWrappedValue());
+	}
+	return evaluate(castObjectT<GP::Individual&>(inIndividual), lGPContext);
 	Beagle_StackTraceEndM("Fitness::Handle GP::EvaluationOp::evaluate(Beagle::Individual& inIndividual, Beagle::Context& ioContext)");
 }
 
 
 /*!
- *  \brief Set the value of the named GP primitive of the primitive sets.
- *  \param inName Name of the variable to set.
- *  \param inValue Value of the primitive.
+ *  \brief Get the primitives of the primitive sets with a given name.
+ *  \param inName Name of the primitives.
+ *  \param outPrimitives Bag where the primitives found are appended, one per primitive set
+ *    containing a primitive with the name.
+ *  \param ioSystem Evolutionary system.
+ *  \throw Beagle::RunTimeException If there is no primitive super set in the system.
+ *
+ *  Evaluation operators setting the variables of the fitness cases can look up their tokens
+ *  once, usually in init(), and then set the plain values wrapped by the tokens for each
+ *  case, instead of calling setValue with a Beagle object to copy.
+ *  \code
+ *  GP::Primitive::Bag lPrimitives;
+ *  getPrimitivesByName("X", lPrimitives, ioSystem);
+ *  GP::TokenT<Double>::Handle lX = castHandleT< GP::TokenT<Double> >(lPrimitives[0]);
+ *  // ...
+ *  lX->getToken().getWrappedValue() = 0.5;
+ *  \endcode
+ */
+void GP::EvaluationOp::getPrimitivesByName(std::string inName,
+        GP::Primitive::Bag& outPrimitives,
+        System& ioSystem) const
+{
+	Beagle_StackTraceBeginM();
+	GP::PrimitiveSuperSet::Handle lSuperSet =
+	    castHandleT<GP::PrimitiveSuperSet>(ioSystem.getComponent("GP-PrimitiveSuperSet"));
+	if(lSuperSet == NULL) {
+		throw Beagle_RunTimeExceptionM("There should be a GP::PrimitiveSuperSet component in the system");
+	}
+	for(unsigned int i=0; i<lSuperSet->size(); i++) {
+		Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(inName);
+		if(lPrimitive != NULL) outPrimitives.push_back(lPrimitive);
+	}
+	Beagle_StackTraceEndM("void GP::EvaluationOp::getPrimitivesByName(std::string,GP::Primitive::Bag&,System&) const");
+}
+
+
+/*!
+ *  \brief Register the parameters of the GP evaluation operator.
+ *  \param ioSystem System of the evolution.
+ */
+void GP::EvaluationOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Beagle::EvaluationOp::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Count the executed nodes per tree, for the maximum number of nodes executed ";
+		lOSS << "set into the GP context. When true, all the nodes of a tree are counted at ";
+		lOSS << "once when the tree (or an ADF) is executed, instead of counting each node ";
+		lOSS << "as it is executed.";
+		Register::Description lDescription(
+		    "Count executed nodes per tree",
+		    "Bool",
+		    "0",
+		    lOSS.str()
+		);
+		mCountNodesPerTree = castHandleT<Bool>(
+		                         ioSystem.getRegister().insertEntry("gp.eval.pertree", new Bool(false), lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Number of execution time checks between two readings of the execution timer, ";
+		lOSS << "for the maximum execution time set into the GP context. A value of 1 reads ";
+		lOSS << "the timer each time a node is executed.";
+		Register::Description lDescription(
+		    "Execution time check period",
+		    "UInt",
+		    "64",
+		    lOSS.str()
+		);
+		mTimeCheckPeriod = castHandleT<UInt>(
+		                       ioSystem.getRegister().insertEntry("gp.eval.timecheck", new UInt(64), lDescription));
+	}
+	Beagle_StackTraceEndM("void GP::EvaluationOp::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Set the packed value of the named Boolean tokens of the primitive sets.
+ *  \param inName Name of the tokens to set, that must be GP::TokenBool primitives.
+ *  \param inValue Packed values of the tokens for 64 fitness cases.
  *  \param ioContext Context of the evaluation.
  *  \throw Beagle::RunTimeException If the named primitive is not found in any sets.
  */
-void GP::EvaluationOp::setValue(std::string inName,
-                                const Object& inValue,
-                                GP::Context& ioContext) const
+void GP::EvaluationOp::setPackedValue(std::string inName,
+                                      const PackedBool& inValue,
+                                      GP::Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
 	GP::PrimitiveSuperSet::Handle lSuperSet =
@@ -82,19 +165,48 @@ void GP::EvaluationOp::setValue(std::string inName,
 		throw Beagle_RunTimeExceptionM("There should be a GP::PrimitiveSuperSet component in the system");
 	}
 	bool lValueFound = false;
+	for(unsigned int i=0; i<lSuperSet->size(); i++) {
+		Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(inName);
+		if(!lPrimitive) continue;
+		lValueFound = true;
+		castHandleT<GP::TokenBool>(lPrimitive)->setPackedToken(inValue);
+	}
+	if(lValueFound == false) {
+		std::string lMessage = "The primitive named '";
+		lMessage += inName;
+		lMessage += "' was not found in any ";
+		lMessage += "of the primitive sets. Maybe the primitive was not properly inserted ";
+		lMessage += "or the name is mispelled.";
+		throw Beagle_RunTimeExceptionM(lMessage);
+	}
+	Beagle_StackTraceEndM("void GP::EvaluationOp::setPackedValue(std::string,const GP::PackedBool&,GP::Context&) const");
+}
+
+
+/*!
+ *  \brief Set the value of the named GP primitive of the primitive sets.
+ *  \param inName Name of the variable to set.
+ *  \param inValue Value of the primitive.
+ *  \param ioContext Context of the evaluation.
+ *  \throw Beagle::RunTimeException If the named primitive is not found in any sets.
+ */
+void GP::EvaluationOp::setValue(std::string inName,
+                                const Object& inValue,
+                                GP::Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
 	Beagle_LogDebugM(
 	    ioContext.getSystem().getLogger(),
 	    "evaluation", "Beagle::GP::EvaluationOp",
 	    std::string("Setting the primitives named '")+inName+
 	    std::string("' to the value: ")+inValue.serialize()
 	);
-	for(unsigned int i=0; i<lSuperSet->size(); i++) {
-		Primitive::Handle lPrimitive = (*lSuperSet)[i]->getPrimitiveByName(inName);
-		if(!lPrimitive) continue;
-		lValueFound = true;
-		lPrimitive->setValue(inValue);
+	GP::Primitive::Bag lPrimitives;
+	getPrimitivesByName(inName, lPrimitives, ioContext.getSystem());
+	for(unsigned int i=0; i<lPrimitives.size(); i++) {
+		lPrimitives[i]->setValue(inValue);
 	}
-	if(lValueFound == false) {
+	if(lPrimitives.empty()) {
 		std::string lMessage = "The primitive named '";
 		lMessage += inName;
 		lMessage += "' was not found in any ";
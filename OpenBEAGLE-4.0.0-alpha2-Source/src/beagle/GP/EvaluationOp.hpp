@@ -45,9 +45,13 @@
 #include "beagle/PointerT.hpp"
 #include "beagle/ContainerT.hpp"
 #include "beagle/EvaluationOp.hpp"
+#include "beagle/Bool.hpp"
+#include "beagle/UInt.hpp"
 #include "beagle/GP/Individual.hpp"
 #include "beagle/GP/Context.hpp"
 #include "beagle/GP/Datum.hpp"
+#include "beagle/GP/Primitive.hpp"
+#include "beagle/GP/PackedBool.hpp"
 
 
 namespace Beagle
@@ -81,6 +85,9 @@ public:
 	{ }
 
 	virtual Fitness::Handle evaluate(Beagle::Individual& inIndividual, Beagle::Context& ioContext);
+	virtual void            registerParams(System& ioSystem);
+	void getPrimitivesByName(std::string inName, GP::Primitive::Bag& outPrimitives, System& ioSystem) const;
+	void setPackedValue(std::string inName, const PackedBool& inValue, GP::Context& ioContext) const;
 	void setValue(std::string inName, const Object& inValue, GP::Context& ioContext) const;
 
 	/*!
@@ -91,6 +98,11 @@ public:
 	 */
 	virtual Fitness::Handle evaluate(GP::Individual& inIndividual, GP::Context& ioContext) =0;
 
+protected:
+
+	Bool::Handle mCountNodesPerTree;  //!< Count the executed nodes per tree.
+	UInt::Handle mTimeCheckPeriod;    //!< Execution time checks between two timer readings.
+
 };
 
 }
@@ -34,7 +34,6 @@
  */
 
 #include "beagle/GP.hpp"
-#include "beagle/RouletteT.hpp"
 
 using namespace Beagle;
 
@@ -106,15 +105,12 @@ unsigned int GP::Individual::chooseRandomNodeWithArgs(unsigned int inTree,
 		throw Beagle_RunTimeExceptionM(lOSS.str());
 	}
 
-	// Loop through the tree adding appropriate nodes into the roulette
-	RouletteT<unsigned int> lRoulette;
-	for (unsigned int i=0; i<lSize; i++) {
-		if(lTree[i].mSubTreeSize > 1) lRoulette.insert(i);
-	}
-
-	// Select node with roulette
-	Beagle_AssertM(!lRoulette.empty());
-	return lRoulette.select(ioContext.getSystem().getRandomizer());
+	// Draw directly among the branches of the tree
+	std::vector<unsigned int> lBranches;
+	std::vector<unsigned int> lLeaves;
+	lTree.indexNodesByArity(lBranches, lLeaves);
+	Beagle_AssertM(!lBranches.empty());
+	return lBranches[ioContext.getSystem().getRandomizer().rollInteger(0, lBranches.size()-1)];
 	Beagle_StackTraceEndM("unsigned int GP::Individual::chooseRandomNodeWithArgs(unsigned int,GP::Context&) const");
 }
 
@@ -128,17 +124,12 @@ unsigned int GP::Individual::chooseRandomNodeWithoutArgs(unsigned int inTree,
         GP::Context& ioContext) const
 {
 	Beagle_StackTraceBeginM();
-	// Loop through the tree adding appropriate nodes into the roulette
-	unsigned int lSize = operator[](inTree)->size();
-	RouletteT<unsigned int> lRoulette;
-	for (unsigned int i=0; i<lSize; i++) {
-		if (operator[](inTree)->operator[](i).mSubTreeSize == 1) {
-			lRoulette.insert(i);
-		}
-	}
-	// Select node with roulette
-	Beagle_AssertM(!lRoulette.empty());
-	return lRoulette.select(ioContext.getSystem().getRandomizer());
+	// Draw directly among the leaves of the tree
+	std::vector<unsigned int> lBranches;
+	std::vector<unsigned int> lLeaves;
+	operator[](inTree)->indexNodesByArity(lBranches, lLeaves);
+	Beagle_AssertM(!lLeaves.empty());
+	return lLeaves[ioContext.getSystem().getRandomizer().rollInteger(0, lLeaves.size()-1)];
 	Beagle_StackTraceEndM("unsigned int GP::Individual::chooseRandomNodeWithoutArgs(unsigned int,GP::Context&) const");
 }
 
@@ -243,8 +234,9 @@ void GP::Individual::run(GP::Datum& outResult, GP::Context& ioContext)
 	    std::string("Executing the first tree root node '")+
 	    (*(*this)[0])[0].mPrimitive->getName()+"'"
 	);
+	ioContext.resetArgumentsFrames();
 	ioContext.setNodesExecutionCount(0);
-	ioContext.incrementNodesExecuted();
+	ioContext.countTreeExecution(*(*this)[0]);
 	ioContext.getExecutionTimer().reset();
 	ioContext.pushCallStack(0);
 	(*(*this)[0])[0].mPrimitive->execute(outResult, ioContext);
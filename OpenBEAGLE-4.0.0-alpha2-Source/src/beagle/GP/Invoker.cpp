@@ -193,7 +193,7 @@ void GP::Invoker::execute(GP::Datum& outResult, GP::Context& ioContext)
 		}
 		lArg->pushExecutionContext(getNumberArguments(), ioContext);
 		invoke(outResult, lTree, ioContext);
-		lArg->popExecutionContext();
+		lArg->popExecutionContext(ioContext);
 	}
 	Beagle_StackTraceEndM("void GP::Invoker::execute(GP::Datum& outResult, GP::Context& ioContext)");
 }
@@ -207,6 +207,8 @@ void GP::Invoker::execute(GP::Datum& outResult, GP::Context& ioContext)
 bool GP::Invoker::isSelectionWeightStable(unsigned int inNumberArguments) const
 {
 	Beagle_StackTraceBeginM();
+	// The candidates of a generator depend on the trees of the actual individual.
+	if(mIndex == eGenerator) return false;
 	const unsigned int lNbArgsPrimit = getNumberArguments();
 	if((inNumberArguments == GP::Primitive::eAny) ||
 	        (lNbArgsPrimit == GP::Primitive::eAny)) return false;
@@ -151,7 +151,7 @@ void GP::Module::invoke(GP::Datum& outResult, GP::Tree::Handle ioTree, GP::Conte
 	unsigned int lOldGenotypeIndex = ioContext.getGenotypeIndex();
 	ioContext.setGenotypeHandle(ioTree);
 	ioContext.setGenotypeIndex(mIndex);
-	ioContext.incrementNodesExecuted();
+	ioContext.countTreeExecution(*ioTree);
 	ioContext.pushCallStack(0);
 	Beagle_LogVerboseM(
 	    ioContext.getSystem().getLogger(),
@@ -246,6 +246,7 @@ bool GP::MutationInsertConstrainedOp::mutate(Beagle::Individual& ioIndividual, B
 		lContext.popCallStack();
 		for(unsigned int j=0; j<lContext.getCallStackSize(); ++j) {
 			(*lNewTree)[lContext[j]].mSubTreeSize += lNbArgsInsertedBranch;
+			(*lNewTree)[lContext[j]].mSubTreeDepth = 0;
 		}
 
 		// Mutation successful, log messages and return
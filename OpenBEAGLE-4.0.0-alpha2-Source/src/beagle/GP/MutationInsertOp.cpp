@@ -266,6 +266,7 @@ bool GP::MutationInsertOp::mutate(Beagle::Individual& ioIndividual, Beagle::Cont
 		lContext.popCallStack();
 		for(unsigned int j=0; j<lContext.getCallStackSize(); ++j) {
 			(*lNewTree)[lContext[j]].mSubTreeSize += lNbArgsInsertedBranch;
+			(*lNewTree)[lContext[j]].mSubTreeDepth = 0;
 		}
 
 		// Mutation successful, log messages and return
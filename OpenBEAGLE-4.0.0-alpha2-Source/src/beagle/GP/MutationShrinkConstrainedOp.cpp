@@ -149,6 +149,7 @@ bool GP::MutationShrinkConstrainedOp::mutate(Beagle::Individual& ioIndividual, B
 		    (*lActualTree)[lChoosenNode].mSubTreeSize - (*lActualTree)[lChoosenArgIndex].mSubTreeSize;
 		for(unsigned int l=0; l<(lContext.getCallStackSize()-1); l++) {
 			(*lIndividual[lChoosenTree])[lContext.getCallStackElement(l)].mSubTreeSize -= lDiffSize;
+			(*lIndividual[lChoosenTree])[lContext.getCallStackElement(l)].mSubTreeDepth = 0;
 		}
 
 		Beagle_LogVerboseM(
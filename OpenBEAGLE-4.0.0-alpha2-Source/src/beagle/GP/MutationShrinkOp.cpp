@@ -156,6 +156,7 @@ bool GP::MutationShrinkOp::mutate(Beagle::Individual& ioIndividual, Beagle::Cont
 	    (*lActualTree)[lChosenNode].mSubTreeSize - (*lActualTree)[lChosenArgIndex].mSubTreeSize;
 	for(unsigned int l=0; l<(lContext.getCallStackSize()-1); l++) {
 		(*lIndividual[lChosenTree])[lContext.getCallStackElement(l)].mSubTreeSize -= lDiffSize;
+		(*lIndividual[lChosenTree])[lContext.getCallStackElement(l)].mSubTreeDepth = 0;
 	}
 
 	Beagle_LogVerboseM(
@@ -166,6 +166,7 @@ bool GP::MutationStandardConstrainedOp::mutate(Beagle::Individual& ioIndividual,
 	    (*lActualTree)[lChoosenNode].mSubTreeSize - (*lNewTree)[lChoosenNode].mSubTreeSize;
 	for(unsigned int l=0; l<lContext.getCallStackSize(); l++) {
 		(*lNewTree)[lContext.getCallStackElement(l)].mSubTreeSize -= lDiffSize;
+		(*lNewTree)[lContext.getCallStackElement(l)].mSubTreeDepth = 0;
 	}
 
 	lContext.setGenotypeIndex(lOldGenotypeIndex);
@@ -435,10 +435,14 @@ void GP::MutationSwapSubtreeOp::exchangeSubTrees(GP::Tree& ioTree1,
 		ioTree1.erase(ioTree1.begin()+inNode1+lSwapSize2, ioTree1.begin()+inNode1+lSwapSize1);
 	}
 	int lDiffSize = lSwapSize1 - lSwapSize2;
-	for(unsigned int i=0; i<(ioContext1.getCallStackSize()-1); i++)
+	for(unsigned int i=0; i<(ioContext1.getCallStackSize()-1); i++) {
 		ioTree1[ioContext1.getCallStackElement(i)].mSubTreeSize -= lDiffSize;
-	for(unsigned int j=0; j<(ioContext2.getCallStackSize()-1); j++)
+		ioTree1[ioContext1.getCallStackElement(i)].mSubTreeDepth = 0;
+	}
+	for(unsigned int j=0; j<(ioContext2.getCallStackSize()-1); j++) {
 		ioTree2[ioContext2.getCallStackElement(j)].mSubTreeSize += lDiffSize;
+		ioTree2[ioContext2.getCallStackElement(j)].mSubTreeDepth = 0;
+	}
 	Beagle_StackTraceEndM("void GP::MutationSwapSubtreeOp::exchangeSubTrees(GP::Tree& ioTree1, unsigned int inNode1, GP::Context& ioContext1, GP::Tree& ioTree2, unsigned int inNode2, GP::Context& ioContext2)");
 }
 
@@ -92,6 +92,14 @@ const std::type_info* GP::Nand::getReturnType(GP::Context& ioContext) const
 void GP::Nand::execute(GP::Datum& outResult, GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
+	if(ioContext.isBitParallel()) {
+		PackedBool& lPackedResult = castObjectT<PackedBool&>(outResult);
+		PackedBool lPackedArg2;
+		get1stArgument(lPackedResult, ioContext);
+		get2ndArgument(lPackedArg2, ioContext);
+		lPackedResult.getWrappedValue() = ~(lPackedResult.getWrappedValue() & lPackedArg2.getWrappedValue());
+		return;
+	}
 	Bool& lResult = castObjectT<Bool&>(outResult);
 	Bool lArg2;
 	get1stArgument(lResult, ioContext);
@@ -92,6 +92,12 @@ const std::type_info* GP::Not::getReturnType(GP::Context& ioContext) const
 void GP::Not::execute(GP::Datum& outResult, GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
+	if(ioContext.isBitParallel()) {
+		PackedBool& lPackedResult = castObjectT<PackedBool&>(outResult);
+		get1stArgument(lPackedResult, ioContext);
+		lPackedResult.getWrappedValue() = ~lPackedResult.getWrappedValue();
+		return;
+	}
 	Bool& lResult = castObjectT<Bool&>(outResult);
 	get1stArgument(lResult, ioContext);
 	lResult = !lResult;
@@ -120,7 +120,9 @@ void GP::PackageBase::configure(Beagle::System& ioSystem)
 	lFactory.insertAllocator("Beagle::GP::Sin", new GP::Sin::Alloc);
 	lFactory.insertAllocator("Beagle::GP::StatsCalcFitnessKozaOp", new GP::StatsCalcFitnessKozaOp::Alloc);
 	lFactory.insertAllocator("Beagle::GP::StatsCalcFitnessSimpleOp", new GP::StatsCalcFitnessSimpleOp::Alloc);
+	lFactory.insertAllocator("Beagle::GP::SubTreeCache", new GP::SubTreeCache::Alloc);
 	lFactory.insertAllocator("Beagle::GP::TermMaxHitsOp", new GP::TermMaxHitsOp::Alloc);
+	lFactory.insertAllocator("Beagle::GP::TokenBool", new GP::TokenBool::Alloc);
 	lFactory.insertAllocator("Beagle::GP::Tree", new GP::Tree::Alloc);
 	lFactory.insertAllocator("Beagle::GP::Xor", new GP::Xor::Alloc);
 
@@ -165,7 +167,9 @@ void GP::PackageBase::configure(Beagle::System& ioSystem)
 	lFactory.aliasAllocator("Beagle::GP::Sin", "GP-Sin");
 	lFactory.aliasAllocator("Beagle::GP::StatsCalcFitnessKozaOp", "GP-StatsCalcFitnessKozaOp");
 	lFactory.aliasAllocator("Beagle::GP::StatsCalcFitnessSimpleOp", "GP-StatsCalcFitnessSimpleOp");
+	lFactory.aliasAllocator("Beagle::GP::SubTreeCache", "GP-SubTreeCache");
 	lFactory.aliasAllocator("Beagle::GP::TermMaxHitsOp", "GP-TermMaxHitsOp");
+	lFactory.aliasAllocator("Beagle::GP::TokenBool", "GP-TokenBool");
 	lFactory.aliasAllocator("Beagle::GP::Tree", "GP-Tree");
 	lFactory.aliasAllocator("Beagle::GP::Xor", "GP-Xor");
 
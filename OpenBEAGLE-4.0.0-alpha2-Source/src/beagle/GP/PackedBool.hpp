@@ -0,0 +1,65 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/GP/PackedBool.hpp
+ *  \brief  Definition of the type GP::PackedBool.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_PackedBool_hpp
+#define Beagle_GP_PackedBool_hpp
+
+#include "stdint.h"
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/WrapperT.hpp"
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \brief Boolean values of 64 fitness cases packed into a word, one case per bit.
+ *  \ingroup GPF
+ *
+ *  When the bit-parallel mode of the GP context is set (see GP::Context::setBitParallel),
+ *  the Boolean primitives (And, Or, Nand, Nor, Not, Xor) and the Boolean tokens
+ *  (GP::TokenBool) exchange packed words instead of Bool datums, so that one run of
+ *  a tree evaluates 64 fitness cases at once.
+ */
+typedef WrapperT< uint64_t > PackedBool;
+
+}
+}
+
+#endif // Beagle_GP_PackedBool_hpp
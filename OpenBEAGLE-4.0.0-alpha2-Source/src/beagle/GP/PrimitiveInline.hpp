@@ -39,6 +39,7 @@
 #include "beagle/GP/Tree.hpp"
 #include "beagle/GP/Context.hpp"
 #include "beagle/GP/Primitive.hpp"
+#include "beagle/GP/SubTreeCache.hpp"
 
 
 /*!
@@ -86,7 +87,8 @@ inline void Beagle::GP::Primitive::getArgument(unsigned int inN,
 	    lActualTree[lNodeIndex].mPrimitive->getName()+std::string("' of the ")+uint2ordinal(lNodeIndex+1)+
 	    std::string(" node of the ")+uint2ordinal(ioContext.getGenotypeIndex()+1)+" tree"
 	);
-	lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	if(ioContext.getSubTreeMemo() == NULL) lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	else ioContext.getSubTreeMemo()->execute(lNodeIndex, outResult, ioContext);
 	ioContext.popCallStack();
 	Beagle_StackTraceEndM("void GP::Primitive::getArgument(unsigned int inN, GP::Datum& outResult, GP::Context& ioContext)");
 }
@@ -113,7 +115,8 @@ inline void Beagle::GP::Primitive::getArguments(Beagle::GP::Datum outResults[],
 	ioContext.incrementNodesExecuted();
 	ioContext.checkExecutionTime();
 	ioContext.pushCallStack(lNodeIndex);
-	lActualTree[lNodeIndex].mPrimitive->execute(*outResults, ioContext);
+	if(ioContext.getSubTreeMemo() == NULL) lActualTree[lNodeIndex].mPrimitive->execute(*outResults, ioContext);
+	else ioContext.getSubTreeMemo()->execute(lNodeIndex, *outResults, ioContext);
 	ioContext.popCallStack();
 	for(unsigned int i=1; i<mNumberArguments; i++) {
 		lNodeIndex += lActualTree[lNodeIndex].mSubTreeSize;
@@ -129,7 +132,8 @@ inline void Beagle::GP::Primitive::getArguments(Beagle::GP::Datum outResults[],
 		    uint2ordinal(lNodeIndex+1)+std::string(" node of the ")+
 		    uint2ordinal(ioContext.getGenotypeIndex()+1)+" tree"
 		);
-		lActualTree[lNodeIndex].mPrimitive->execute(*lResultsI, ioContext);
+		if(ioContext.getSubTreeMemo() == NULL) lActualTree[lNodeIndex].mPrimitive->execute(*lResultsI, ioContext);
+		else ioContext.getSubTreeMemo()->execute(lNodeIndex, *lResultsI, ioContext);
 		ioContext.popCallStack();
 	}
 	Beagle_StackTraceEndM("void GP::Primitive::getArguments(GP::Datum outResults[], size_t inSizeTDatum, GP::Context& ioContext)");
@@ -162,7 +166,8 @@ inline void Beagle::GP::Primitive::get1stArgument(Beagle::GP::Datum& outResult,
 	    uint2ordinal(lNodeIndex+1)+std::string(" node of the ")+
 	    uint2ordinal(ioContext.getGenotypeIndex()+1)+" tree"
 	);
-	ioContext.getGenotype()[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	if(ioContext.getSubTreeMemo() == NULL) ioContext.getGenotype()[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	else ioContext.getSubTreeMemo()->execute(lNodeIndex, outResult, ioContext);
 	Beagle_LogDebugM(
 	    ioContext.getSystem().getLogger(),
 	    "primitive", "Beagle::GP::Primitive",
@@ -202,7 +207,8 @@ inline void Beagle::GP::Primitive::get2ndArgument(Beagle::GP::Datum& outResult,
 	    uint2ordinal(lNodeIndex+1)+std::string(" node of the ")+
 	    uint2ordinal(ioContext.getGenotypeIndex()+1)+" tree"
 	);
-	lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	if(ioContext.getSubTreeMemo() == NULL) lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	else ioContext.getSubTreeMemo()->execute(lNodeIndex, outResult, ioContext);
 	ioContext.popCallStack();
 	Beagle_StackTraceEndM("void GP::Primitive::get2ndArgument(GP::Datum& outResult, GP::Context& ioContext)");
 }
@@ -235,7 +241,8 @@ inline void Beagle::GP::Primitive::get3rdArgument(Beagle::GP::Datum& outResult,
 	    uint2ordinal(lNodeIndex+1)+std::string(" node of the ")+
 	    uint2ordinal(ioContext.getGenotypeIndex()+1)+" tree"
 	);
-	lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	if(ioContext.getSubTreeMemo() == NULL) lActualTree[lNodeIndex].mPrimitive->execute(outResult, ioContext);
+	else ioContext.getSubTreeMemo()->execute(lNodeIndex, outResult, ioContext);
 	ioContext.popCallStack();
 	Beagle_StackTraceEndM("void GP::Primitive::get3rdArgument(GP::Datum& outResult, GP::Context& ioContext)");
 }
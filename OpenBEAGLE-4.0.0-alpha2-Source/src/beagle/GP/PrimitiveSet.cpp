@@ -45,6 +45,7 @@ using namespace Beagle;
  *  \param inRootType Associated tree's root type. Used only with strongly-typed GP.
  */
 GP::PrimitiveSet::PrimitiveSet(const std::type_info* inRootType) :
+		mRoulettesDirty(false),
 		mRootType(inRootType)
 { }
 
@@ -63,6 +64,69 @@ const std::type_info* GP::PrimitiveSet::getRootType() const
 #endif // BEAGLE_HAVE_RTTI
 
 
+/*!
+ *  \brief Build a roulette of the primitives for a given number of arguments.
+ *  \param inNumberArguments Number of arguments of the primitives.
+ *  \param outRoulette Roulette built.
+ *  \param ioContext Reference to the evolutionary context.
+ */
+void GP::PrimitiveSet::buildRoulette(unsigned int inNumberArguments,
+                                     RouletteT<unsigned int>& outRoulette,
+                                     GP::Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	outRoulette.clear();
+	for(unsigned int i=0; i<size(); ++i) {
+		const double lSelectionWeight =
+		    (*this)[i]->getSelectionWeight(inNumberArguments,ioContext) * mSelectionBiases[i];
+		Beagle_AssertM(lSelectionWeight >= 0.0);
+		if(lSelectionWeight!=0.0) outRoulette.insert(i, lSelectionWeight);
+	}
+	Beagle_StackTraceEndM("void GP::PrimitiveSet::buildRoulette(unsigned int,RouletteT<unsigned int>&,GP::Context&) const");
+}
+
+
+/*!
+ *  \brief Build the selection roulettes of the primitive set.
+ *  \param ioContext Reference to the evolutionary context.
+ *
+ *  Roulettes are built for the terminals, the branches, any primitive and the number of
+ *  arguments of each primitive of the set. The roulettes of the primitives whose selection
+ *  weights are stable are kept, and are only read afterward by select, which can then be
+ *  called concurrently. The other roulettes are built at each selection. Inserting a
+ *  primitive marks the roulettes dirty, they are then rebuilt once by the next selection.
+ */
+void GP::PrimitiveSet::init(GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<unsigned int> lNumberArguments;
+	lNumberArguments.push_back(GP::Primitive::eTerminal);
+	lNumberArguments.push_back(GP::Primitive::eBranch);
+	lNumberArguments.push_back(GP::Primitive::eAny);
+	for(unsigned int i=0; i<size(); ++i) {
+		lNumberArguments.push_back((*this)[i]->getNumberArguments());
+	}
+	mRoulettes.clear();
+	for(unsigned int i=0; i<lNumberArguments.size(); ++i) {
+		if(mRoulettes.find(lNumberArguments[i]) != mRoulettes.end()) continue;
+		RoulettePair& lRoulette = mRoulettes[lNumberArguments[i]];
+		lRoulette.first = true;
+		for(unsigned int j=0; j<size(); ++j) {
+			if((*this)[j]->isSelectionWeightStable(lNumberArguments[i]) == false) {
+				lRoulette.first = false;
+				break;
+			}
+		}
+		if(lRoulette.first) {
+			buildRoulette(lNumberArguments[i], lRoulette.second, ioContext);
+			lRoulette.second.optimize();
+		}
+	}
+	mRoulettesDirty = false;
+	Beagle_StackTraceEndM("void GP::PrimitiveSet::init(GP::Context&)");
+}
+
+
 /*!
  *  \brief Register the parameters of this set of primitive.
  *  \param ioSystem System used to initialize the primitive set.
@@ -112,6 +176,8 @@ void GP::PrimitiveSet::insert(GP::Primitive::Handle inPrimitive, double inBias)
 	(*this).push_back(inPrimitive);
 	mNames[inPrimitive->getName()] = inPrimitive;
 	mSelectionBiases.push_back(inBias);
+	mRoulettes.clear();
+	mRoulettesDirty = true;
 	Beagle_StackTraceEndM("void GP::PrimitiveSet::insert(GP::Primitive::Handle,double)");
 }
 
@@ -126,35 +192,25 @@ GP::Primitive::Handle GP::PrimitiveSet::select(unsigned int inNumberArguments,
         GP::Context& ioContext)
 {
 	Beagle_StackTraceBeginM();
-	// Get roulette for inserted primitives.
-	RouletteMap::const_iterator lRouletteIter = mRoulettes.find(inNumberArguments);
-	if((lRouletteIter==mRoulettes.end()) || (lRouletteIter->second.first==false))  {
-		// If the roulette haven't been processed before, evaluate stability flag.
-		if(lRouletteIter==mRoulettes.end()) {
-			RoulettePair& lNewRoulette = mRoulettes[inNumberArguments];
-			lNewRoulette.first = true;
-			for(unsigned int i=0; i<size(); ++i) {
-				if((*this)[i]->isSelectionWeightStable(inNumberArguments) == false) {
-					lNewRoulette.first = false;
-					break;
-				}
-			}
+	// Rebuild the roulettes once if primitives were inserted since init.
+	if(mRoulettesDirty) {
+		#pragma omp critical (Beagle_GP_PrimitiveSet)
+		{
+			if(mRoulettesDirty) init(ioContext);
 		}
-		// Build roulette.
-		RoulettePair& lBuiltRoulette = mRoulettes[inNumberArguments];
-		lBuiltRoulette.second.clear();
-		for(unsigned int i=0; i<size(); ++i) {
-			const double lSelectionWeight =
-			    (*this)[i]->getSelectionWeight(inNumberArguments,ioContext) * mSelectionBiases[i];
-			Beagle_AssertM(lSelectionWeight >= 0.0);
-			if(lSelectionWeight!=0.0) lBuiltRoulette.second.insert(i, lSelectionWeight);
-		}
-		// Optimize if necessary.
-		if(lBuiltRoulette.first) lBuiltRoulette.second.optimize();
 	}
 
-	// Get primitive from roulette
-	RouletteT<unsigned int>& lRoulette = mRoulettes[inNumberArguments].second;
+	// Get the roulette built by init, the primitive set being read-only here.
+	RouletteMap::const_iterator lRouletteIter = mRoulettes.find(inNumberArguments);
+	if((lRouletteIter!=mRoulettes.end()) && lRouletteIter->second.first) {
+		const RouletteT<unsigned int>& lRoulette = lRouletteIter->second.second;
+		if(lRoulette.empty()) return Primitive::Handle(NULL);
+		return (*this)[lRoulette.select(ioContext.getSystem().getRandomizer())];
+	}
+
+	// Selection weights depend on the context, build a roulette for this selection.
+	RouletteT<unsigned int> lRoulette;
+	buildRoulette(inNumberArguments, lRoulette, ioContext);
 	if(lRoulette.empty()) return Primitive::Handle(NULL);
 	return (*this)[lRoulette.select(ioContext.getSystem().getRandomizer())];
 	Beagle_StackTraceEndM("GP::Primitive::Handle GP::PrimitiveSet::select(unsigned int,GP::Context&)");
@@ -221,6 +277,7 @@ void GP::PrimitiveSet::readWithContext(PACC::XML::ConstIterator inIter, GP::Cont
 	mSelectionBiases.clear();
 	mNames.clear();
 	mRoulettes.clear();
+	mRoulettesDirty = true;
 
 	// Read primitives from XML file.
 	for(PACC::XML::ConstIterator lChild=inIter->getFirstChild(); lChild; ++lChild) {
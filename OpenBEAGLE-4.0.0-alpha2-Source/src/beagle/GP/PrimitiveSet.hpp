@@ -84,7 +84,8 @@ public:
 #ifdef BEAGLE_HAVE_RTTI
 	explicit PrimitiveSet(const std::type_info* inRootType=NULL);
 #else  // BEAGLE_HAVE_RTTI
-	PrimitiveSet()
+	PrimitiveSet() :
+			mRoulettesDirty(false)
 	{ }
 #endif // BEAGLE_HAVE_RTTI
 
@@ -95,6 +96,7 @@ public:
 	virtual const std::type_info* getRootType() const;
 #endif // BEAGLE_HAVE_RTTI
 
+	virtual void              init(GP::Context& ioContext);
 	virtual void              registerParams(System& ioSystem);
 	virtual void              insert(Primitive::Handle inPrimitive, double inBias=1.0);
 	virtual Primitive::Handle select(unsigned int inNumberArguments, GP::Context& ioContext);
@@ -142,9 +144,14 @@ protected:
 	typedef std::map< unsigned int,RoulettePair,std::less<unsigned int> >
 	RouletteMap;
 
+	void                buildRoulette(unsigned int inNumberArguments,
+	                                  RouletteT<unsigned int>& outRoulette,
+	                                  GP::Context& ioContext) const;
+
 	std::vector<double> mSelectionBiases;  //!< Selection biases.
 	GP::PrimitiveMap    mNames;            //!< Look-up table (by name).
-	RouletteMap         mRoulettes;        //!< Nb. args -> roulette map.
+	RouletteMap         mRoulettes;        //!< Nb. args -> roulette map, built by init.
+	bool                mRoulettesDirty;   //!< Whether primitives were inserted since the roulettes were built.
 
 #ifdef BEAGLE_HAVE_RTTI
 	const std::type_info* mRootType;       //!< Associated root type. Used only with STGP.
@@ -136,6 +136,28 @@ void GP::PrimitiveSuperSet::insert(GP::PrimitiveSet::Handle inPrimitiveSet, bool
 }
 
 
+/*!
+ *  \brief Initialize the primitive sets, building their selection roulettes.
+ *  \param ioSystem Evolutionary system.
+ */
+void GP::PrimitiveSuperSet::init(Beagle::System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::init(ioSystem);
+	const Factory& lFactory = ioSystem.getFactory();
+	Context::Alloc::Handle lContextAlloc =
+	    castHandleT<Context::Alloc>(lFactory.getConceptAllocator("Context"));
+	GP::Context::Handle lGPContext =
+	    castHandleT<GP::Context>(lContextAlloc->allocate());
+	lGPContext->setSystemHandle(System::Handle(&ioSystem));
+	for(unsigned int i=0; i<mPrimitSets.size(); ++i) {
+		lGPContext->setGenotypeIndex(i);
+		mPrimitSets[i]->init(*lGPContext);
+	}
+	Beagle_StackTraceEndM("void GP::PrimitiveSuperSet::init(Beagle::System&)");
+}
+
+
 /*!
  *  \brief Read a primitive super set from a XML subtree.
  *  \param inIter XML iterator used to read the super set from.
@@ -96,6 +96,7 @@ public:
 		Beagle_StackTraceEndM("PrimitiveSet::Handle& GP::PrimitiveSuperSet::operator[](unsigned int inIndex)");
 	}
 
+	virtual void init(Beagle::System& ioSystem);
 	virtual void registerParams(Beagle::System& ioSystem);
 	virtual void insert(PrimitiveSet::Handle inPrimitiveSet, bool inReplace=false);
 	virtual void readWithSystem(PACC::XML::ConstIterator inIter, Beagle::System& ioSystem);
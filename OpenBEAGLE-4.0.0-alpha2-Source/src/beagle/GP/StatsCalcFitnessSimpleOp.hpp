@@ -84,9 +84,7 @@ public:
 	virtual ~StatsCalcFitnessSimpleOp()
 	{ }
 
-	virtual void calculateStatsDeme(Beagle::Stats& outStats,
-	                                Beagle::Deme& ioDeme,
-	                                Beagle::Context& ioContext) const;
+	virtual void calculateStatsDeme(Stats& outStats, Deme& ioDeme, Beagle::Context& ioContext) const;
 
 };
 
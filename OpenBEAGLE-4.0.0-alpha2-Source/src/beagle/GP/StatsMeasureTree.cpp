@@ -0,0 +1,79 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GP/src/StatsMeasureTree.cpp
+ *  \brief  Source code of class GP::StatsMeasureTree.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/GP.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Get the number of values of the measure.
+ *  \return Two, the maximum tree depth and the total number of nodes.
+ */
+unsigned int GP::StatsMeasureTree::getNumberOfValues(const Beagle::Deme&) const
+{
+	Beagle_StackTraceBeginM();
+	return 2;
+	Beagle_StackTraceEndM("unsigned int GP::StatsMeasureTree::getNumberOfValues(const Deme&) const");
+}
+
+
+/*!
+ *  \brief Get the ID of a value of the measure.
+ *  \param inIndex Index of the value.
+ *  \return "treedepth" for the first value and "treesize" for the second.
+ */
+std::string GP::StatsMeasureTree::getValueID(unsigned int inIndex) const
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(inIndex < 2);
+	return (inIndex == 0) ? "treedepth" : "treesize";
+	Beagle_StackTraceEndM("std::string GP::StatsMeasureTree::getValueID(unsigned int) const");
+}
+
+
+/*!
+ *  \brief Extract the maximum tree depth and total number of nodes of a GP individual.
+ *  \param inIndividual GP individual to extract the values from.
+ *  \param outValues Array of two values where the values are written.
+ */
+void GP::StatsMeasureTree::getValues(const Beagle::Individual& inIndividual, unsigned int, double* outValues) const
+{
+	Beagle_StackTraceBeginM();
+	const GP::Individual& lIndividual = castObjectT<const GP::Individual&>(inIndividual);
+	outValues[0] = (double)lIndividual.getMaxTreeDepth();
+	outValues[1] = (double)lIndividual.getTotalNodes();
+	Beagle_StackTraceEndM("void GP::StatsMeasureTree::getValues(const Individual&,unsigned int,double*) const");
+}
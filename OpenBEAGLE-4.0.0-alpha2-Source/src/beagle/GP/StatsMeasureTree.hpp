@@ -0,0 +1,89 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GP/StatsMeasureTree.hpp
+ *  \brief  Definition of the class GP::StatsMeasureTree.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_StatsMeasureTree_hpp
+#define Beagle_GP_StatsMeasureTree_hpp
+
+#include <string>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Pointer.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/Allocator.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/Container.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/StatsMeasure.hpp"
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class StatsMeasureTree beagle/GP/StatsMeasureTree.hpp "beagle/GP/StatsMeasureTree.hpp"
+ *  \brief Statistics measure of the maximum tree depth and total number of nodes of
+ *    GP individuals, with IDs "treedepth" and "treesize".
+ *  \ingroup GPF
+ */
+class StatsMeasureTree : public StatsMeasure
+{
+
+public:
+
+	//! GP::StatsMeasureTree allocator type.
+	typedef AllocatorT<StatsMeasureTree,StatsMeasure::Alloc> Alloc;
+	//! GP::StatsMeasureTree handle type.
+	typedef PointerT<StatsMeasureTree,StatsMeasure::Handle> Handle;
+	//! GP::StatsMeasureTree bag type.
+	typedef ContainerT<StatsMeasureTree,StatsMeasure::Bag> Bag;
+
+	StatsMeasureTree()
+	{ }
+	virtual ~StatsMeasureTree()
+	{ }
+
+	virtual unsigned int getNumberOfValues(const Beagle::Deme& inDeme) const;
+	virtual std::string  getValueID(unsigned int inIndex) const;
+	virtual void         getValues(const Beagle::Individual& inIndividual, unsigned int inNbValues, double* outValues) const;
+
+};
+
+}
+}
+
+#endif // Beagle_GP_StatsMeasureTree_hpp
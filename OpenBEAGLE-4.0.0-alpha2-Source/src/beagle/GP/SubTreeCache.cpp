@@ -0,0 +1,375 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GP/src/SubTreeCache.cpp
+ *  \brief  Source code of the classes GP::SubTreeCache and GP::SubTreeMemo.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/GP.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct an empty sub-tree memo.
+ */
+GP::SubTreeMemo::SubTreeMemo() :
+		mTree(NULL),
+		mContext(NULL),
+		mCaseSetID(0),
+		mNbCases(0),
+		mCaseIndex(0)
+{ }
+
+
+/*!
+ *  \brief Destruct the sub-tree memo, uninstalling it from the context.
+ */
+GP::SubTreeMemo::~SubTreeMemo()
+{
+	if(mContext != NULL) mContext->setSubTreeMemo(NULL);
+}
+
+
+/*!
+ *  \brief Construct a sub-tree cache component.
+ */
+GP::SubTreeCache::SubTreeCache() :
+		Component("GP-SubTreeCache"),
+		mCaseSetID(0),
+		mNbCases(0)
+{ }
+
+
+/*!
+ *  \brief Remove all entries from the cache.
+ */
+void GP::SubTreeCache::clear()
+{
+	Beagle_StackTraceBeginM();
+	#pragma omp critical (Beagle_GP_SubTreeCache)
+	{
+		mEntries.clear();
+		mIndex.clear();
+	}
+	Beagle_StackTraceEndM("void GP::SubTreeCache::clear()");
+}
+
+
+/*!
+ *  \brief Insert the sub-tree outputs recorded into a memo into the cache.
+ *  \param inMemo Memo filled by prepare, after the evaluation of the individual on all the cases.
+ *
+ *  The memoized tree must not have been modified since the call to prepare. When the cache
+ *  is full, the least recently used entries are removed.
+ */
+void GP::SubTreeCache::commit(const GP::SubTreeMemo& inMemo)
+{
+	Beagle_StackTraceBeginM();
+	if(inMemo.mContext == NULL) return;
+	const GP::Tree& lTree = *inMemo.mTree;
+	for(unsigned int i=0; i<inMemo.mSlotNodes.size(); ++i) {
+		const unsigned int lNodeIndex = inMemo.mSlotNodes[i];
+		if(inMemo.mStates[lNodeIndex] != GP::SubTreeMemo::eRecorded) continue;
+		Entry lEntry;
+		lEntry.mHash = inMemo.mSlotHashes[i];
+		lEntry.mNodes.resize(lTree[lNodeIndex].mSubTreeSize);
+		for(unsigned int j=0; j<lEntry.mNodes.size(); ++j) {
+			lEntry.mNodes[j] = lTree[lNodeIndex+j].mPrimitive;
+		}
+		lEntry.mValues.assign(inMemo.mValues.begin() + i*inMemo.mNbCases,
+		                      inMemo.mValues.begin() + (i+1)*inMemo.mNbCases);
+
+		#pragma omp critical (Beagle_GP_SubTreeCache)
+		{
+			// Outputs could have been inserted meanwhile, or the sub-tree be repeated in the tree
+			bool lFound = (mCaseSetID != inMemo.mCaseSetID) || (mNbCases != inMemo.mNbCases);
+			std::pair<EntryIndex::iterator,EntryIndex::iterator> lRange = mIndex.equal_range(lEntry.mHash);
+			for(EntryIndex::iterator lIter=lRange.first; (lFound==false) && (lIter!=lRange.second); ++lIter) {
+				lFound = isSameSubTree(*lIter->second, lTree, lNodeIndex);
+			}
+			if(lFound == false) {
+				mEntries.push_front(Entry());
+				mEntries.front().mHash = lEntry.mHash;
+				mEntries.front().mNodes.swap(lEntry.mNodes);
+				mEntries.front().mValues.swap(lEntry.mValues);
+				mIndex.insert(std::make_pair(lEntry.mHash, mEntries.begin()));
+				while(mEntries.size() > mCacheSize->getWrappedValue()) {
+					EntryList::iterator lLast = --mEntries.end();
+					std::pair<EntryIndex::iterator,EntryIndex::iterator> lLastRange =
+					    mIndex.equal_range(lLast->mHash);
+					for(EntryIndex::iterator lIter=lLastRange.first; lIter!=lLastRange.second; ++lIter) {
+						if(lIter->second == lLast) {
+							mIndex.erase(lIter);
+							break;
+						}
+					}
+					mEntries.erase(lLast);
+				}
+			}
+		}
+	}
+	Beagle_StackTraceEndM("void GP::SubTreeCache::commit(const GP::SubTreeMemo&)");
+}
+
+
+/*!
+ *  \brief Compute the hash value of a sub-tree.
+ *  \param inTree Tree of the sub-tree.
+ *  \param inNodeIndex Index of the root of the sub-tree.
+ *  \return Hash value of the sub-tree.
+ */
+unsigned int GP::SubTreeCache::hashSubTree(const GP::Tree& inTree, unsigned int inNodeIndex) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lSubTreeSize = inTree[inNodeIndex].mSubTreeSize;
+	unsigned int lHash = Genotype::combineHash(0U, lSubTreeSize);
+	for(unsigned int i=inNodeIndex; i<(inNodeIndex+lSubTreeSize); ++i) {
+		const unsigned long lPrimitiveAddr = (unsigned long)inTree[i].mPrimitive.getPointer();
+		lHash = Genotype::combineHash(lHash, (unsigned int)(lPrimitiveAddr ^ (lPrimitiveAddr >> 16)));
+	}
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GP::SubTreeCache::hashSubTree(const GP::Tree&,unsigned int) const");
+}
+
+
+/*!
+ *  \brief Test whether a cache entry holds the outputs of a sub-tree.
+ *  \param inEntry Cache entry to test.
+ *  \param inTree Tree of the sub-tree.
+ *  \param inNodeIndex Index of the root of the sub-tree.
+ *  \return True if the sub-tree is made of the primitives of the entry, false if not.
+ *
+ *  As the number of arguments of a primitive is fixed, sub-trees with the same primitive
+ *  instances in prefix order have the same structure.
+ */
+bool GP::SubTreeCache::isSameSubTree(const Entry& inEntry,
+                                     const GP::Tree& inTree,
+                                     unsigned int inNodeIndex) const
+{
+	Beagle_StackTraceBeginM();
+	if(inEntry.mNodes.size() != inTree[inNodeIndex].mSubTreeSize) return false;
+	for(unsigned int i=0; i<inEntry.mNodes.size(); ++i) {
+		if(inEntry.mNodes[i] != inTree[inNodeIndex+i].mPrimitive) return false;
+	}
+	return true;
+	Beagle_StackTraceEndM("bool GP::SubTreeCache::isSameSubTree(const Entry&,const GP::Tree&,unsigned int) const");
+}
+
+
+/*!
+ *  \brief Look up the sub-trees of an individual and install a memo into the context.
+ *  \param inIndividual Individual to evaluate.
+ *  \param inCaseSetID Identifier of the set of fitness cases the individual is evaluated on.
+ *  \param inNbCases Number of fitness cases.
+ *  \param outMemo Memo where the outputs of the sub-trees are served or recorded.
+ *  \param ioContext Evolutionary context.
+ *  \return True if the memo is installed into the context, false if the individual is not memoized.
+ *
+ *  The identifier of the case set must change whenever the fitness cases the individual
+ *  is evaluated on change, which clears the cache.
+ */
+bool GP::SubTreeCache::prepare(GP::Individual& inIndividual,
+                               unsigned int inCaseSetID,
+                               unsigned int inNbCases,
+                               GP::SubTreeMemo& outMemo,
+                               GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_AssertM(outMemo.mContext == NULL);
+	Beagle_AssertM(ioContext.getSubTreeMemo() == NULL);
+#ifdef BEAGLE_HAVE_RTTI
+	if(mCacheSize->getWrappedValue() == 0) return false;
+	if((inIndividual.size() != 1) || (inNbCases == 0)) return false;
+	GP::Tree& lTree = *inIndividual[0];
+	if(lTree.size() < 2) return false;
+
+	outMemo.mTree = &lTree;
+	outMemo.mCaseSetID = inCaseSetID;
+	outMemo.mNbCases = inNbCases;
+	outMemo.mCaseIndex = 0;
+	outMemo.mStates.assign(lTree.size(), GP::SubTreeMemo::eExecuted);
+	outMemo.mSlots.assign(lTree.size(), 0);
+	outMemo.mSlotNodes.clear();
+	outMemo.mSlotHashes.clear();
+
+	// Select the candidate sub-trees, in the context of the tree interpretation
+	GP::Tree::Handle lOldTreeHandle = ioContext.getGenotypeHandle();
+	const unsigned int lOldTreeIndex = ioContext.getGenotypeIndex();
+	ioContext.setGenotypeIndex(0);
+	ioContext.setGenotypeHandle(inIndividual[0]);
+	ioContext.pushCallStack(0);
+	for(unsigned int i=1; i<lTree.size(); i+=lTree[i].mSubTreeSize) {
+		prepareSubTree(lTree, i, outMemo, ioContext);
+	}
+	ioContext.popCallStack();
+	ioContext.setGenotypeHandle(lOldTreeHandle);
+	ioContext.setGenotypeIndex(lOldTreeIndex);
+	if(outMemo.mSlotNodes.empty()) return false;
+	outMemo.mValues.resize(outMemo.mSlotNodes.size() * inNbCases);
+
+	// Serve the outputs of the sub-trees found, outside the sub-trees already served
+	#pragma omp critical (Beagle_GP_SubTreeCache)
+	{
+		if((inCaseSetID != mCaseSetID) || (inNbCases != mNbCases)) {
+			mEntries.clear();
+			mIndex.clear();
+			mCaseSetID = inCaseSetID;
+			mNbCases = inNbCases;
+		}
+		const unsigned int lDemeIndex = ioContext.getDemeIndex();
+		if(lDemeIndex >= mHits.size()) {
+			mHits.resize(lDemeIndex+1, 0);
+			mMisses.resize(lDemeIndex+1, 0);
+		}
+		unsigned int lServedEnd = 0;
+		for(unsigned int i=0; i<outMemo.mSlotNodes.size(); ++i) {
+			const unsigned int lNodeIndex = outMemo.mSlotNodes[i];
+			if(lNodeIndex < lServedEnd) continue;
+			bool lFound = false;
+			std::pair<EntryIndex::iterator,EntryIndex::iterator> lRange =
+			    mIndex.equal_range(outMemo.mSlotHashes[i]);
+			for(EntryIndex::iterator lIter=lRange.first; lIter!=lRange.second; ++lIter) {
+				if(isSameSubTree(*lIter->second, lTree, lNodeIndex)) {
+					// Move entry to the front of the list, as the most recently used
+					mEntries.splice(mEntries.begin(), mEntries, lIter->second);
+					std::copy(lIter->second->mValues.begin(), lIter->second->mValues.end(),
+					          outMemo.mValues.begin() + i*inNbCases);
+					lFound = true;
+					break;
+				}
+			}
+			if(lFound) {
+				outMemo.mStates[lNodeIndex] = GP::SubTreeMemo::eServed;
+				lServedEnd = lNodeIndex + lTree[lNodeIndex].mSubTreeSize;
+				++mHits[lDemeIndex];
+			} else {
+				outMemo.mStates[lNodeIndex] = GP::SubTreeMemo::eRecorded;
+				++mMisses[lDemeIndex];
+			}
+		}
+	}
+
+	outMemo.mContext = &ioContext;
+	ioContext.setSubTreeMemo(&outMemo);
+	return true;
+#else // BEAGLE_HAVE_RTTI
+	return false;
+#endif // BEAGLE_HAVE_RTTI
+	Beagle_StackTraceEndM("bool GP::SubTreeCache::prepare(GP::Individual&,unsigned int,unsigned int,GP::SubTreeMemo&,GP::Context&)");
+}
+
+
+/*!
+ *  \brief Select recursively the sub-trees to look up in the cache.
+ *  \param inTree Memoized tree.
+ *  \param inNodeIndex Index of the root of the sub-tree.
+ *  \param ioMemo Memo where the selected sub-trees are added as slots.
+ *  \param ioContext Evolutionary context, with the sub-tree on top of the call stack.
+ */
+void GP::SubTreeCache::prepareSubTree(GP::Tree& inTree,
+                                      unsigned int inNodeIndex,
+                                      GP::SubTreeMemo& ioMemo,
+                                      GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lSubTreeSize = inTree[inNodeIndex].mSubTreeSize;
+	if(lSubTreeSize < mMinSize->getWrappedValue()) return;
+	ioContext.pushCallStack(inNodeIndex);
+#ifdef BEAGLE_HAVE_RTTI
+	const std::type_info* lReturnType = inTree[inNodeIndex].mPrimitive->getReturnType(ioContext);
+	if((lReturnType != NULL) && (*lReturnType == typeid(Double))) {
+		ioMemo.mSlots[inNodeIndex] = ioMemo.mSlotNodes.size();
+		ioMemo.mSlotNodes.push_back(inNodeIndex);
+		ioMemo.mSlotHashes.push_back(hashSubTree(inTree, inNodeIndex));
+	}
+#endif // BEAGLE_HAVE_RTTI
+	const unsigned int lEnd = inNodeIndex + lSubTreeSize;
+	for(unsigned int i=inNodeIndex+1; i<lEnd; i+=inTree[i].mSubTreeSize) {
+		prepareSubTree(inTree, i, ioMemo, ioContext);
+	}
+	ioContext.popCallStack();
+	Beagle_StackTraceEndM("void GP::SubTreeCache::prepareSubTree(GP::Tree&,unsigned int,GP::SubTreeMemo&,GP::Context&)");
+}
+
+
+/*!
+ *  \brief Register the parameters of the sub-tree cache.
+ *  \param ioSystem Evolutionary system.
+ */
+void GP::SubTreeCache::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Component::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Maximum number of sub-trees whose outputs over the fitness cases are kept ";
+		lOSS << "in the sub-tree cache. The least recently used sub-trees are dropped when ";
+		lOSS << "the cache is full. A value of zero disables the cache.";
+		Register::Description lDescription(
+		    "Sub-tree cache size",
+		    "UInt",
+		    "0",
+		    lOSS.str()
+		);
+		mCacheSize = castHandleT<UInt>(
+		                 ioSystem.getRegister().insertEntry("gp.subtree.cachesize", new UInt(0), lDescription));
+	}
+	{
+		Register::Description lDescription(
+		    "Sub-tree cache minimum size",
+		    "UInt",
+		    "3",
+		    "Minimum number of nodes of the sub-trees whose outputs are cached."
+		);
+		mMinSize = castHandleT<UInt>(
+		               ioSystem.getRegister().insertEntry("gp.subtree.minsize", new UInt(3), lDescription));
+	}
+	Beagle_StackTraceEndM("void GP::SubTreeCache::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Reset the hit and miss counters of a deme.
+ *  \param inDemeIndex Index of the deme.
+ */
+void GP::SubTreeCache::resetCounters(unsigned int inDemeIndex)
+{
+	Beagle_StackTraceBeginM();
+	#pragma omp critical (Beagle_GP_SubTreeCache)
+	{
+		if(inDemeIndex < mHits.size()) {
+			mHits[inDemeIndex] = 0;
+			mMisses[inDemeIndex] = 0;
+		}
+	}
+	Beagle_StackTraceEndM("void GP::SubTreeCache::resetCounters(unsigned int)");
+}
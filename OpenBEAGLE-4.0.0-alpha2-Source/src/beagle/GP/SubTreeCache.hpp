@@ -0,0 +1,301 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/GP/SubTreeCache.hpp
+ *  \brief  Definition of the classes GP::SubTreeCache and GP::SubTreeMemo.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_SubTreeCache_hpp
+#define Beagle_GP_SubTreeCache_hpp
+
+#include <list>
+#include <map>
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Pointer.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/Allocator.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/Container.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Component.hpp"
+#include "beagle/UInt.hpp"
+#include "beagle/Double.hpp"
+#include "beagle/castObjectT.hpp"
+#include "beagle/GP/Datum.hpp"
+#include "beagle/GP/Primitive.hpp"
+#include "beagle/GP/Tree.hpp"
+#include "beagle/GP/Individual.hpp"
+#include "beagle/GP/Context.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class SubTreeMemo beagle/GP/SubTreeCache.hpp "beagle/GP/SubTreeCache.hpp"
+ *  \brief Sub-tree outputs served or recorded during the evaluation of one individual.
+ *  \ingroup GPF
+ *
+ *  A memo is filled by SubTreeCache::prepare, which installs it into the GP context.
+ *  While it is installed, the primitives fetching their arguments take the outputs of
+ *  the sub-trees found in the cache from the memo instead of executing them, and record
+ *  the outputs of the other selected sub-trees. The recorded outputs are inserted into
+ *  the cache by SubTreeCache::commit. The memo is uninstalled from the context when it
+ *  is destroyed.
+ */
+class SubTreeMemo
+{
+
+public:
+
+	SubTreeMemo();
+	~SubTreeMemo();
+
+	/*!
+	 *  \brief Execute a node of the memoized tree, or serve its output from the memo.
+	 *  \param inNodeIndex Index of the node to execute.
+	 *  \param outResult Result of the execution.
+	 *  \param ioContext Evolutionary context.
+	 */
+	inline void execute(unsigned int inNodeIndex, GP::Datum& outResult, GP::Context& ioContext)
+	{
+		Beagle_StackTraceBeginM();
+		GP::Tree& lActualTree = ioContext.getGenotype();
+		if(&lActualTree != mTree) {
+			lActualTree[inNodeIndex].mPrimitive->execute(outResult, ioContext);
+			return;
+		}
+		const unsigned char lState = mStates[inNodeIndex];
+		if(lState == eServed) {
+			castObjectT<Double&>(outResult).getWrappedValue() =
+			    mValues[mSlots[inNodeIndex]*mNbCases + mCaseIndex];
+			return;
+		}
+		lActualTree[inNodeIndex].mPrimitive->execute(outResult, ioContext);
+		if(lState == eRecorded) {
+			mValues[mSlots[inNodeIndex]*mNbCases + mCaseIndex] =
+			    castObjectT<Double&>(outResult).getWrappedValue();
+		}
+		Beagle_StackTraceEndM("void GP::SubTreeMemo::execute(unsigned int,GP::Datum&,GP::Context&)");
+	}
+
+	/*!
+	 *  \return Index of the fitness case actually evaluated.
+	 */
+	inline unsigned int getCaseIndex() const
+	{
+		Beagle_StackTraceBeginM();
+		return mCaseIndex;
+		Beagle_StackTraceEndM("unsigned int GP::SubTreeMemo::getCaseIndex() const");
+	}
+
+	/*!
+	 *  \brief Set the index of the fitness case actually evaluated.
+	 *  \param inCaseIndex Index of the fitness case, in the case set given to SubTreeCache::prepare.
+	 */
+	inline void setCaseIndex(unsigned int inCaseIndex)
+	{
+		Beagle_StackTraceBeginM();
+		Beagle_UpperBoundCheckAssertM(inCaseIndex, mNbCases-1);
+		mCaseIndex = inCaseIndex;
+		Beagle_StackTraceEndM("void GP::SubTreeMemo::setCaseIndex(unsigned int)");
+	}
+
+protected:
+
+	friend class SubTreeCache;
+
+	//! State of a node of the memoized tree.
+	enum NodeState {
+	    eExecuted=0,  //!< Node is executed normally.
+	    eServed,      //!< Node output is served from the memo.
+	    eRecorded     //!< Node is executed and its output recorded into the memo.
+	};
+
+	std::vector<unsigned char> mStates;     //!< State of each node of the memoized tree.
+	std::vector<unsigned int>  mSlots;      //!< Memo slot of each served or recorded node.
+	std::vector<unsigned int>  mSlotNodes;  //!< Node index of each memo slot.
+	std::vector<unsigned int>  mSlotHashes; //!< Hash value of the sub-tree of each memo slot.
+	std::vector<double>        mValues;     //!< Outputs of the slots, by slot then by case.
+	GP::Tree*                  mTree;       //!< Memoized tree.
+	GP::Context*               mContext;    //!< Context where the memo is installed.
+	unsigned int               mCaseSetID;  //!< Identifier of the case set of the outputs.
+	unsigned int               mNbCases;    //!< Number of fitness cases.
+	unsigned int               mCaseIndex;  //!< Index of the fitness case actually evaluated.
+
+private:
+
+	SubTreeMemo(const SubTreeMemo&);
+	SubTreeMemo& operator=(const SubTreeMemo&);
+
+};
+
+
+/*!
+ *  \class SubTreeCache beagle/GP/SubTreeCache.hpp "beagle/GP/SubTreeCache.hpp"
+ *  \brief Bounded cache of the outputs of GP sub-trees over a set of fitness cases.
+ *  \ingroup GPF
+ *
+ *  Offspring share most of their sub-trees with their parents, and the sub-trees of
+ *  building blocks spreading in the population are re-evaluated on every fitness case
+ *  for every individual containing them. When this component is installed and
+ *  \c gp.subtree.cachesize is not zero, an evaluation operator can look up the
+ *  sub-trees of an individual before interpreting it on its fitness cases:
+ *
+ *  \code
+ *  GP::SubTreeCache::Handle lCache =
+ *    castHandleT<GP::SubTreeCache>(ioContext.getSystem().haveComponent("GP-SubTreeCache"));
+ *  GP::SubTreeMemo lMemo;
+ *  if(lCache != NULL) lCache->prepare(inIndividual, 0, lNbCases, lMemo, ioContext);
+ *  for(unsigned int i=0; i<lNbCases; ++i) {
+ *    lMemo.setCaseIndex(i);
+ *    // Set the variables and run the individual
+ *  }
+ *  if(lCache != NULL) lCache->commit(lMemo);
+ *  \endcode
+ *
+ *  Sub-trees are keyed by a hash value of their primitives, a hit being confirmed by a
+ *  comparison of the primitive instances. Only the sub-trees returning a Double value
+ *  and made of at least \c gp.subtree.minsize nodes are cached, the outputs of a
+ *  sub-tree for all the fitness cases being stored together. The least recently used
+ *  sub-trees are dropped when the cache holds more than \c gp.subtree.cachesize entries.
+ *  The cache is cleared when the case set identifier or the number of cases given to
+ *  prepare changes.
+ *
+ *  \warning The outputs of a sub-tree must depend only on its primitives and on the
+ *    fitness case. Individuals with more than one tree, where the outputs of the
+ *    ADFs depend on the other trees, are not memoized. The return types of the
+ *    primitives are needed to select the sub-trees, so the cache is inactive when
+ *    Open BEAGLE is compiled without RTTI.
+ */
+class SubTreeCache : public Component
+{
+
+public:
+
+	//! GP::SubTreeCache allocator type.
+	typedef AllocatorT<SubTreeCache,Component::Alloc> Alloc;
+	//! GP::SubTreeCache handle type.
+	typedef PointerT<SubTreeCache,Component::Handle> Handle;
+	//! GP::SubTreeCache bag type.
+	typedef ContainerT<SubTreeCache,Component::Bag> Bag;
+
+	explicit SubTreeCache();
+	virtual ~SubTreeCache()
+	{ }
+
+	void          clear();
+	void          commit(const GP::SubTreeMemo& inMemo);
+	bool          prepare(GP::Individual& inIndividual,
+	                      unsigned int inCaseSetID,
+	                      unsigned int inNbCases,
+	                      GP::SubTreeMemo& outMemo,
+	                      GP::Context& ioContext);
+	virtual void  registerParams(System& ioSystem);
+	void          resetCounters(unsigned int inDemeIndex);
+
+	/*!
+	 *  \param inDemeIndex Index of the deme.
+	 *  \return Number of sub-trees of individuals of the deme found in the cache since the
+	 *    counters of the deme were reset.
+	 */
+	inline unsigned int getHits(unsigned int inDemeIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		return (inDemeIndex < mHits.size()) ? mHits[inDemeIndex] : 0;
+		Beagle_StackTraceEndM("unsigned int GP::SubTreeCache::getHits(unsigned int) const");
+	}
+
+	/*!
+	 *  \param inDemeIndex Index of the deme.
+	 *  \return Number of sub-trees of individuals of the deme not found in the cache since the
+	 *    counters of the deme were reset.
+	 */
+	inline unsigned int getMisses(unsigned int inDemeIndex) const
+	{
+		Beagle_StackTraceBeginM();
+		return (inDemeIndex < mMisses.size()) ? mMisses[inDemeIndex] : 0;
+		Beagle_StackTraceEndM("unsigned int GP::SubTreeCache::getMisses(unsigned int) const");
+	}
+
+	/*!
+	 *  \return Number of entries actually in the cache.
+	 */
+	inline unsigned int getSize() const
+	{
+		Beagle_StackTraceBeginM();
+		return mEntries.size();
+		Beagle_StackTraceEndM("unsigned int GP::SubTreeCache::getSize() const");
+	}
+
+protected:
+
+	/*!
+	 *  \brief Cache entry, the outputs of a sub-tree over the fitness cases.
+	 */
+	struct Entry
+	{
+		unsigned int                       mHash;    //!< Hash value of the sub-tree.
+		std::vector<GP::Primitive::Handle> mNodes;   //!< Primitives of the sub-tree, in prefix order.
+		std::vector<double>                mValues;  //!< Outputs of the sub-tree for each fitness case.
+	};
+
+	typedef std::list<Entry> EntryList;
+	typedef std::multimap<unsigned int,EntryList::iterator> EntryIndex;
+
+	unsigned int  hashSubTree(const GP::Tree& inTree, unsigned int inNodeIndex) const;
+	bool          isSameSubTree(const Entry& inEntry, const GP::Tree& inTree, unsigned int inNodeIndex) const;
+	void          prepareSubTree(GP::Tree& inTree,
+	                             unsigned int inNodeIndex,
+	                             GP::SubTreeMemo& ioMemo,
+	                             GP::Context& ioContext);
+
+	UInt::Handle  mCacheSize;   //!< Maximum number of entries in the cache.
+	UInt::Handle  mMinSize;     //!< Minimum number of nodes of the cached sub-trees.
+	EntryList     mEntries;     //!< Cache entries, from the most to the least recently used.
+	EntryIndex    mIndex;       //!< Index of the entries by hash value.
+	unsigned int  mCaseSetID;   //!< Identifier of the case set of the cached outputs.
+	unsigned int  mNbCases;     //!< Number of fitness cases of the cached outputs.
+	std::vector<unsigned int> mHits;    //!< Number of hits of each deme since its counters were reset.
+	std::vector<unsigned int> mMisses;  //!< Number of misses of each deme since its counters were reset.
+
+};
+
+}
+}
+
+#endif // Beagle_GP_SubTreeCache_hpp
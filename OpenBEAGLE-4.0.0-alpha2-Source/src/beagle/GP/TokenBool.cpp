@@ -0,0 +1,87 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/GP/src/TokenBool.cpp
+ *  \brief  Source code of class GP::TokenBool.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/GP.hpp"
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a new Boolean token primitive.
+ *  \param inName Name of the token.
+ */
+GP::TokenBool::TokenBool(std::string inName) :
+		GP::TokenT<Bool>(inName),
+		mPackedToken(0)
+{ }
+
+
+/*!
+ *  \brief Construct a new Boolean token primitive.
+ *  \param inName Name of the token.
+ *  \param inToken Value of the token.
+ */
+GP::TokenBool::TokenBool(std::string inName, const Bool& inToken) :
+		GP::TokenT<Bool>(inName, inToken),
+		mPackedToken(inToken.getWrappedValue() ? ~uint64_t(0) : uint64_t(0))
+{ }
+
+
+/*!
+ *  \brief Return the value of the token, packed if the context is in bit-parallel mode.
+ *  \param outResult Value of the token.
+ *  \param ioContext Evolutionary context.
+ */
+void GP::TokenBool::execute(GP::Datum& outResult, GP::Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(ioContext.isBitParallel()) castObjectT<PackedBool&>(outResult) = mPackedToken;
+	else castObjectT<Bool&>(outResult) = mToken;
+	Beagle_StackTraceEndM("void GP::TokenBool::execute(GP::Datum&,GP::Context&)");
+}
+
+
+/*!
+ *  \brief Set the value of the token, for all the fitness cases of the packed value.
+ *  \param inValue Bool value of the token.
+ */
+void GP::TokenBool::setValue(const Object& inValue)
+{
+	Beagle_StackTraceBeginM();
+	GP::TokenT<Bool>::setValue(inValue);
+	mPackedToken = mToken.getWrappedValue() ? ~uint64_t(0) : uint64_t(0);
+	Beagle_StackTraceEndM("void GP::TokenBool::setValue(const Object&)");
+}
@@ -0,0 +1,127 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/GP/TokenBool.hpp
+ *  \brief  Definition of the class GP::TokenBool.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_GP_TokenBool_hpp
+#define Beagle_GP_TokenBool_hpp
+
+#include <string>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Bool.hpp"
+#include "beagle/GP/TokenT.hpp"
+#include "beagle/GP/PackedBool.hpp"
+#include "beagle/GP/Context.hpp"
+#include "beagle/GP/Datum.hpp"
+
+
+namespace Beagle
+{
+namespace GP
+{
+
+/*!
+ *  \class TokenBool beagle/GP/TokenBool.hpp "beagle/GP/TokenBool.hpp"
+ *  \brief GP Boolean token terminal primitive class, usable in bit-parallel mode.
+ *  \ingroup GPF
+ *  \ingroup Primit
+ *  \ingroup FunctPrimit
+ *
+ *  The token behaves as a GP::TokenT<Bool>, except that when the context is in bit-parallel
+ *  mode, it returns its packed value, a word holding its value for 64 fitness cases.
+ *  The packed value is set with setPackedToken or GP::EvaluationOp::setPackedValue. Setting
+ *  a Bool value with setValue broadcasts it to the 64 fitness cases of the packed value.
+ */
+class TokenBool : public TokenT<Bool>
+{
+
+public:
+
+	//! GP::TokenBool allocator type.
+	typedef AllocatorT<TokenBool,TokenT<Bool>::Alloc>
+	Alloc;
+	//! GP::TokenBool handle type.
+	typedef PointerT<TokenBool,TokenT<Bool>::Handle>
+	Handle;
+	//! GP::TokenBool bag type.
+	typedef ContainerT<TokenBool,TokenT<Bool>::Bag>
+	Bag;
+
+	explicit TokenBool(std::string inName="TOKEN");
+	explicit TokenBool(std::string inName, const Bool& inToken);
+	virtual ~TokenBool()
+	{ }
+
+	virtual void execute(GP::Datum& outResult, GP::Context& ioContext);
+	virtual void setValue(const Object& inValue);
+
+	/*!
+	 *  \brief Get the packed value of the token.
+	 *  \return Values of the token for 64 fitness cases, one per bit.
+	 */
+	inline const PackedBool& getPackedToken() const
+	{
+		Beagle_StackTraceBeginM();
+		return mPackedToken;
+		Beagle_StackTraceEndM("const GP::PackedBool& GP::TokenBool::getPackedToken() const");
+	}
+
+	/*!
+	 *  \brief Set the packed value of the token.
+	 *  \param inPackedToken Values of the token for 64 fitness cases, one per bit.
+	 */
+	inline void setPackedToken(const PackedBool& inPackedToken)
+	{
+		Beagle_StackTraceBeginM();
+		mPackedToken = inPackedToken;
+		Beagle_StackTraceEndM("void GP::TokenBool::setPackedToken(const GP::PackedBool&)");
+	}
+
+protected:
+
+	PackedBool mPackedToken;  //!< Packed value of the token, used in bit-parallel mode.
+
+};
+
+}
+}
+
+
+#endif // Beagle_GP_TokenBool_hpp
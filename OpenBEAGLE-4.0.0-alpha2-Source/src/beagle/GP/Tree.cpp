@@ -44,10 +44,12 @@ using namespace Beagle;
  *  \brief Construct a GP node.
  *  \param inPrimitive Handle to the primitive refered by the node.
  *  \param inSubTreeSize Sub-tree size, including actual node.
+ *  \param inSubTreeDepth Sub-tree depth, zero when unknown.
  */
-GP::Node::Node(GP::Primitive::Handle inPrimitive, unsigned int inSubTreeSize) :
+GP::Node::Node(GP::Primitive::Handle inPrimitive, unsigned int inSubTreeSize, unsigned int inSubTreeDepth) :
 		mPrimitive(inPrimitive),
-		mSubTreeSize(inSubTreeSize)
+		mSubTreeSize(inSubTreeSize),
+		mSubTreeDepth(inSubTreeDepth)
 { }
 
 
@@ -100,6 +102,25 @@ void GP::Tree::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Compute the hash value of the GP tree from its content.
+ *  \return Hash value of the GP tree.
+ */
+unsigned int GP::Tree::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	// Nodes are equal when they refer to the same primitive instance with the same sub-tree size.
+	unsigned int lHash = combineHash(0U, (unsigned int)size());
+	for(unsigned int i=0; i<size(); ++i) {
+		const unsigned long lPrimitiveAddr = (unsigned long)(*this)[i].mPrimitive.getPointer();
+		lHash = combineHash(lHash, (unsigned int)(lPrimitiveAddr ^ (lPrimitiveAddr >> 16)));
+		lHash = combineHash(lHash, (*this)[i].mSubTreeSize);
+	}
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int GP::Tree::computeHash() const");
+}
+
+
 /*!
  *  \brief Turn tree into C function.
  *  \return Resulting code of C function.
@@ -144,6 +165,8 @@ unsigned int GP::Tree::deparseSubTree(std::string& outResult, unsigned int inN)
  *    inNodeIndex. (Defaults to fixing the entire tree.)
  *  \param inNodeIndex The first node of the subtree to fix.
  *  \return The size of the fixed subtree
+ *  \par Note:
+ *    The 'mSubTreeDepth' fields of the subtree are fixed along the sizes.
  */
 unsigned int GP::Tree::fixSubTreeSize(unsigned int inNodeIndex)
 {
@@ -154,18 +177,22 @@ unsigned int GP::Tree::fixSubTreeSize(unsigned int inNodeIndex)
 	if(lNumArgs==0) {
 		// This is a terminal
 		(*this)[inNodeIndex].mSubTreeSize = 1;
+		(*this)[inNodeIndex].mSubTreeDepth = 1;
 		return 1;
 	} else {
 		// This is a branch
 		// Loop through the args, correcting each of those
 		unsigned int lSubTreeSize = 1;
+		unsigned int lSubTreeDepth = 1;
 		unsigned int lNodeIndex = inNodeIndex+1;
 		for(unsigned int i=0; i<lNumArgs; i++) {
 			const unsigned int lThisSubTreeSize = fixSubTreeSize(lNodeIndex);
+			lSubTreeDepth = maxOf<unsigned int>(lSubTreeDepth, (*this)[lNodeIndex].mSubTreeDepth+1);
 			lSubTreeSize += lThisSubTreeSize;
 			lNodeIndex += lThisSubTreeSize;
 		}
 		(*this)[inNodeIndex].mSubTreeSize = lSubTreeSize;
+		(*this)[inNodeIndex].mSubTreeDepth = lSubTreeDepth;
 		return lSubTreeSize;
 	}
 	Beagle_StackTraceEndM("unsigned int GP::Tree::fixSubTreeSize(unsigned int)");
@@ -233,6 +260,10 @@ unsigned int GP::Tree::getSize() const
  *  \param inNodeIndex Index of the node root to the sub-tree.
  *  \return Depth to the given sub-tree.
  *  \throw Beagle::AssertException If the node index given is to out-of-bound.
+ *
+ *  The depths are cached into the nodes, only the sub-trees with an unknown depth being
+ *  visited. After a crossover or a mutation, only the ancestors of the modified node are
+ *  thus recomputed.
  */
 unsigned int GP::Tree::getTreeDepth(unsigned int inNodeIndex) const
 {
@@ -241,6 +272,7 @@ unsigned int GP::Tree::getTreeDepth(unsigned int inNodeIndex) const
 	if(size()==0) return 0;
 
 	Beagle_UpperBoundCheckAssertM(inNodeIndex,size()-1);
+	if((*this)[inNodeIndex].mSubTreeDepth != 0) return (*this)[inNodeIndex].mSubTreeDepth;
 	unsigned int lDepth = 1;
 	unsigned int lChildNodeIndex = inNodeIndex + 1;
 	for(unsigned int i=0; i<(*this)[inNodeIndex].mPrimitive->getNumberArguments(); i++) {
@@ -248,6 +280,7 @@ unsigned int GP::Tree::getTreeDepth(unsigned int inNodeIndex) const
 		lDepth = maxOf<unsigned int>(lDepth, lChildDepth+1);
 		lChildNodeIndex += (*this)[lChildNodeIndex].mSubTreeSize;
 	}
+	(*this)[inNodeIndex].mSubTreeDepth = lDepth;
 	return lDepth;
 	Beagle_StackTraceEndM("unsigned int GP::Tree::getTreeDepth(unsigned int) const");
 }
@@ -277,10 +310,48 @@ void GP::Tree::swap(unsigned int inI, unsigned int inJ)
 	Beagle_BoundCheckAssertM(inI, 0, size() -1);
 	Beagle_BoundCheckAssertM(inJ, 0, size() -1);
 	std::swap((*this)[inI], (*this)[inJ]);
+	invalidateSubTreeDepths();
 	Beagle_StackTraceEndM("const std::string& GP::Tree::swap(unsigned int, unsigned int) const")
 }
 
 
+/*!
+ *  \brief Get the indices of the branches and of the leaves of the tree.
+ *  \param outBranches Indices of the nodes taking arguments, in increasing order.
+ *  \param outLeaves Indices of the nodes taking no argument, in increasing order.
+ *
+ *  Operators choosing several nodes of a given kind in the same tree should index them
+ *  once and draw directly in the index, instead of drawing nodes until one of the right
+ *  kind is found.
+ */
+void GP::Tree::indexNodesByArity(std::vector<unsigned int>& outBranches,
+                                 std::vector<unsigned int>& outLeaves) const
+{
+	Beagle_StackTraceBeginM();
+	outBranches.clear();
+	outLeaves.clear();
+	for(unsigned int i=0; i<size(); ++i) {
+		if((*this)[i].mSubTreeSize > 1) outBranches.push_back(i);
+		else outLeaves.push_back(i);
+	}
+	Beagle_StackTraceEndM("void GP::Tree::indexNodesByArity(std::vector<unsigned int>&,std::vector<unsigned int>&) const");
+}
+
+
+/*!
+ *  \brief Reset the cached depth of every node of the tree.
+ *
+ *  Must be called when the structure of the tree is changed in a way that does not allow
+ *  resetting only the depth of the ancestors of the modified nodes.
+ */
+void GP::Tree::invalidateSubTreeDepths()
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<size(); ++i) (*this)[i].mSubTreeDepth = 0;
+	Beagle_StackTraceEndM("void GP::Tree::invalidateSubTreeDepths()");
+}
+
+
 /*!
  *  \brief Interpret the GP tree.
  *  \param outResult Datum containing the result of the interpretation.
@@ -333,8 +404,9 @@ void GP::Tree::interpret(GP::Datum& outResult, GP::Context& ioContext)
 	    "Beagle::GP::Tree",
 	    std::string("Executing the tree root node '")+(*this)[0].mPrimitive->getName()+"'"
 	);
+	ioContext.resetArgumentsFrames();
 	ioContext.setNodesExecutionCount(0);
-	ioContext.incrementNodesExecuted();
+	ioContext.countTreeExecution(*this);
 	ioContext.getExecutionTimer().reset();
 	ioContext.pushCallStack(0);
 	(*this)[0].mPrimitive->execute(outResult, ioContext);
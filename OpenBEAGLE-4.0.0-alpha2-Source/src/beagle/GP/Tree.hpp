@@ -65,13 +65,21 @@ class Context;  // Forward declaration.
  *  \brief GP tree node structure.
  *  \ingroup GPF
  *  \ingroup GPPop
+ *
+ *  The sub-tree depth is a cache filled by GP::Tree::getTreeDepth, a value of zero meaning
+ *  that it is unknown. As it depends only on the nodes of the sub-tree, it stays valid when
+ *  the sub-tree is moved. Code changing the structure of a sub-tree must reset the depth of
+ *  the sub-tree's ancestors, as it is done with their sub-tree sizes.
  */
 struct Node
 {
-	Primitive::Handle mPrimitive;    //!< Smart pointer to the associated primitive.
-	unsigned int      mSubTreeSize;  //!< Sub-tree size, including actual node.
+	Primitive::Handle     mPrimitive;     //!< Smart pointer to the associated primitive.
+	unsigned int          mSubTreeSize;   //!< Sub-tree size, including actual node.
+	mutable unsigned int  mSubTreeDepth;  //!< Sub-tree depth, zero when unknown.
 
-	explicit Node(Primitive::Handle inPrimitive=NULL, unsigned int inSubTreeSize=0);
+	explicit Node(Primitive::Handle inPrimitive=NULL,
+	              unsigned int inSubTreeSize=0,
+	              unsigned int inSubTreeDepth=0);
 	bool operator==(const Node& inRightNode) const;
 };
 
@@ -99,7 +107,9 @@ public:
 	              unsigned int inNumberArguments=0);
 
 	virtual void         copy(const Member& inOriginal, System& ioSystem);
+	virtual unsigned int computeHash() const;
 	virtual unsigned int fixSubTreeSize(unsigned int inNodeIndex=0);
+	void                 invalidateSubTreeDepths();
 	GP::PrimitiveSet&    getPrimitiveSet(GP::Context& ioContext) const;
 
 #ifdef BEAGLE_HAVE_RTTI
@@ -110,6 +120,8 @@ public:
 	virtual const std::string&  getType() const;
 	virtual void				swap(unsigned int inI, unsigned int inJ);
 	unsigned int                getTreeDepth(unsigned int inNodeIndex=0) const;
+	void                        indexNodesByArity(std::vector<unsigned int>& outBranches,
+	                                              std::vector<unsigned int>& outLeaves) const;
 	void                        interpret(GP::Datum& outResult, GP::Context& ioContext);
 	virtual bool                isEqual(const Object& inRightObj) const;
 	virtual std::string         deparse() const;
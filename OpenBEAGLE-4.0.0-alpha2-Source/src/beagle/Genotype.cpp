@@ -38,6 +38,22 @@
 using namespace Beagle;
 
 
+/*!
+ *  \brief Compute the hash value of the genotype.
+ *  \return Hash value of the genotype.
+ *
+ *  The default implementation hashes the XML serialization of the genotype, which is
+ *  slow but consistent with equality for any genotype. Derived genotypes should
+ *  overload this method with a direct computation over their content.
+ */
+unsigned int Genotype::computeHash() const
+{
+	Beagle_StackTraceBeginM();
+	return HashString()(serialize());
+	Beagle_StackTraceEndM("unsigned int Genotype::computeHash() const");
+}
+
+
 /*!
  *  \brief Get the name of the member concept.
  *  \return Member concept name, "Genotype".
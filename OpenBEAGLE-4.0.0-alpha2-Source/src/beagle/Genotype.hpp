@@ -36,6 +36,8 @@
 #ifndef Beagle_Genotype_hpp
 #define Beagle_Genotype_hpp
 
+#include <cstring>
+
 #include "PACC/XML.hpp"
 
 #include "beagle/config.hpp"
@@ -80,6 +82,7 @@ public:
 	virtual ~Genotype()
 	{ }
 
+	virtual unsigned int        computeHash() const;
 	virtual const std::string&  getName() const;
 	virtual unsigned int        getSize() const;
 	virtual void				swap(unsigned int inI, unsigned int inJ);
@@ -87,6 +90,35 @@ public:
 	virtual void                write(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 	virtual void                writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Combine a value into a hash seed.
+	 *  \param inSeed Hash seed to update.
+	 *  \param inValue Value to combine into the seed.
+	 *  \return Combined hash value.
+	 */
+	static inline unsigned int combineHash(unsigned int inSeed, unsigned int inValue)
+	{
+		return inSeed ^ (inValue + 0x9e3779b9U + (inSeed << 6) + (inSeed >> 2));
+	}
+
+	/*!
+	 *  \brief Combine a floating-point value into a hash seed.
+	 *  \param inSeed Hash seed to update.
+	 *  \param inValue Value to combine into the seed.
+	 *  \return Combined hash value.
+	 */
+	static inline unsigned int combineHash(unsigned int inSeed, double inValue)
+	{
+		// Positive and negative zeros compare equal, they must hash equal.
+		if(inValue == 0.0) return combineHash(inSeed, 0U);
+		unsigned int lWords[sizeof(double)/sizeof(unsigned int)];
+		std::memcpy(lWords, &inValue, sizeof(double));
+		for(unsigned int i=0; i<(sizeof(double)/sizeof(unsigned int)); ++i) {
+			inSeed = combineHash(inSeed, lWords[i]);
+		}
+		return inSeed;
+	}
+
 };
 
 }
@@ -64,36 +64,47 @@ void HPC::EvaluationOp::operate(Deme& ioDeme, Context& ioContext)
 	Individual::Handle lOldIndividualHandle = ioContext.getIndividualHandle();
 	unsigned int lOldIndividualIndex = ioContext.getIndividualIndex();
 
-	// Used to flag whether this operator has done anything
-	bool lNoEvaluations = true;
-
+	// Gather the invalid individuals.
+	Individual::Bag lInvalids;
+	std::vector<unsigned int> lInvalidIndices;
 	for(unsigned int i=0; i<ioDeme.size(); i++) {
 		if((ioDeme[i]->getFitness() == NULL) ||
 		        (ioDeme[i]->getFitness()->isValid() == false)) {
+			lInvalids.push_back(ioDeme[i]);
+			lInvalidIndices.push_back(i);
+		}
+	}
 
+	// Used to flag whether this operator has done anything
+	bool lNoEvaluations = lInvalids.empty();
+
+	// Evaluate the individuals in one batch, or one by one if the operator can't.
+	if((lInvalids.empty() == false) && (evaluateBatch(lInvalids, ioContext) == false)) {
+		for(unsigned int i=0; i<lInvalids.size(); i++) {
 			Beagle_LogVerboseM(
 			    ioContext.getSystem().getLogger(),
 			    "evaluation", "Beagle::EvaluationOp",
-			    std::string("Evaluating the fitness of the ")+uint2ordinal(i+1)+
+			    std::string("Evaluating the fitness of the ")+uint2ordinal(lInvalidIndices[i]+1)+
 			    " individual"
 			);
 
-			ioContext.setIndividualIndex(i);
-			ioContext.setIndividualHandle(ioDeme[i]);
-
-			ioDeme[i]->setFitness(evaluate(*ioDeme[i], ioContext));
-			ioDeme[i]->getFitness()->setValid();
+			ioContext.setIndividualIndex(lInvalidIndices[i]);
+			ioContext.setIndividualHandle(lInvalids[i]);
+			lInvalids[i]->setFitness(evaluate(*lInvalids[i], ioContext));
+		}
+	}
 
-			lNoEvaluations = false;
+	for(unsigned int i=0; i<lInvalids.size(); i++) {
+		lInvalids[i]->getFitness()->setValid();
+		lInvalids[i]->removeMember("FitnessDelta");
 
-			Beagle_LogObjectM(
-			    ioContext.getSystem().getLogger(),
-			    Logger::eVerbose,
-			    "evaluation",
-			    "Beagle::EvaluationOp",
-			    *ioDeme[i]->getFitness()
-			);
-		}
+		Beagle_LogObjectM(
+		    ioContext.getSystem().getLogger(),
+		    Logger::eVerbose,
+		    "evaluation",
+		    "Beagle::EvaluationOp",
+		    *lInvalids[i]->getFitness()
+		);
 	}
 
 	ioContext.setIndividualIndex(lOldIndividualIndex);
@@ -36,6 +36,7 @@
 #include "beagle/Beagle.hpp"
 
 #include <algorithm>
+#include <set>
 
 using namespace Beagle;
 
@@ -145,6 +146,22 @@ void HallOfFame::copy(const Member& inOriginal, System& ioSystem)
 }
 
 
+/*!
+ *  \brief Test whether an individual is identical to a member of the hall-of-fame.
+ *  \param inIndividual Individual to look for.
+ *  \return True if an identical individual is in the hall-of-fame, false if not.
+ */
+bool HallOfFame::findIdentical(const Individual& inIndividual) const
+{
+	Beagle_StackTraceBeginM();
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		if(inIndividual.isIdentical(*mEntries[i].mIndividual)) return true;
+	}
+	return false;
+	Beagle_StackTraceEndM("bool HallOfFame::findIdentical(const Individual&) const");
+}
+
+
 /*!
  *  \brief Get name of object.
  *  \return Object name, "HallOfFame".
@@ -305,9 +322,17 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 	// Make the hall-of-fame a heap with the worse individuals on the top.
 	std::make_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
 
+	// Index the hash values of the members, computed once for this update, so that
+	// most candidates are found unique without any genotype comparison.
+	std::multiset<unsigned int> lHashIndex;
+	for(unsigned int i=0; i<mEntries.size(); ++i) {
+		lHashIndex.insert(mEntries[i].mIndividual->getHash());
+	}
+
 	// If the heap is too big, resizing it.
 	while(mEntries.size() > inSizeHOF) {
 		std::pop_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
+		lHashIndex.erase(lHashIndex.find(mEntries.back().mIndividual->getHash()));
 		Beagle_LogDebugM(
 		    ioContext.getSystem().getLogger(),
 		    "hall-of-fame",
@@ -337,13 +362,9 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 
 		// Test if individual on the top of the heap is identical to one
 		// individual in the heap.
-		bool lIsIdentical = false;
-		for(unsigned int i=0; i<mEntries.size(); i++) {
-			if(lTempPop[0]->isIdentical(*mEntries[i].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		const unsigned int lHash = lTempPop[0]->getHash();
+		const bool lIsIdentical =
+			(lHashIndex.find(lHash) != lHashIndex.end()) && findIdentical(*lTempPop[0]);
 
 		// If the individual on the top of the heap is not identical, add it to the
 		// new HOF.
@@ -363,6 +384,7 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 			HallOfFame::Entry lEntry(lIndivCopy, ioContext.getGeneration(), ioContext.getDemeIndex());
 			mEntries.push_back(lEntry);
 			std::push_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
+			lHashIndex.insert(lHash);
 			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
 			    "hall-of-fame",
@@ -392,19 +414,16 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 
 		// Test if individual on the top of the heap is identical to one
 		// individual in the heap.
-		bool lIsIdentical = false;
-		for(unsigned int i=0; i<mEntries.size(); i++) {
-			if(lTempPop[0]->isIdentical(*mEntries[i].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		const unsigned int lHash = lTempPop[0]->getHash();
+		const bool lIsIdentical =
+			(lHashIndex.find(lHash) != lHashIndex.end()) && findIdentical(*lTempPop[0]);
 
 		// If the individual on the top of the heap is not identical, add it to the
 		// new HOF.
 		if(lIsIdentical == false) {
 			// STL heap pop of the worse individual of the HOF
 			std::pop_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
+			lHashIndex.erase(lHashIndex.find(mEntries.back().mIndividual->getHash()));
 
 			Beagle_LogDebugM(
 			    ioContext.getSystem().getLogger(),
@@ -448,6 +467,7 @@ bool HallOfFame::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme, Cont
 
 			// STL push heap of the newly added individual.
 			std::push_heap(mEntries.begin(), mEntries.end(), std::greater<HallOfFame::Entry>());
+			lHashIndex.insert(lHash);
 
 			// A new individual is added to the HOF.
 			++lAddedIndividuals;
@@ -504,13 +524,7 @@ bool HallOfFame::updateWithIndividual(unsigned int inSizeHOF,
 
 	bool lHOFModified = false;
 	if(mEntries.empty() || mEntries[0].mIndividual->isLess(inIndividual)) {
-		bool lIsIdentical = false;
-		for(unsigned int i=0; i<mEntries.size(); ++i) {
-			if(inIndividual.isIdentical(*mEntries[i].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		const bool lIsIdentical = findIdentical(inIndividual);
 		if(lIsIdentical == false) {
 			Beagle_LogVerboseM(
 			    ioContext.getSystem().getLogger(),
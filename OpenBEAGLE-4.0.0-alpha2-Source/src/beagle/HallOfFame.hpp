@@ -155,6 +155,8 @@ public:
 
 protected:
 
+	bool findIdentical(const Individual& inIndividual) const;
+
 	std::vector< HallOfFame::Entry > mEntries;   //!< Vector of members of the hall-of-fame.
 
 };
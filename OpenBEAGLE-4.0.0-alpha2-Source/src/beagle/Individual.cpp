@@ -143,6 +143,26 @@ double Individual::getDistancePhenotype(const Individual&) const
 }
 
 
+/*!
+ *  \brief Get hash value of the individual's genotypes.
+ *  \return Hash value combining the hash values computed from the genotypes.
+ *  \par Note:
+ *    Two individuals for which isIdentical() returns true have the same hash value,
+ *    allowing cheap rejection of non-identical individuals before the deep comparison.
+ */
+unsigned int Individual::getHash() const
+{
+	Beagle_StackTraceBeginM();
+	unsigned int lHash = Genotype::combineHash(0U, (unsigned int)size());
+	for(unsigned int i=0; i<size(); ++i) {
+		Beagle_NonNullPointerAssertM((*this)[i]);
+		lHash = Genotype::combineHash(lHash, (*this)[i]->computeHash());
+	}
+	return lHash;
+	Beagle_StackTraceEndM("unsigned int Individual::getHash() const");
+}
+
+
 /*!
  *  \brief Get name of object.
  *  \return Object name, "Individual".
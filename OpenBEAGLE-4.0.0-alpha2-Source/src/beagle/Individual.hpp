@@ -84,6 +84,7 @@ public:
 	virtual void                copy(const Individual& inOriginal, System& ioSystem);
 	virtual double              getDistanceGenotype(const Individual& inRightIndividual) const;
 	virtual double              getDistancePhenotype(const Individual& inRightIndividual) const;
+	virtual unsigned int        getHash() const;
 	virtual const std::string&  getName() const;
 	virtual unsigned int        getSize() const;
 	virtual const std::string&  getType() const;
@@ -35,6 +35,10 @@
 
 #include "beagle/Beagle.hpp"
 
+#ifdef BEAGLE_HAVE_OPENMP
+#include <omp.h>
+#endif //BEAGLE_HAVE_OPENMP
+
 #ifdef BEAGLE_HAVE_LIBZ
 #include "gzstream.h"
 #endif // BEAGLE_HAVE_LIBZ
@@ -216,21 +220,45 @@ void InitializationOp::operate(Deme& ioDeme, Context& ioContext)
 
 	Individual::Handle lOldIndividualHandle = ioContext.getIndividualHandle();
 	unsigned int lOldIndividualIndex = ioContext.getIndividualIndex();
-	for(unsigned int i=lSeededIndividuals; i<ioDeme.size(); ++i) {
+	const int lSize = ioDeme.size();
+
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+	static OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioContext.getSystem().getComponent("OpenMP"));
+	const std::string& lContextName = lFactory.getConceptTypeName("Context");
+	Context::Alloc::Handle lContextAlloc = castHandleT<Context::Alloc>(lFactory.getAllocator(lContextName));
+	Context::Bag lContexts(lOpenMP->getMaxNumThreads());
+	for(unsigned int i = 0; i <  lOpenMP->getMaxNumThreads(); ++i)
+		lContexts[i] = castHandleT<Context>(lContextAlloc->clone(ioContext));
+#ifdef BEAGLE_USE_OMP_NR
+	#pragma omp parallel for schedule(dynamic)
+#elif defined(BEAGLE_USE_OMP_R)
+	const int lChunkSize = std::max((int)(lSize / lOpenMP->getMaxNumThreads()), 1);
+	#pragma omp parallel for schedule(static, lChunkSize)
+#endif
+#endif
+	for(int i=lSeededIndividuals; i<lSize; ++i) {
 		Beagle_LogVerboseM(
 		    ioContext.getSystem().getLogger(),
 		    "initialization", "Beagle::InitializationOp",
 		    std::string("Initializing the ")+uint2ordinal(i+1)+" individual"
 		);
-		ioContext.setIndividualHandle(ioDeme[i]);
-		ioContext.setIndividualIndex(i);
-		initIndividual(*ioDeme[i], ioContext);
+#if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
+		Context& lContext = *lContexts[lOpenMP->getThreadNum()];
+#else
+		Context& lContext = ioContext;
+#endif
+		lContext.setIndividualHandle(ioDeme[i]);
+		lContext.setIndividualIndex(i);
+		initIndividual(*ioDeme[i], lContext);
 		if(ioDeme[i]->getFitness() != NULL) {
 			ioDeme[i]->getFitness()->setInvalid();
 		}
 		if(lHistory != NULL) {
-			lHistory->incrementHistoryVar(*ioDeme[i]);
-			lHistory->trace(ioContext, std::vector<HistoryID>(), ioDeme[i], getName(), "initialization");
+			#pragma omp critical (Beagle_History)
+			{
+				lHistory->incrementHistoryVar(*ioDeme[i]);
+				lHistory->trace(lContext, std::vector<HistoryID>(), ioDeme[i], getName(), "initialization");
+			}
 		}
 	}
 	ioContext.setIndividualIndex(lOldIndividualIndex);
@@ -77,6 +77,7 @@ Individual::Handle MutationOp::breed(Individual::Bag& inBreedingPool,
 	);
 
 	if(lIndiv != NULL) {
+		lIndiv->removeMember("FitnessDelta");
 		bool lMutated = mutate(*lIndiv, ioContext);
 		if(lMutated) {
 			if(lIndiv->getFitness() != NULL) lIndiv->getFitness()->setInvalid();
@@ -191,6 +192,7 @@ void MutationOp::operate(Deme& ioDeme, Context& ioContext)
 			    std::string("Mutating the ")+uint2ordinal(i+1)+" individual"
 			);
 
+			ioDeme[i]->removeMember("FitnessDelta");
 #if defined(BEAGLE_USE_OMP_NR) || defined(BEAGLE_USE_OMP_R)
 			if(mutate(*ioDeme[i], *lContexts[lOpenMP->getThreadNum()])) {
 #else
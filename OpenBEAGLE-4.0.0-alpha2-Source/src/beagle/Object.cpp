@@ -41,51 +41,26 @@ using namespace Beagle;
 
 
 
-/*!
- *  \brief Default constructor.
- */
-Object::Object() :
-		mRefCounter(0)
-{ }
-
-
-/*!
- *  \brief Copy constructor.
- */
-Object::Object(const Object&) :
-		mRefCounter(0)
-{ }
-
-
+#ifndef BEAGLE_NDEBUG
 /*!
  *  \brief Destructor.
  *  \throw Beagle::InternalException If reference counter is not equal to zero.
+ *  \par Note:
+ *    The destructor is inlined and does nothing when BEAGLE_NDEBUG is defined, so that
+ *    the temporary values of the GP primitives cost no function call.
  */
 Object::~Object()
 {
 	Beagle_StackTraceBeginM();
-#ifndef BEAGLE_NDEBUG
 	if(mRefCounter != 0) {
 		std::string lMessage = "Reference counter of actual object is non-zero (value: ";
 		lMessage += int2str(mRefCounter);
 		lMessage += ")";
 		throw Beagle_InternalExceptionM(lMessage);
 	}
-#endif // BEAGLE_NDEBUG
 	Beagle_StackTraceEndM("Object::~Object()");
 }
-
-
-/*!
- *  \brief Copy operator of Object.
- *  \return Actual object.
- */
-Object& Object::operator=(const Object&)
-{
-	Beagle_StackTraceBeginM();
-	return *this;
-	Beagle_StackTraceEndM("Object& Object::operator=(const Object&)");
-}
+#endif // BEAGLE_NDEBUG
 
 
 /*!
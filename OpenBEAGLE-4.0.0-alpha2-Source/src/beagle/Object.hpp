@@ -164,11 +164,35 @@ public:
 	//! Object bag type.
 	typedef Container Bag;
 
-	Object();
-	Object(const Object& inOriginal);
+	/*!
+	 *  \brief Default constructor.
+	 */
+	Object() :
+			mRefCounter(0)
+	{ }
+
+	/*!
+	 *  \brief Copy constructor, the reference counter is not copied.
+	 */
+	Object(const Object&) :
+			mRefCounter(0)
+	{ }
+
+#ifdef BEAGLE_NDEBUG
+	virtual ~Object()
+	{ }
+#else // BEAGLE_NDEBUG
 	virtual ~Object();
+#endif // BEAGLE_NDEBUG
 
-	Object& operator=(const Object& inOriginal);
+	/*!
+	 *  \brief Copy operator of Object, the reference counter is not copied.
+	 *  \return Actual object.
+	 */
+	inline Object& operator=(const Object&)
+	{
+		return *this;
+	}
 
 	virtual const std::string& getName() const;
 	virtual bool               isEqual(const Object& inRightObj) const;
@@ -66,12 +66,15 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::Context", new Context::Alloc);
 	lFactory.insertAllocator("Beagle::DataSetClassification", new DataSetClassification::Alloc);
 	lFactory.insertAllocator("Beagle::DataSetRegression", new DataSetRegression::Alloc);
+	lFactory.insertAllocator("Beagle::DataSetSampler", new DataSetSampler::Alloc);
 	lFactory.insertAllocator("Beagle::DecimateOp", new DecimateOp::Alloc);
 	lFactory.insertAllocator("Beagle::Deme", new Deme::Alloc);
 	lFactory.insertAllocator("Beagle::Double", new Double::Alloc);
 	lFactory.insertAllocator("Beagle::DoubleArray", new DoubleArray::Alloc);
 	lFactory.insertAllocator("Beagle::Evolver", new Evolver::Alloc);
 	lFactory.insertAllocator("Beagle::Factory", new Factory::Alloc);
+	lFactory.insertAllocator("Beagle::FitnessCache", new FitnessCache::Alloc);
+	lFactory.insertAllocator("Beagle::FitnessCaseErrors", new FitnessCaseErrors::Alloc);
 	lFactory.insertAllocator("Beagle::FitnessSimple", new FitnessSimple::Alloc);
 	lFactory.insertAllocator("Beagle::FitnessSimpleMin", new FitnessSimpleMin::Alloc);
 	lFactory.insertAllocator("Beagle::Float", new Float::Alloc);
@@ -111,6 +114,7 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::RegisterReadOp", new RegisterReadOp::Alloc);
 	lFactory.insertAllocator("Beagle::SelectBestOp", new SelectBestOp::Alloc);
 	lFactory.insertAllocator("Beagle::SelectFirstOp", new SelectFirstOp::Alloc);
+	lFactory.insertAllocator("Beagle::SelectLexicaseOp", new SelectLexicaseOp::Alloc);
 	lFactory.insertAllocator("Beagle::SelectParsimonyTournOp", new SelectParsimonyTournOp::Alloc);
 	lFactory.insertAllocator("Beagle::SelectRandomOp", new SelectRandomOp::Alloc);
 	lFactory.insertAllocator("Beagle::SelectRouletteOp", new SelectRouletteOp::Alloc);
@@ -121,6 +125,7 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.insertAllocator("Beagle::ShortArray", new ShortArray::Alloc);
 	lFactory.insertAllocator("Beagle::StatsCalcFitnessSimpleOp", new StatsCalcFitnessSimpleOp::Alloc);
 	lFactory.insertAllocator("Beagle::Stats", new Stats::Alloc);
+	lFactory.insertAllocator("Beagle::StatsWriterOp", new StatsWriterOp::Alloc);
 	lFactory.insertAllocator("Beagle::SteadyStateOp", new SteadyStateOp::Alloc);
 	lFactory.insertAllocator("Beagle::String", new String::Alloc);
 	lFactory.insertAllocator("Beagle::System", new System::Alloc);
@@ -150,12 +155,15 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::Context", "Context");
 	lFactory.aliasAllocator("Beagle::DataSetClassification", "DataSetClassification");
 	lFactory.aliasAllocator("Beagle::DataSetRegression", "DataSetRegression");
+	lFactory.aliasAllocator("Beagle::DataSetSampler", "DataSetSampler");
 	lFactory.aliasAllocator("Beagle::DecimateOp", "DecimateOp");
 	lFactory.aliasAllocator("Beagle::Deme", "Deme");
 	lFactory.aliasAllocator("Beagle::Double", "Double");
 	lFactory.aliasAllocator("Beagle::DoubleArray", "DoubleArray");
 	lFactory.aliasAllocator("Beagle::Evolver", "Evolver");
 	lFactory.aliasAllocator("Beagle::Factory", "Factory");
+	lFactory.aliasAllocator("Beagle::FitnessCache", "FitnessCache");
+	lFactory.aliasAllocator("Beagle::FitnessCaseErrors", "FitnessCaseErrors");
 	lFactory.aliasAllocator("Beagle::FitnessSimple", "FitnessSimple");
 	lFactory.aliasAllocator("Beagle::FitnessSimpleMin", "FitnessSimpleMin");
 	lFactory.aliasAllocator("Beagle::Float", "Float");
@@ -195,6 +203,7 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::RegisterReadOp", "RegisterReadOp");
 	lFactory.aliasAllocator("Beagle::SelectBestOp", "SelectBestOp");
 	lFactory.aliasAllocator("Beagle::SelectFirstOp", "SelectFirstOp");
+	lFactory.aliasAllocator("Beagle::SelectLexicaseOp", "SelectLexicaseOp");
 	lFactory.aliasAllocator("Beagle::SelectParsimonyTournOp", "SelectParsimonyTournOp");
 	lFactory.aliasAllocator("Beagle::SelectRandomOp", "SelectRandomOp");
 	lFactory.aliasAllocator("Beagle::SelectRouletteOp", "SelectRouletteOp");
@@ -205,6 +214,7 @@ void PackageBase::configure(System& ioSystem)
 	lFactory.aliasAllocator("Beagle::ShortArray", "ShortArray");
 	lFactory.aliasAllocator("Beagle::StatsCalcFitnessSimpleOp", "StatsCalcFitnessSimpleOp");
 	lFactory.aliasAllocator("Beagle::Stats", "Stats");
+	lFactory.aliasAllocator("Beagle::StatsWriterOp", "StatsWriterOp");
 	lFactory.aliasAllocator("Beagle::SteadyStateOp", "SteadyStateOp");
 	lFactory.aliasAllocator("Beagle::String", "String");
 	lFactory.aliasAllocator("Beagle::System", "System");
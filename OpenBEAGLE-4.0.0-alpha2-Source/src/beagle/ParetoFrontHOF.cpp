@@ -113,13 +113,7 @@ bool ParetoFrontHOF::updateWithDeme(unsigned int inSizeHOF, const Deme& inDeme,
 
 		if(lIsDominated==false) {
 			// Test if the individual is unique, and if so add it to the Pareto front.
-			bool lIsIdentical = false;
-			for(unsigned int k=0; k<mEntries.size(); ++k) {
-				if(inDeme[i]->isIdentical(*mEntries[k].mIndividual)) {
-					lIsIdentical = true;
-					break;
-				}
-			}
+			const bool lIsIdentical = findIdentical(*inDeme[i]);
 			if(lIsIdentical == false) {
 				const Factory& lFactory = ioContext.getSystem().getFactory();
 				const std::string& lIndividualType = inDeme[i]->getType();
@@ -224,13 +218,7 @@ bool ParetoFrontHOF::updateWithIndividual(unsigned int inSizeHOF,
 	}
 	if(lIsDominated==false) {
 		// Test if the individual is unique, and if so add it to the Pareto front.
-		bool lIsIdentical = false;
-		for(unsigned int j=0; j<mEntries.size(); ++j) {
-			if(inIndividual.isIdentical(*mEntries[j].mIndividual)) {
-				lIsIdentical = true;
-				break;
-			}
-		}
+		const bool lIsIdentical = findIdentical(inIndividual);
 		if(lIsIdentical == false) {
 			const Factory& lFactory = ioContext.getSystem().getFactory();
 			std::string lIndividualType = inIndividual.getType();
@@ -36,6 +36,8 @@
 #ifndef Beagle_Randomizer_hpp
 #define Beagle_Randomizer_hpp
 
+#include <cmath>
+
 #include "PACC/Util.hpp"
 
 #include "beagle/config.hpp"
@@ -102,6 +104,32 @@ public:
 		Beagle_StackTraceEndM("double Randomizer::rollGaussian(double inMean, double inStdDev)");
 	}
 
+	/*!
+	 *  \brief Generate the number of failures before the first success of Bernoulli trials.
+	 *  \param inProba Probability of success of each trial.
+	 *  \param inMax Maximum number returned.
+	 *  \return Random number following a geometric distribution, bounded to inMax.
+	 *
+	 *  Operators changing each element of a sequence with a small probability can skip
+	 *  directly to the next element changed, drawing one number per element changed
+	 *  instead of one per element:
+	 *  \code
+	 *  for(unsigned int i=lRandomizer.rollGeometric(lProba, lSize); i<lSize;
+	 *      i+=lRandomizer.rollGeometric(lProba, lSize)+1) { ... }
+	 *  \endcode
+	 */
+	inline unsigned long rollGeometric(double inProba, unsigned long inMax=ULONG_MAX)
+	{
+		Beagle_StackTraceBeginM();
+		if(inProba >= 1.0) return 0;
+		if(inProba <= 0.0) return inMax;
+		const double lFailures =
+		    std::floor(std::log(1.0 - randExc()) / std::log(1.0 - inProba));
+		if(lFailures >= double(inMax)) return inMax;
+		return (unsigned long)lFailures;
+		Beagle_StackTraceEndM("unsigned long Randomizer::rollGeometric(double inProba, unsigned long inMax)");
+	}
+
 	/*!
 	 *  \brief Generate an positive integer following an uniform discrete distribution.
 	 *  \param inLower Lower bound of the distribution.
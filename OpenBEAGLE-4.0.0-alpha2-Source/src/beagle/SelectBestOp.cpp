@@ -34,6 +34,8 @@
 
 #include "beagle/Beagle.hpp"
 
+#include <algorithm>
+
 using namespace Beagle;
 
 namespace
@@ -42,25 +44,54 @@ namespace
 class TempPoolPredicate
 {
 public:
-	TempPoolPredicate()
+	explicit TempPoolPredicate(const Individual::Bag& inPool) :
+		mPool(inPool)
 	{ }
 	~TempPoolPredicate()
 	{ }
 
 	/*!
-	 *  \brief Test the ordering of two pointed Objects.
-	 *  \param inLeftPtr Pointer to the left object to compare.
-	 *  \param inRightPtr Pointer to the right object to compare.
+	 *  \brief Test whether an individual of the pool is better than another.
+	 *  \param inLeft Index of the left individual to compare.
+	 *  \param inRight Index of the right individual to compare.
 	 */
-	inline bool operator()(const std::pair<unsigned int, Pointer>& inLeft,
-	                       const std::pair<unsigned int, Pointer>& inRight) const
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
 	{
 		Beagle_StackTraceBeginM();
-		if( (!inLeft.second) || (!inRight.second) ) return false;
-		return inLeft.second->isLess(*inRight.second);
-		Beagle_StackTraceEndM("bool TempPoolPredicate::operator()(const std::pair<unsigned int, Pointer&>,const std::pair<unsigned int, Pointer&>) const");
+		if( (!mPool[inLeft]) || (!mPool[inRight]) ) return false;
+		return mPool[inRight]->isLess(*mPool[inLeft]);
+		Beagle_StackTraceEndM("bool TempPoolPredicate::operator()(unsigned int,unsigned int) const");
+	}
+
+private:
+	const Individual::Bag& mPool;
+
+};
+
+class TempKeysPredicate
+{
+public:
+	TempKeysPredicate(const std::vector<double>& inKeys, unsigned int inKeySize) :
+		mKeys(&inKeys[0]),
+		mKeySize(inKeySize)
+	{ }
+	~TempKeysPredicate()
+	{ }
+
+	/*!
+	 *  \brief Test whether the fitness sort key of an individual is better than another.
+	 *  \param inLeft Index of the left individual to compare.
+	 *  \param inRight Index of the right individual to compare.
+	 */
+	inline bool operator()(unsigned int inLeft, unsigned int inRight) const
+	{
+		return SelectionOp::isKeyLess(mKeys+(inRight*mKeySize), mKeys+(inLeft*mKeySize), mKeySize);
 	}
 
+private:
+	const double* mKeys;
+	unsigned int  mKeySize;
+
 };
 
 }
@@ -125,23 +156,15 @@ void SelectBestOp::selectNIndividuals(unsigned int inN,
 		);
 	}
 
-	// Copy the pool, pairing indices and handles to individuals
-	Beagle_LogDebugM(
-	    ioContext.getSystem().getLogger(),
-	    "selection", "Beagle::SelectBestOp",
-	    "Copying pool's individuals and pairing them to their indices"
-	);
-	typedef std::vector< std::pair< unsigned int, Individual::Handle > > lTempPoolType;
-	lTempPoolType lTempPool;
-	lTempPool.resize(ioPool.size());
-	unsigned int lIndex = 0;
-	for(lTempPoolType::iterator lItr=lTempPool.begin(); lItr!=lTempPool.end(); ++lItr) {
-		lItr->first  = lIndex;
-		lItr->second = ioPool[lIndex++];
-	}
-	Beagle_AssertM(ioPool.size() == lTempPool.size());
+	// Extract the fitness sort keys of the pool, if available
+	std::vector<double> lKeys;
+	unsigned int lKeySize = 0;
+	const bool lUseKeys = extractFitnessKeys(ioPool, lKeys, lKeySize);
+	std::vector<unsigned int> lTempPool(ioPool.size());
+	for(unsigned int i=0; i<lTempPool.size(); ++i) lTempPool[i] = i;
 
-	// Sort population
+	// Sort population indices, from the best to the worst individual
+	std::vector<unsigned int>::iterator lSortEnd = lTempPool.end();
 	if(inN > ioPool.size()) {
 		Beagle_LogBasicM(
 		    ioContext.getSystem().getLogger(),
@@ -149,14 +172,18 @@ void SelectBestOp::selectNIndividuals(unsigned int inN,
 		    std::string("Warning sorting entire copy of pool because number to select (")+uint2str(inN)+
 		    ") is greater than size of pool ("+uint2str(ioPool.size())+")"
 		);
-		std::sort(lTempPool.begin(),lTempPool.end(), TempPoolPredicate());
 	} else {
 		Beagle_LogDebugM(
 		    ioContext.getSystem().getLogger(),
 		    "selection", "Beagle::SelectBestOp",
 		    std::string("Partial sorting top ")+uint2str(inN)+" individuals in copy of pool"
 		);
-		std::partial_sort(lTempPool.begin(), lTempPool.begin()+inN, lTempPool.end(), TempPoolPredicate());
+		lSortEnd = lTempPool.begin()+inN;
+	}
+	if(lUseKeys) {
+		std::partial_sort(lTempPool.begin(), lSortEnd, lTempPool.end(), TempKeysPredicate(lKeys, lKeySize));
+	} else {
+		std::partial_sort(lTempPool.begin(), lSortEnd, lTempPool.end(), TempPoolPredicate(ioPool));
 	}
 
 	// Write to the selection table
@@ -168,7 +195,7 @@ void SelectBestOp::selectNIndividuals(unsigned int inN,
 	outSelections.clear();
 	outSelections.resize(lTempPool.size());
 	for (unsigned int i=0; i<inN; i++) {
-		unsigned int lSelection = lTempPool[i%lTempPool.size()].first;
+		unsigned int lSelection = lTempPool[i%lTempPool.size()];
 		Beagle_LogDebugM(
 		    ioContext.getSystem().getLogger(),
 		    "selection", "Beagle::SelectBestOp",
@@ -0,0 +1,337 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/src/SelectLexicaseOp.cpp
+ *  \brief  Source code of class SelectLexicaseOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a lexicase selection operator.
+ *  \param inReproProbaName Reproduction probability parameter name used in register.
+ *  \param inName Name of the lexicase selection operator.
+ */
+SelectLexicaseOp::SelectLexicaseOp(std::string inReproProbaName, std::string inName) :
+		SelectionOp(inReproProbaName, inName),
+		mEpsilon(NULL),
+		mCacheNbCases(0),
+		mCacheGeneration(0),
+		mCacheDemeIndex(0)
+{ }
+
+
+/*!
+ *  \brief Compute the median absolute deviation of values.
+ *  \param ioValues Values, reordered by the computation.
+ *  \return Median absolute deviation of the values.
+ */
+double SelectLexicaseOp::computeMAD(std::vector<double>& ioValues)
+{
+	Beagle_StackTraceBeginM();
+	if(ioValues.empty()) return 0.0;
+	std::vector<double>::iterator lMiddle = ioValues.begin() + (ioValues.size() / 2);
+	std::nth_element(ioValues.begin(), lMiddle, ioValues.end());
+	const double lMedian = *lMiddle;
+	for(unsigned int i=0; i<ioValues.size(); ++i) ioValues[i] = std::fabs(ioValues[i] - lMedian);
+	std::nth_element(ioValues.begin(), lMiddle, ioValues.end());
+	return *lMiddle;
+	Beagle_StackTraceEndM("double SelectLexicaseOp::computeMAD(std::vector<double>&)");
+}
+
+
+/*!
+ *  \brief Compute the error tolerance of each fitness case.
+ *  \param inErrors Case-major matrix of errors.
+ *  \param inPoolSize Number of individuals in the pool.
+ *  \param inNbCases Number of fitness cases.
+ *  \param outEpsilons Error tolerance of each case.
+ */
+void SelectLexicaseOp::computeEpsilons(const std::vector<double>& inErrors,
+                                       unsigned int inPoolSize,
+                                       unsigned int inNbCases,
+                                       std::vector<double>& outEpsilons) const
+{
+	Beagle_StackTraceBeginM();
+	const double lEpsilon = mEpsilon->getWrappedValue();
+	if(lEpsilon >= 0.0) {
+		outEpsilons.assign(inNbCases, lEpsilon);
+		return;
+	}
+	outEpsilons.resize(inNbCases);
+	std::vector<double> lColumn(inPoolSize);
+	for(unsigned int i=0; i<inNbCases; ++i) {
+		std::copy(inErrors.begin()+(i*inPoolSize), inErrors.begin()+((i+1)*inPoolSize), lColumn.begin());
+		outEpsilons[i] = computeMAD(lColumn);
+	}
+	Beagle_StackTraceEndM("void SelectLexicaseOp::computeEpsilons(const std::vector<double>&,unsigned int,unsigned int,std::vector<double>&) const");
+}
+
+
+/*!
+ *  \brief Extract the errors of a pool of individuals into a case-major matrix.
+ *  \param ioPool Pool of individuals.
+ *  \param outErrors Errors, the errors on the ith case starting at index i*ioPool.size().
+ *  \param outNbCases Number of fitness cases.
+ *  \throw RunTimeException If the individuals have different numbers of fitness cases.
+ *
+ *  Individuals with an invalid fitness get the largest error on every case.
+ */
+void SelectLexicaseOp::extractCaseErrors(Individual::Bag& ioPool,
+                                         std::vector<double>& outErrors,
+                                         unsigned int& outNbCases) const
+{
+	Beagle_StackTraceBeginM();
+	const unsigned int lPoolSize = ioPool.size();
+	std::vector<const FitnessCaseErrors*> lFitnesses(lPoolSize, NULL);
+	bool lFirstValid = true;
+	outNbCases = 0;
+	for(unsigned int i=0; i<lPoolSize; ++i) {
+		if((ioPool[i]->getFitness() == NULL) || ioPool[i]->getFitness()->isValid() == false) continue;
+		lFitnesses[i] = castHandleT<const FitnessCaseErrors>(ioPool[i]->getFitness()).getPointer();
+		if(lFirstValid) {
+			outNbCases = lFitnesses[i]->getNumberOfCases();
+			lFirstValid = false;
+		} else if(lFitnesses[i]->getNumberOfCases() != outNbCases) {
+			std::ostringstream lOSS;
+			lOSS << "Lexicase selection needs the same number of fitness cases for all individuals, ";
+			lOSS << "but the " << uint2ordinal(i+1) << " individual has ";
+			lOSS << lFitnesses[i]->getNumberOfCases() << " cases instead of " << outNbCases << "!";
+			throw Beagle_RunTimeExceptionM(lOSS.str());
+		}
+	}
+
+	outErrors.resize(lPoolSize * outNbCases);
+	for(unsigned int i=0; i<lPoolSize; ++i) {
+		if(lFitnesses[i] == NULL) {
+			for(unsigned int j=0; j<outNbCases; ++j) outErrors[j*lPoolSize + i] = DBL_MAX;
+		} else {
+			const std::vector<double>& lErrors = lFitnesses[i]->getErrors();
+			for(unsigned int j=0; j<outNbCases; ++j) outErrors[j*lPoolSize + i] = lErrors[j];
+		}
+	}
+	Beagle_StackTraceEndM("void SelectLexicaseOp::extractCaseErrors(Individual::Bag&,std::vector<double>&,unsigned int&) const");
+}
+
+
+/*!
+ *  \brief Test whether the cached errors are those of a pool.
+ *  \param ioPool Pool of individuals.
+ *  \param ioContext Context of the evolution.
+ *  \return True if the cache was built in the same generation and deme, from the same
+ *    individuals and fitnesses as the pool.
+ */
+bool SelectLexicaseOp::isCacheValid(Individual::Bag& ioPool, Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	if(mCacheGeneration != ioContext.getGeneration()) return false;
+	if(mCacheDemeIndex != ioContext.getDemeIndex()) return false;
+	if(mCacheIndividuals.size() != ioPool.size()) return false;
+	for(unsigned int i=0; i<ioPool.size(); ++i) {
+		if(mCacheIndividuals[i] != ioPool[i].getPointer()) return false;
+		if(mCacheFitnesses[i] != ioPool[i]->getFitness().getPointer()) return false;
+	}
+	return true;
+	Beagle_StackTraceEndM("bool SelectLexicaseOp::isCacheValid(Individual::Bag&,Context&) const");
+}
+
+
+/*!
+ *  \brief Register the parameters of this operator.
+ *  \param ioSystem System to use to initialize the operator.
+ */
+void SelectLexicaseOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+
+	SelectionOp::registerParams(ioSystem);
+	Register::Description lDescription(
+	    "Lexicase selection epsilon",
+	    "Double",
+	    "0",
+	    std::string("Error tolerance of lexicase selection: candidates whose error on a case is ")+
+	    "within epsilon of the best error survive the case. A negative value sets the tolerance "+
+	    "of each case to the median absolute deviation of the errors on that case."
+	);
+	mEpsilon = castHandleT<Double>(
+	               ioSystem.getRegister().insertEntry("ec.sel.lexepsilon", new Double(0.0), lDescription));
+
+	Beagle_StackTraceEndM("void SelectLexicaseOp::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Select an individual using the lexicase selection method.
+ *  \param ioPool Individual pool to use for selection.
+ *  \param ioContext Context of the evolution.
+ *  \return Index of the choosen individual in the pool.
+ *
+ *  The errors of the pool and the epsilons are only extracted when the pool differs from
+ *  the one of the previous call, that is once per generation and deme in a breeder tree.
+ */
+unsigned int SelectLexicaseOp::selectIndividual(Individual::Bag& ioPool, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(isCacheValid(ioPool, ioContext) == false) {
+		extractCaseErrors(ioPool, mCacheErrors, mCacheNbCases);
+		computeEpsilons(mCacheErrors, ioPool.size(), mCacheNbCases, mCacheEpsilons);
+		mCacheIndividuals.resize(ioPool.size());
+		mCacheFitnesses.resize(ioPool.size());
+		for(unsigned int i=0; i<ioPool.size(); ++i) {
+			mCacheIndividuals[i] = ioPool[i].getPointer();
+			mCacheFitnesses[i] = ioPool[i]->getFitness().getPointer();
+		}
+		mCacheGeneration = ioContext.getGeneration();
+		mCacheDemeIndex = ioContext.getDemeIndex();
+	}
+
+	const unsigned int lChoosenIndividual =
+	    selectLexicase(mCacheErrors, ioPool.size(), mCacheNbCases, mCacheEpsilons,
+	                   ioContext.getSystem().getRandomizer(), mCandidates, mCases);
+
+	Beagle_LogDebugM(
+	    ioContext.getSystem().getLogger(),
+	    "selection",
+	    "Beagle::SelectLexicaseOp",
+	    std::string("Selecting the ")+uint2ordinal(lChoosenIndividual+1)+" individual"
+	);
+	Beagle_LogObjectDebugM(
+	    ioContext.getSystem().getLogger(),
+	    "selection",
+	    "Beagle::SelectLexicaseOp",
+	    *ioPool[lChoosenIndividual]
+	);
+
+	return lChoosenIndividual;
+	Beagle_StackTraceEndM("unsigned int SelectLexicaseOp::selectIndividual(Individual::Bag&,Context&)");
+}
+
+
+/*!
+ *  \brief Run one lexicase selection on a case-major matrix of errors.
+ *  \param inErrors Case-major matrix of errors.
+ *  \param inPoolSize Number of individuals in the pool.
+ *  \param inNbCases Number of fitness cases.
+ *  \param inEpsilons Error tolerance of each case.
+ *  \param ioRandomizer Randomizer used to order the cases and break the ties.
+ *  \param ioCandidates Work buffer for the candidates.
+ *  \param ioCases Work buffer for the order of the cases.
+ *  \return Index of the selected individual.
+ */
+unsigned int SelectLexicaseOp::selectLexicase(const std::vector<double>& inErrors,
+                                              unsigned int inPoolSize,
+                                              unsigned int inNbCases,
+                                              const std::vector<double>& inEpsilons,
+                                              Randomizer& ioRandomizer,
+                                              std::vector<unsigned int>& ioCandidates,
+                                              std::vector<unsigned int>& ioCases) const
+{
+	Beagle_StackTraceBeginM();
+	ioCandidates.resize(inPoolSize);
+	for(unsigned int i=0; i<inPoolSize; ++i) ioCandidates[i] = i;
+	if(ioCases.size() != inNbCases) {
+		ioCases.resize(inNbCases);
+		for(unsigned int i=0; i<inNbCases; ++i) ioCases[i] = i;
+	}
+
+	unsigned int lNbCandidates = inPoolSize;
+	for(unsigned int i=0; (i<inNbCases) && (lNbCandidates>1); ++i) {
+		// Draw the next case without replacement, shuffling the order only as far as needed
+		std::swap(ioCases[i], ioCases[ioRandomizer.rollInteger(i,inNbCases-1)]);
+		const unsigned int lCase = ioCases[i];
+		const double* lCaseErrors = &inErrors[lCase*inPoolSize];
+
+		double lBestError = lCaseErrors[ioCandidates[0]];
+		for(unsigned int j=1; j<lNbCandidates; ++j) {
+			if(lCaseErrors[ioCandidates[j]] < lBestError) lBestError = lCaseErrors[ioCandidates[j]];
+		}
+		const double lThreshold = lBestError + inEpsilons[lCase];
+		unsigned int lNbKept = 0;
+		for(unsigned int j=0; j<lNbCandidates; ++j) {
+			if(lCaseErrors[ioCandidates[j]] <= lThreshold) ioCandidates[lNbKept++] = ioCandidates[j];
+		}
+		lNbCandidates = lNbKept;
+	}
+
+	if(lNbCandidates == 1) return ioCandidates[0];
+	return ioCandidates[ioRandomizer.rollInteger(0,lNbCandidates-1)];
+	Beagle_StackTraceEndM("unsigned int SelectLexicaseOp::selectLexicase(const std::vector<double>&,unsigned int,unsigned int,const std::vector<double>&,Randomizer&,std::vector<unsigned int>&,std::vector<unsigned int>&) const");
+}
+
+
+/*!
+ *  \brief Select inN individuals using lexicase selection.
+ *  \param inN Number of individuals to select.
+ *  \param ioPool Pool from which the individuals are choosen.
+ *  \param ioContext Evolutionary context.
+ *  \param outSelections Vector of unsigned ints that say how often an individual was selected.
+ *
+ *  The errors of the pool are extracted and the epsilons computed once, all the selections
+ *  being run on the same case-major matrix of errors.
+ */
+void SelectLexicaseOp::selectNIndividuals(unsigned int inN,
+                                          Individual::Bag& ioPool,
+                                          Context& ioContext,
+                                          std::vector<unsigned int>& outSelections)
+{
+	Beagle_StackTraceBeginM();
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "selection", "Beagle::SelectLexicaseOp",
+	    std::string("Selecting ")+uint2str(inN)+" individuals from a pool of "+uint2str(ioPool.size())+
+	    " individuals"
+	);
+
+	std::vector<double> lErrors;
+	unsigned int lNbCases = 0;
+	extractCaseErrors(ioPool, lErrors, lNbCases);
+	std::vector<double> lEpsilons;
+	computeEpsilons(lErrors, ioPool.size(), lNbCases, lEpsilons);
+
+	outSelections.clear();
+	outSelections.resize(ioPool.size(), 0);
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	std::vector<unsigned int> lCandidates;
+	std::vector<unsigned int> lCases;
+	for(unsigned int i=0; i<inN; ++i) {
+		++outSelections[selectLexicase(lErrors, ioPool.size(), lNbCases, lEpsilons,
+		                               lRandomizer, lCandidates, lCases)];
+	}
+	Beagle_StackTraceEndM("void SelectLexicaseOp::selectNIndividuals(unsigned int,Individual::Bag&,Context&,std::vector<unsigned int>&)");
+}
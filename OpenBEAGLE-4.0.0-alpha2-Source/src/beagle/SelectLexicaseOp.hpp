@@ -0,0 +1,136 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/SelectLexicaseOp.hpp
+ *  \brief  Definition of the class SelectLexicaseOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_SelectLexicaseOp_hpp
+#define Beagle_SelectLexicaseOp_hpp
+
+#include <string>
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/SelectionOp.hpp"
+#include "beagle/Double.hpp"
+#include "beagle/Randomizer.hpp"
+
+
+namespace Beagle
+{
+
+/*!
+ *  \class SelectLexicaseOp beagle/SelectLexicaseOp.hpp "beagle/SelectLexicaseOp.hpp"
+ *  \brief Lexicase selection operator class.
+ *  \ingroup ECF
+ *  \ingroup Op
+ *
+ *  Each selection considers the fitness cases in a random order, keeping at each case only
+ *  the candidates whose error is within \c ec.sel.lexepsilon of the best error of the
+ *  remaining candidates, until a single candidate remains or all the cases are used. The
+ *  individuals must have a FitnessCaseErrors fitness, with errors on the same fitness cases.
+ *
+ *  The errors of the pool are transposed once into a case-major matrix, so that filtering
+ *  the candidates on a case reads contiguous memory. When \c ec.sel.lexepsilon is negative,
+ *  the epsilon of each case is the median absolute deviation of the errors on that case
+ *  (epsilon-lexicase selection).
+ *
+ *  When selecting one individual at a time, as in breeder trees, the matrix of errors and
+ *  the epsilons are kept between selections, and only rebuilt when the generation, the deme
+ *  or the individuals of the pool change.
+ */
+class SelectLexicaseOp : public SelectionOp
+{
+
+public:
+
+	//! SelectLexicaseOp allocator type.
+	typedef AllocatorT<SelectLexicaseOp,SelectionOp::Alloc> Alloc;
+	//! SelectLexicaseOp handle type.
+	typedef PointerT<SelectLexicaseOp,SelectionOp::Handle> Handle;
+	//! SelectLexicaseOp bag type.
+	typedef ContainerT<SelectLexicaseOp,SelectionOp::Bag> Bag;
+
+	explicit SelectLexicaseOp(std::string inReproProbaName="ec.repro.prob",
+	                          std::string inName="SelectLexicaseOp");
+	virtual ~SelectLexicaseOp()
+	{ }
+
+	virtual void         registerParams(System& ioSystem);
+	virtual unsigned int selectIndividual(Individual::Bag& ioPool, Context& ioContext);
+	virtual void         selectNIndividuals(unsigned int inN,
+	                                        Individual::Bag& ioPool,
+	                                        Context& ioContext,
+	                                        std::vector<unsigned int>& outSelections);
+
+	static double computeMAD(std::vector<double>& ioValues);
+
+protected:
+
+	void         computeEpsilons(const std::vector<double>& inErrors,
+	                             unsigned int inPoolSize,
+	                             unsigned int inNbCases,
+	                             std::vector<double>& outEpsilons) const;
+	void         extractCaseErrors(Individual::Bag& ioPool,
+	                               std::vector<double>& outErrors,
+	                               unsigned int& outNbCases) const;
+	bool         isCacheValid(Individual::Bag& ioPool, Context& ioContext) const;
+	unsigned int selectLexicase(const std::vector<double>& inErrors,
+	                            unsigned int inPoolSize,
+	                            unsigned int inNbCases,
+	                            const std::vector<double>& inEpsilons,
+	                            Randomizer& ioRandomizer,
+	                            std::vector<unsigned int>& ioCandidates,
+	                            std::vector<unsigned int>& ioCases) const;
+
+	Double::Handle                 mEpsilon;            //!< Error tolerance of the selection, automatic when negative.
+	std::vector<double>            mCacheErrors;        //!< Case-major errors of the cached pool.
+	std::vector<double>            mCacheEpsilons;      //!< Error tolerance of each case of the cached pool.
+	std::vector<const Individual*> mCacheIndividuals;   //!< Individuals of the cached pool.
+	std::vector<const Fitness*>    mCacheFitnesses;     //!< Fitnesses of the individuals of the cached pool.
+	unsigned int                   mCacheNbCases;       //!< Number of fitness cases of the cached pool.
+	unsigned int                   mCacheGeneration;    //!< Generation of the cached pool.
+	unsigned int                   mCacheDemeIndex;     //!< Deme index of the cached pool.
+	std::vector<unsigned int>      mCandidates;         //!< Work buffer for the candidates.
+	std::vector<unsigned int>      mCases;              //!< Work buffer for the order of the cases.
+
+};
+
+}
+
+#endif // Beagle_SelectLexicaseOp_hpp
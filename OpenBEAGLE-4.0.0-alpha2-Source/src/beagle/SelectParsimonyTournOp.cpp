@@ -35,6 +35,8 @@
 
 #include "beagle/Beagle.hpp"
 
+#include <algorithm>
+
 using namespace Beagle;
 
 
@@ -147,3 +149,61 @@ unsigned int SelectParsimonyTournOp::selectIndividual(Individual::Bag& ioPool, C
 	return lChoosenIndividual;
 	Beagle_StackTraceEndM("unsigned int SelectParsimonyTournOp::selectIndividual(Individual::Bag& ioPool, Context& ioContext)");
 }
+
+
+/*!
+ *  \brief Select inN individuals using lexicographic parsimony pressure tournaments.
+ *  \param inN Number of individuals to select.
+ *  \param ioPool Pool from which the individuals are choosen.
+ *  \param ioContext Evolutionary context.
+ *  \param outSelections Vector of unsigned ints that say how often an individual was selected.
+ *
+ *  The fitness sort keys of the pool are extracted once into a flat array, on which all the
+ *  tournaments are run. When the individuals' fitnesses have no sort key, the selection falls
+ *  back on calling selectIndividual for each selected individual.
+ */
+void SelectParsimonyTournOp::selectNIndividuals(unsigned int inN,
+                                                Individual::Bag& ioPool,
+                                                Context& ioContext,
+                                                std::vector<unsigned int>& outSelections)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<double> lKeys;
+	unsigned int lKeySize = 0;
+	if(extractFitnessKeys(ioPool, lKeys, lKeySize) == false) {
+		SelectionOp::selectNIndividuals(inN, ioPool, ioContext, outSelections);
+		return;
+	}
+	Beagle_ValidateParameterM(mNumberParticipants->getWrappedValue() > 0,
+	                          "ec.sel.tournsize", ">0");
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "selection", "Beagle::SelectParsimonyTournOp",
+	    std::string("Selecting ")+uint2str(inN)+" individuals from a pool of "+uint2str(ioPool.size())+
+	    " individuals"
+	);
+
+	std::vector<unsigned int> lSizes(ioPool.size());
+	for(unsigned int i=0; i<ioPool.size(); ++i) lSizes[i] = ioPool[i]->getSize();
+
+	outSelections.clear();
+	outSelections.resize(ioPool.size(), 0);
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	const unsigned int lLastIndex = ((unsigned int)ioPool.size())-1;
+	const unsigned int lNbParticipants = mNumberParticipants->getWrappedValue();
+	for(unsigned int i=0; i<inN; ++i) {
+		unsigned int lChoosenIndividual = lRandomizer.rollInteger(0,lLastIndex);
+		for(unsigned int j=1; j<lNbParticipants; ++j) {
+			const unsigned int lTriedIndividual = lRandomizer.rollInteger(0,lLastIndex);
+			const double* lChoosenKey = &lKeys[lChoosenIndividual*lKeySize];
+			const double* lTriedKey = &lKeys[lTriedIndividual*lKeySize];
+			if(isKeyLess(lChoosenKey, lTriedKey, lKeySize)) {
+				lChoosenIndividual = lTriedIndividual;
+			} else if(std::equal(lChoosenKey, lChoosenKey+lKeySize, lTriedKey)) {
+				if(lSizes[lTriedIndividual] < lSizes[lChoosenIndividual]) lChoosenIndividual = lTriedIndividual;
+			}
+		}
+		++outSelections[lChoosenIndividual];
+	}
+	Beagle_StackTraceEndM("void SelectParsimonyTournOp::selectNIndividuals(unsigned int,Individual::Bag&,Context&,std::vector<unsigned int>&)");
+}
@@ -83,6 +83,10 @@ public:
 
 	virtual void         registerParams(System& ioSystem);
 	virtual unsigned int selectIndividual(Individual::Bag& ioPool, Context& ioContext);
+	virtual void         selectNIndividuals(unsigned int inN,
+	                                        Individual::Bag& ioPool,
+	                                        Context& ioContext,
+	                                        std::vector<unsigned int>& outSelections);
 
 protected:
 
@@ -57,7 +57,7 @@ public:
 	{
 		Beagle_StackTraceBeginM();
 		if( (!inLeft.second) || (!inRight.second) ) return false;
-		return inRight.second->isLess(*inLeft.second);
+		return inLeft.second->isLess(*inRight.second);
 		Beagle_StackTraceEndM("bool TempPoolPredicate::operator()(const std::pair<unsigned int,Pointer&>,const std::pair<unsigned int, Pointer&>) const");
 	}
 
@@ -129,3 +129,54 @@ unsigned int SelectWorstTournOp::selectIndividual(Individual::Bag& ioPool, Conte
 	return lChoosenIndividual;
 	Beagle_StackTraceEndM("unsigned int SelectWorstTournOp::selectIndividual(Individual::Bag&,Context&)");
 }
+
+
+/*!
+ *  \brief Select inN individuals using tournaments of the worst individuals.
+ *  \param inN Number of individuals to select.
+ *  \param ioPool Pool from which the individuals are choosen.
+ *  \param ioContext Evolutionary context.
+ *  \param outSelections Vector of unsigned ints that say how often an individual was selected.
+ *
+ *  The fitness sort keys of the pool are extracted once into a flat array, on which all the
+ *  tournaments are run. When the individuals' fitnesses have no sort key, the selection falls
+ *  back on calling selectIndividual for each selected individual.
+ */
+void SelectWorstTournOp::selectNIndividuals(unsigned int inN,
+                                            Individual::Bag& ioPool,
+                                            Context& ioContext,
+                                            std::vector<unsigned int>& outSelections)
+{
+	Beagle_StackTraceBeginM();
+	std::vector<double> lKeys;
+	unsigned int lKeySize = 0;
+	if(extractFitnessKeys(ioPool, lKeys, lKeySize) == false) {
+		SelectionOp::selectNIndividuals(inN, ioPool, ioContext, outSelections);
+		return;
+	}
+	Beagle_ValidateParameterM(mNumberParticipants->getWrappedValue() > 0,
+	                          "ec.sel.worsttournsize", ">0");
+	Beagle_LogTraceM(
+	    ioContext.getSystem().getLogger(),
+	    "selection", "Beagle::SelectWorstTournOp",
+	    std::string("Selecting ")+uint2str(inN)+" individuals from a pool of "+uint2str(ioPool.size())+
+	    " individuals"
+	);
+
+	outSelections.clear();
+	outSelections.resize(ioPool.size(), 0);
+	Randomizer& lRandomizer = ioContext.getSystem().getRandomizer();
+	const unsigned int lLastIndex = ((unsigned int)ioPool.size())-1;
+	const unsigned int lNbParticipants = mNumberParticipants->getWrappedValue();
+	for(unsigned int i=0; i<inN; ++i) {
+		unsigned int lChoosenIndividual = lRandomizer.rollInteger(0,lLastIndex);
+		for(unsigned int j=1; j<lNbParticipants; ++j) {
+			const unsigned int lTriedIndividual = lRandomizer.rollInteger(0,lLastIndex);
+			if(isKeyLess(&lKeys[lTriedIndividual*lKeySize], &lKeys[lChoosenIndividual*lKeySize], lKeySize)) {
+				lChoosenIndividual = lTriedIndividual;
+			}
+		}
+		++outSelections[lChoosenIndividual];
+	}
+	Beagle_StackTraceEndM("void SelectWorstTournOp::selectNIndividuals(unsigned int,Individual::Bag&,Context&,std::vector<unsigned int>&)");
+}
@@ -122,6 +122,42 @@ void SelectionOp::convertToList(unsigned int inN, std::vector<unsigned int>& ioS
 
 
 
+/*!
+ *  \brief Extract the fitness sort keys of a pool of individuals into a flat array.
+ *  \param ioPool Pool of individuals.
+ *  \param outKeys Array of keys, the key of the ith individual starting at index i*outKeySize.
+ *  \param outKeySize Number of values in the key of each individual.
+ *  \return True if the keys are extracted, false if some individual has no sort key.
+ *
+ *  Selection operators comparing numerous individuals should use the keys when available,
+ *  as comparing them is much cheaper than calling Individual::isLess. When this method
+ *  returns false, the operators must fall back on Individual::isLess.
+ */
+bool SelectionOp::extractFitnessKeys(Individual::Bag& ioPool,
+                                     std::vector<double>& outKeys,
+                                     unsigned int& outKeySize) const
+{
+	Beagle_StackTraceBeginM();
+	outKeys.clear();
+	outKeySize = 0;
+	if(ioPool.empty()) return false;
+	for(unsigned int i=0; i<ioPool.size(); ++i) {
+		const Fitness::Handle lFitness = ioPool[i]->getFitness();
+		if(lFitness == NULL) return false;
+		const unsigned int lKeySize = lFitness->getSortKeySize();
+		if(lKeySize == 0) return false;
+		if(i == 0) {
+			outKeySize = lKeySize;
+			outKeys.resize(ioPool.size()*outKeySize);
+		}
+		else if(lKeySize != outKeySize) return false;
+		lFitness->getSortKey(&outKeys[i*outKeySize]);
+	}
+	return true;
+	Beagle_StackTraceEndM("bool SelectionOp::extractFitnessKeys(Individual::Bag&,std::vector<double>&,unsigned int&) const");
+}
+
+
 /*!
  *  \return Return selection probability of breeder operator.
  */
@@ -37,6 +37,7 @@
 #define Beagle_SelectionOp_hpp
 
 #include <string>
+#include <vector>
 
 #include "beagle/config.hpp"
 #include "beagle/macros.hpp"
@@ -99,8 +100,28 @@ public:
 	virtual void               readWithSystem(PACC::XML::ConstIterator inIter, System& ioSystem);
 	virtual void               writeContent(PACC::XML::Streamer& ioStreamer, bool inIndent=true) const;
 
+	/*!
+	 *  \brief Test whether a fitness sort key is lexicographically less than another.
+	 *  \param inLeft Left sort key.
+	 *  \param inRight Right sort key.
+	 *  \param inKeySize Number of values in the sort keys.
+	 *  \return True if the left key is less than the right one, false if not.
+	 */
+	static inline bool isKeyLess(const double* inLeft, const double* inRight, unsigned int inKeySize)
+	{
+		for(unsigned int i=0; i<inKeySize; ++i) {
+			if(inLeft[i] < inRight[i]) return true;
+			else if(inLeft[i] > inRight[i]) return false;
+		}
+		return false;
+	}
+
 protected:
 
+	bool extractFitnessKeys(Individual::Bag& ioPool,
+	                        std::vector<double>& outKeys,
+	                        unsigned int& outKeySize) const;
+
 	Double::Handle mReproductionProba;    //!< Reproduction probability.
 	std::string   mReproProbaName;       //!< Reproduction probability name.
 
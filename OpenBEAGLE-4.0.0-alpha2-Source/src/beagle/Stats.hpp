@@ -36,7 +36,9 @@
 #ifndef Beagle_Stats_hpp
 #define Beagle_Stats_hpp
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "PACC/XML.hpp"
 
@@ -204,6 +206,22 @@ public:
 		Beagle_StackTraceEndM("const double& Stats::getItem(std::string) const");
 	}
 
+	/*!
+	 *  \brief  Get the tags of the items of the statistics.
+	 *  \param  outTags Vector where the tags are written, in lexicographical order.
+	 */
+	inline void getItemTags(std::vector<std::string>& outTags) const
+	{
+		Beagle_StackTraceBeginM();
+		outTags.clear();
+		outTags.reserve(mItemMap.size());
+		for(ItemMap::const_iterator lIter=mItemMap.begin(); lIter!=mItemMap.end(); ++lIter) {
+			outTags.push_back(lIter->first);
+		}
+		std::sort(outTags.begin(), outTags.end());
+		Beagle_StackTraceEndM("void Stats::getItemTags(std::vector<std::string>&) const");
+	}
+
 	/*!
 	 *  \return Id of the stats.
 	 */
@@ -35,11 +35,52 @@
 
 #include "beagle/Beagle.hpp"
 
-#include <cmath>
 #include <sstream>
 
 using namespace Beagle;
 
+namespace
+{
+
+/*!
+ *  \brief Statistics measure of the objectives of multiobjective fitnesses, with IDs
+ *    "objective0", "objective1", and so on.
+ */
+class FitnessMultiObjMeasure : public StatsMeasure
+{
+public:
+	FitnessMultiObjMeasure()
+	{ }
+	virtual ~FitnessMultiObjMeasure()
+	{ }
+
+	virtual unsigned int getNumberOfValues(const Deme& inDeme) const
+	{
+		Beagle_StackTraceBeginM();
+		return inDeme.empty() ? 0 : inDeme[0]->getFitness()->getNumberOfObjectives();
+		Beagle_StackTraceEndM("unsigned int FitnessMultiObjMeasure::getNumberOfValues(const Deme&) const");
+	}
+
+	virtual std::string getValueID(unsigned int inIndex) const
+	{
+		return std::string("objective")+uint2str(inIndex);
+	}
+
+	virtual void getValues(const Individual& inIndividual, unsigned int inNbValues, double* outValues) const
+	{
+		Beagle_StackTraceBeginM();
+		// The number of values is taken from the first individual of the deme, the missing
+		// objectives of an individual having less are taken as zero.
+		const Fitness& lFitness = *inIndividual.getFitness();
+		const unsigned int lNbObjectives = minOf<unsigned int>(lFitness.getNumberOfObjectives(), inNbValues);
+		for(unsigned int i=0; i<lNbObjectives; ++i) outValues[i] = lFitness.getObjective(i);
+		for(unsigned int i=lNbObjectives; i<inNbValues; ++i) outValues[i] = 0.0;
+		Beagle_StackTraceEndM("void FitnessMultiObjMeasure::getValues(const Individual&,unsigned int,double*) const");
+	}
+};
+
+}
+
 
 /*!
  *  \brief Construct a calculate stats operator.
@@ -47,7 +88,9 @@ using namespace Beagle;
  */
 StatsCalcFitnessMultiObjOp::StatsCalcFitnessMultiObjOp(std::string inName) :
 		StatsCalculateOp(inName)
-{ }
+{
+	addMeasure(new FitnessMultiObjMeasure);
+}
 
 
 /*!
@@ -65,65 +108,10 @@ void StatsCalcFitnessMultiObjOp::calculateStatsDeme(Stats& outStats,
 	outStats.clearItems();
 	outStats.addItem("processed", ioContext.getProcessedDeme());
 	outStats.addItem("total-processed", ioContext.getTotalProcessedDeme());
-
-	if(ioDeme.size() == 0) {
-		outStats.clear();
-		outStats.setGenerationValues(std::string("deme")+uint2str(ioContext.getDemeIndex()),
-		                             ioContext.getGeneration(), 0, true);
-		return;
-	}
-
-	outStats.clear();
 	outStats.setGenerationValues(std::string("deme")+uint2str(ioContext.getDemeIndex()),
-	                             ioContext.getGeneration(), ioDeme.size(), true);
-
-	const unsigned int lNbObjectives = ioDeme[0]->getFitness()->getNumberOfObjectives();
-	for(unsigned int j=0; j<lNbObjectives; ++j) {
-		const double lFirstIndObjJ = ioDeme[0]->getFitness()->getObjective(j);
-		if(ioDeme.size() == 1) {
-			outStats.push_back(Measure(std::string("objective")+uint2str(j),
-			                           lFirstIndObjJ, 0.0, lFirstIndObjJ, lFirstIndObjJ));
-		} else {
-			double lSum = lFirstIndObjJ;
-			double lPow2Sum = pow2Of<double>(lFirstIndObjJ);
-			double lMax = lFirstIndObjJ;
-			double lMin = lFirstIndObjJ;
-#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-			int lSize = ioDeme.size();
-			#pragma omp parallel 
-			{
-				double lMaxThread = lMax;
-				double lMinThread = lMin;
-				#pragma omp for reduction(+:lSum, lPow2Sum)
-				for(int i=1; i < lSize; ++i) {
-					Beagle_AssertM(lNbObjectives == ioDeme[i]->getFitness()->getNumberOfObjectives());
-					const double lIndivObjJ = ioDeme[i]->getFitness()->getObjective(j);
-					lSum     += lIndivObjJ;
-					lPow2Sum += pow2Of<double>(lIndivObjJ);
-					lMaxThread =  maxOf<double>(lMaxThread,lIndivObjJ);
-					lMinThread =  minOf<double>(lMinThread,lIndivObjJ);
-				}
-				#pragma omp critical (Beagle_StatsCalcFitnessMultiObjOp_Max)
-				lMax = maxOf<double>(lMax, lMaxThread);
-				#pragma omp critical (Beagle_StatsCalcFitnessMultiObjOp_Min)
-				lMin = minOf<double>(lMin, lMinThread);
-			}
-#else
-			for(unsigned int i=1; i<ioDeme.size(); i++) {
-				Beagle_AssertM(lNbObjectives == ioDeme[i]->getFitness()->getNumberOfObjectives());
-				const double lIndivObjJ = ioDeme[i]->getFitness()->getObjective(j);
-				lSum     += lIndivObjJ;
-				lPow2Sum += pow2Of<double>(lIndivObjJ);
-				lMax     =  maxOf<double>(lMax,lIndivObjJ);
-				lMin     =  minOf<double>(lMin,lIndivObjJ);
-			}
-#endif
-			double lAverage  = lSum / ioDeme.size();
-			double lStdError = (lPow2Sum - (pow2Of<double>(lSum)/ioDeme.size())) / (ioDeme.size()-1);
-			lStdError        = sqrt(lStdError);
-			outStats.push_back(Measure(std::string("objective")+uint2str(j),
-			                           lAverage, lStdError, lMax, lMin));
-		}
-	}
+	                             ioContext.getGeneration(),
+	                             ioDeme.size(),
+	                             true);
+	calculateMeasures(outStats, ioDeme, ioContext);
 	Beagle_StackTraceEndM("void StatsCalcFitnessMultiObjOp::calculateStatsDeme(Stats& outStats, Deme& ioDeme, Context& ioContext) const");
 }
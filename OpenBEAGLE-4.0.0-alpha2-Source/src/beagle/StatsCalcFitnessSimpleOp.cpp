@@ -35,12 +35,45 @@
 
 #include "beagle/Beagle.hpp"
 
-#include <cmath>
 #include <sstream>
 
 using namespace std;
 using namespace Beagle;
 
+namespace
+{
+
+/*!
+ *  \brief Statistics measure of the value of simple fitnesses, with ID "fitness".
+ */
+class FitnessSimpleMeasure : public StatsMeasure
+{
+public:
+	FitnessSimpleMeasure()
+	{ }
+	virtual ~FitnessSimpleMeasure()
+	{ }
+
+	virtual unsigned int getNumberOfValues(const Deme&) const
+	{
+		return 1;
+	}
+
+	virtual std::string getValueID(unsigned int) const
+	{
+		return "fitness";
+	}
+
+	virtual void getValues(const Individual& inIndividual, unsigned int, double* outValues) const
+	{
+		Beagle_StackTraceBeginM();
+		outValues[0] = castObjectT<const FitnessSimple&>(*inIndividual.getFitness()).getValue();
+		Beagle_StackTraceEndM("void FitnessSimpleMeasure::getValues(const Individual&,unsigned int,double*) const");
+	}
+};
+
+}
+
 
 /*!
  *  \brief Construct a calculate stats operator.
@@ -48,7 +81,9 @@ using namespace Beagle;
  */
 StatsCalcFitnessSimpleOp::StatsCalcFitnessSimpleOp(std::string inName) :
 		StatsCalculateOp(inName)
-{ }
+{
+	addMeasure(new FitnessSimpleMeasure);
+}
 
 
 /*!
@@ -66,84 +101,11 @@ void StatsCalcFitnessSimpleOp::calculateStatsDeme(Stats& outStats,
 	outStats.clearItems();
 	outStats.addItem("processed", ioContext.getProcessedDeme());
 	outStats.addItem("total-processed", ioContext.getTotalProcessedDeme());
-
-	if(ioDeme.size() == 0) {
-		outStats.setGenerationValues(string("deme")+uint2str(ioContext.getDemeIndex()),
-		                             ioContext.getGeneration(), 0, true);
-		outStats.resize(1);
-		outStats.back().mID  = "fitness";
-		outStats.back().mAvg = 0.0;
-		outStats.back().mStd = 0.0;
-		outStats.back().mMax = 0.0;
-		outStats.back().mMin = 0.0;
-		return;
-	}
-
-	const FitnessSimple::Handle lFirstIndivFitness =
-	    castHandleT<FitnessSimple>(ioDeme[0]->getFitness());
-
-	if(ioDeme.size() == 1) {
-		outStats.setGenerationValues(string("deme")+uint2str(ioContext.getDemeIndex()),
-		                             ioContext.getGeneration(), 1, true);
-		outStats.resize(1);
-		outStats.back().mID  = "fitness";
-		outStats.back().mAvg = lFirstIndivFitness->getValue();
-		outStats.back().mStd = 0.0;
-		outStats.back().mMax = lFirstIndivFitness->getValue();
-		outStats.back().mMin = lFirstIndivFitness->getValue();
-		return;
-	}
-
-	double lSum = (double)lFirstIndivFitness->getValue();
-	double lPow2Sum = pow2Of<double>((double)lFirstIndivFitness->getValue());
-	double lMax = lFirstIndivFitness->getValue();
-	double lMin = lFirstIndivFitness->getValue();
-
-#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
-	int lSize = ioDeme.size();
-	#pragma omp parallel 
-	{
-		double lMaxThread = lMax;
-		double lMinThread = lMin;
-	
-		#pragma omp for reduction(+:lSum, lPow2Sum)
-		for(int i=1; i < lSize; ++i) {
-			const double lIndFitnessValue  = 
-			    castHandleT<FitnessSimple>(ioDeme[i]->getFitness())->getValue();
-			lSum     += lIndFitnessValue;
-			lPow2Sum += pow2Of<double>(lIndFitnessValue);
-			lMaxThread =  maxOf<double>(lMaxThread, lIndFitnessValue);
-			lMinThread =  minOf<double>(lMinThread, lIndFitnessValue);
-		}
-		#pragma omp critical (Beagle_StatsCalcFitnessSimpleOp_Max)
-		lMax = maxOf<double>(lMax, lMaxThread);
-		#pragma omp critical (Beagle_StatsCalcFitnessSimpleOp_Min)
-		lMin = minOf<double>(lMin, lMinThread);
-	}
-#else
-	for(unsigned int i=1; i<ioDeme.size(); i++) {
-		const FitnessSimple::Handle lIndivFitness =
-		    castHandleT<FitnessSimple>(ioDeme[i]->getFitness());
-		lSum     += (double)lIndivFitness->getValue();
-		lPow2Sum += pow2Of<double>((double)lIndivFitness->getValue());
-		lMax     =  maxOf<double>(lMax, (double)lIndivFitness->getValue());
-		lMin     =  minOf<double>(lMin, (double)lIndivFitness->getValue());
-	}
-#endif
-	double lAverage  = lSum / ioDeme.size();
-	double lStdError = (lPow2Sum - (pow2Of<double>(lSum)/ioDeme.size())) / (ioDeme.size()-1);
-	lStdError        = sqrt(lStdError);
-
 	outStats.setGenerationValues(string("deme")+uint2str(ioContext.getDemeIndex()),
 	                             ioContext.getGeneration(),
 	                             ioDeme.size(),
 	                             true);
-	outStats.resize(1);
-	outStats.back().mID  = "fitness";
-	outStats.back().mAvg = lAverage;
-	outStats.back().mStd = lStdError;
-	outStats.back().mMax = lMax;
-	outStats.back().mMin = lMin;
+	calculateMeasures(outStats, ioDeme, ioContext);
 	Beagle_StackTraceEndM("void StatsCalcFitnessSimpleOp::calculateStatsDeme(Stats& outStats, Deme& ioDeme, Context& ioContext) const");
 }
 
@@ -54,6 +54,73 @@ StatsCalculateOp::StatsCalculateOp(std::string inName) :
 { }
 
 
+/*!
+ *  \brief Calculate the registered measures over a deme.
+ *  \param outStats Statistics to which the measures are appended.
+ *  \param ioDeme Deme to evaluate the measures.
+ *  \param ioContext Context of the evolution.
+ *
+ *  All the values of all the registered measures are accumulated in a single pass over the
+ *  deme. With OpenMP, each thread accumulates a static partition of the deme into its own
+ *  accumulators, which are then merged in thread order, so that the result does not depend
+ *  on the scheduling of the threads.
+ */
+void StatsCalculateOp::calculateMeasures(Stats& outStats, Deme& ioDeme, Context& ioContext) const
+{
+	Beagle_StackTraceBeginM();
+	// Get number of values of each measure and offsets in the values array
+	std::vector<unsigned int> lOffsets(mMeasures.size()+1, 0);
+	for(unsigned int i=0; i<mMeasures.size(); ++i) {
+		lOffsets[i+1] = lOffsets[i] + mMeasures[i]->getNumberOfValues(ioDeme);
+	}
+	const unsigned int lNbValues = lOffsets.back();
+	if(lNbValues == 0) return;
+
+	std::vector<StatsMeasure::Accumulator> lAccumulators(lNbValues);
+	const int lSize = ioDeme.size();
+
+#if defined(BEAGLE_USE_OMP_R) || defined(BEAGLE_USE_OMP_NR)
+	static OpenMP::Handle lOpenMP = castHandleT<OpenMP>(ioContext.getSystem().getComponent("OpenMP"));
+	const unsigned int lNbThreads = lOpenMP->getMaxNumThreads();
+	std::vector< std::vector<StatsMeasure::Accumulator> > lThreadAccumulators(lNbThreads);
+	#pragma omp parallel
+	{
+		std::vector<StatsMeasure::Accumulator>& lLocalAccumulators =
+		    lThreadAccumulators[lOpenMP->getThreadNum()];
+		lLocalAccumulators.resize(lNbValues);
+		std::vector<double> lValues(lNbValues);
+		#pragma omp for schedule(static)
+		for(int i=0; i<lSize; ++i) {
+			for(unsigned int j=0; j<mMeasures.size(); ++j) {
+				mMeasures[j]->getValues(*ioDeme[i], lOffsets[j+1]-lOffsets[j], &lValues[lOffsets[j]]);
+			}
+			for(unsigned int k=0; k<lNbValues; ++k) lLocalAccumulators[k].add(lValues[k]);
+		}
+	}
+	for(unsigned int t=0; t<lNbThreads; ++t) {
+		for(unsigned int k=0; k<lThreadAccumulators[t].size(); ++k) {
+			lAccumulators[k].merge(lThreadAccumulators[t][k]);
+		}
+	}
+#else
+	std::vector<double> lValues(lNbValues);
+	for(int i=0; i<lSize; ++i) {
+		for(unsigned int j=0; j<mMeasures.size(); ++j) {
+			mMeasures[j]->getValues(*ioDeme[i], lOffsets[j+1]-lOffsets[j], &lValues[lOffsets[j]]);
+		}
+		for(unsigned int k=0; k<lNbValues; ++k) lAccumulators[k].add(lValues[k]);
+	}
+#endif
+
+	for(unsigned int j=0; j<mMeasures.size(); ++j) {
+		for(unsigned int k=lOffsets[j]; k<lOffsets[j+1]; ++k) {
+			outStats.push_back(lAccumulators[k].getMeasure(mMeasures[j]->getValueID(k-lOffsets[j])));
+		}
+	}
+	Beagle_StackTraceEndM("void StatsCalculateOp::calculateMeasures(Stats&,Deme&,Context&) const");
+}
+
+
 /*!
  *  \brief  Calculate statistics of a given vivarium.
  *  \param  outStats Computed stats of the deme.
@@ -183,8 +250,14 @@ void StatsCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 		ioDeme.addMember(lStats);
 	}
 
+	FitnessCache::Handle lCache = castHandleT<FitnessCache>(ioContext.getSystem().haveComponent("FitnessCache"));
+
 	if(ioDeme.getStats()->isValid() == false) {
 		calculateStatsDeme(*ioDeme.getStats(), ioDeme, ioContext);
+		if(lCache != NULL) {
+			ioDeme.getStats()->modifyItem("cache-hits", lCache->getDemeHits());
+			ioDeme.getStats()->modifyItem("cache-misses", lCache->getDemeMisses());
+		}
 		ioDeme.getStats()->setValid();
 	}
 	
@@ -214,6 +287,10 @@ void StatsCalculateOp::operate(Deme& ioDeme, Context& ioContext)
 		calculateStatsVivarium(*ioContext.getVivarium().getStats(),
 		                       ioContext.getVivarium(),
 		                       ioContext);
+		if(lCache != NULL) {
+			ioContext.getVivarium().getStats()->modifyItem("cache-hits", lCache->getVivariumHits());
+			ioContext.getVivarium().getStats()->modifyItem("cache-misses", lCache->getVivariumMisses());
+		}
 		ioContext.getVivarium().getStats()->setValid();
 		
 		Beagle_LogObjectM(
@@ -48,6 +48,7 @@
 #include "beagle/WrapperT.hpp"
 #include "beagle/Operator.hpp"
 #include "beagle/Stats.hpp"
+#include "beagle/StatsMeasure.hpp"
 #include "beagle/Vivarium.hpp"
 #include "beagle/Context.hpp"
 #include "beagle/UInt.hpp"
@@ -94,8 +95,33 @@ public:
 	                                    Vivarium& ioVivarium,
 	                                    Context& ioContext) const;
 
+	/*!
+	 *  \brief Register a measure computed on the individuals of each deme.
+	 *  \param inMeasure Measure to register.
+	 */
+	inline void addMeasure(StatsMeasure::Handle inMeasure)
+	{
+		Beagle_StackTraceBeginM();
+		mMeasures.push_back(inMeasure);
+		Beagle_StackTraceEndM("void StatsCalculateOp::addMeasure(StatsMeasure::Handle)");
+	}
+
+	/*!
+	 *  \return Measures computed on the individuals of each deme.
+	 */
+	inline const StatsMeasure::Bag& getMeasures() const
+	{
+		Beagle_StackTraceBeginM();
+		return mMeasures;
+		Beagle_StackTraceEndM("const StatsMeasure::Bag& StatsCalculateOp::getMeasures() const");
+	}
+
 protected:
 
+	void calculateMeasures(Stats& outStats, Deme& ioDeme, Context& ioContext) const;
+
+	StatsMeasure::Bag  mMeasures;             //!< Measures computed on the individuals of each deme.
+
 	UIntArray::Handle  mPopSize;              //!< Population size for the evolution.
 	unsigned int       mNbDemesCalculated;    //!< Number of demes for which stats is computed.
 	unsigned int       mGenerationCalculated; //!< Actual generation for which stats is computed.
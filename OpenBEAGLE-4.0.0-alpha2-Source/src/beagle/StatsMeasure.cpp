@@ -0,0 +1,59 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/src/StatsMeasure.cpp
+ *  \brief  Source code of class StatsMeasure.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+#include <cmath>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Get the statistical measure of the accumulated values.
+ *  \param inID ID of the measure.
+ *  \return Average, standard deviation, maximum and minimum of the accumulated values.
+ */
+Measure StatsMeasure::Accumulator::getMeasure(const std::string& inID) const
+{
+	Beagle_StackTraceBeginM();
+	if(mCount == 0) return Measure(inID, 0.0, 0.0, 0.0, 0.0);
+	const double lAverage = mSum / mCount;
+	if(mCount == 1) return Measure(inID, lAverage, 0.0, mMax, mMin);
+	double lVariance = (mPow2Sum - (pow2Of<double>(mSum) / mCount)) / (mCount - 1);
+	// Rounding errors can make the variance of constant values slightly negative
+	if(lVariance < 0.0) lVariance = 0.0;
+	return Measure(inID, lAverage, std::sqrt(lVariance), mMax, mMin);
+	Beagle_StackTraceEndM("Measure StatsMeasure::Accumulator::getMeasure(const std::string&) const");
+}
@@ -0,0 +1,165 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+/*!
+ *  \file   beagle/StatsMeasure.hpp
+ *  \brief  Definition of class StatsMeasure.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_StatsMeasure_hpp
+#define Beagle_StatsMeasure_hpp
+
+#include <string>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/Pointer.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/Allocator.hpp"
+#include "beagle/AbstractAllocT.hpp"
+#include "beagle/Container.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/Stats.hpp"
+
+namespace Beagle
+{
+
+// Forward declarations
+class Individual;
+class Deme;
+
+
+/*!
+ *  \class StatsMeasure beagle/StatsMeasure.hpp "beagle/StatsMeasure.hpp"
+ *  \brief Abstract per-individual measure accumulated into the statistics of a deme.
+ *  \ingroup ECF
+ *  \ingroup FitStats
+ *
+ *  A statistics measure extracts one or several values from each individual of a deme.
+ *  The measures registered into a statistics calculation operator (see
+ *  StatsCalculateOp::addMeasure) are all computed in a single pass over the deme, the
+ *  average, standard deviation, maximum and minimum of each value being added to the
+ *  deme statistics.
+ *  \warning getValues can be called concurrently from several threads, it must not modify
+ *    the state of the measure.
+ */
+class StatsMeasure : public Object
+{
+
+public:
+
+	//! StatsMeasure allocator type.
+	typedef AbstractAllocT<StatsMeasure,Object::Alloc> Alloc;
+	//! StatsMeasure handle type.
+	typedef PointerT<StatsMeasure,Object::Handle> Handle;
+	//! StatsMeasure bag type.
+	typedef ContainerT<StatsMeasure,Object::Bag> Bag;
+
+	StatsMeasure()
+	{ }
+	virtual ~StatsMeasure()
+	{ }
+
+	/*!
+	 *  \brief Get the number of values extracted from each individual of a deme.
+	 *  \param inDeme Deme on which the statistics are calculated.
+	 *  \return Number of values of the measure.
+	 */
+	virtual unsigned int getNumberOfValues(const Deme& inDeme) const =0;
+
+	/*!
+	 *  \brief Get the ID of a value, used as the measure ID in the statistics.
+	 *  \param inIndex Index of the value.
+	 *  \return ID of the value.
+	 */
+	virtual std::string getValueID(unsigned int inIndex) const =0;
+
+	/*!
+	 *  \brief Extract the values of the measure from an individual.
+	 *  \param inIndividual Individual to extract the values from.
+	 *  \param inNbValues Number of values to write, as given by getNumberOfValues() for the deme.
+	 *  \param outValues Array of inNbValues values where the values are written.
+	 */
+	virtual void getValues(const Individual& inIndividual, unsigned int inNbValues, double* outValues) const =0;
+
+	/*!
+	 *  \brief Running accumulator of the moments, maximum and minimum of a value.
+	 */
+	struct Accumulator
+	{
+		unsigned int mCount;    //!< Number of values accumulated.
+		double       mSum;      //!< Sum of the values.
+		double       mPow2Sum;  //!< Sum of the squared values.
+		double       mMax;      //!< Maximum value.
+		double       mMin;      //!< Minimum value.
+
+		Accumulator() :
+			mCount(0), mSum(0.0), mPow2Sum(0.0), mMax(0.0), mMin(0.0)
+		{ }
+
+		//! Accumulate a value.
+		inline void add(double inValue)
+		{
+			if(mCount == 0) {
+				mMax = inValue;
+				mMin = inValue;
+			} else {
+				if(inValue > mMax) mMax = inValue;
+				if(inValue < mMin) mMin = inValue;
+			}
+			++mCount;
+			mSum += inValue;
+			mPow2Sum += inValue * inValue;
+		}
+
+		//! Merge the values accumulated into another accumulator.
+		inline void merge(const Accumulator& inRight)
+		{
+			if(inRight.mCount == 0) return;
+			if(mCount == 0) {
+				*this = inRight;
+				return;
+			}
+			mCount += inRight.mCount;
+			mSum += inRight.mSum;
+			mPow2Sum += inRight.mPow2Sum;
+			if(inRight.mMax > mMax) mMax = inRight.mMax;
+			if(inRight.mMin < mMin) mMin = inRight.mMin;
+		}
+
+		Measure getMeasure(const std::string& inID) const;
+	};
+
+};
+
+}
+
+#endif // Beagle_StatsMeasure_hpp
@@ -0,0 +1,252 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/src/StatsWriterOp.cpp
+ *  \brief  Source code of class StatsWriterOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#include "beagle/Beagle.hpp"
+
+#include <fstream>
+
+using namespace Beagle;
+
+
+/*!
+ *  \brief Construct a statistics writer operator.
+ *  \param inName Name of the operator.
+ */
+StatsWriterOp::StatsWriterOp(std::string inName) :
+		Operator(inName),
+		mStatsFilename(NULL),
+		mFlushInterval(NULL),
+		mPopSize(NULL),
+		mFileStarted(false)
+{ }
+
+
+/*!
+ *  \brief Destruct the statistics writer operator, appending the rows still buffered.
+ *
+ *  Rows are still buffered when the evolution is interrupted by an exception or terminates
+ *  before the end of the flushing interval. Errors are ignored, as a destructor can't throw.
+ */
+StatsWriterOp::~StatsWriterOp()
+{
+	appendBuffer();
+}
+
+
+/*!
+ *  \brief Append the buffered rows to the statistics file, and clear the buffer.
+ *  \return True if the rows were written, false if the file could not be opened.
+ */
+bool StatsWriterOp::appendBuffer()
+{
+	if(mBuffer.empty() || (mStatsFilename == NULL)) return true;
+	std::ofstream lOFS(mStatsFilename->getWrappedValue().c_str(), std::ios_base::out | std::ios_base::app);
+	if(!lOFS) return false;
+	lOFS.write(mBuffer.data(), mBuffer.size());
+	lOFS.close();
+	mBuffer.clear();
+	return true;
+}
+
+
+/*!
+ *  \brief Append the buffered rows to the statistics file.
+ *  \param ioContext Context of the evolution.
+ */
+void StatsWriterOp::flush(Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(appendBuffer() == false) {
+		throw Beagle_RunTimeExceptionM(std::string("Could not open statistics file '")+
+		                               mStatsFilename->getWrappedValue()+"' for writing!");
+	}
+	Beagle_StackTraceEndM("void StatsWriterOp::flush(Context&)");
+}
+
+
+/*!
+ *  \brief Register the parameters of this operator.
+ *  \param ioSystem System to use to initialize the operator.
+ */
+void StatsWriterOp::registerParams(System& ioSystem)
+{
+	Beagle_StackTraceBeginM();
+	Operator::registerParams(ioSystem);
+	{
+		std::ostringstream lOSS;
+		lOSS << "Name of the CSV file where the statistics of each generation are appended. ";
+		lOSS << "An empty string means no statistics file.";
+		Register::Description lDescription(
+		    "Statistics filename",
+		    "String",
+		    "'beagle-stats.csv'",
+		    lOSS.str()
+		);
+		mStatsFilename = castHandleT<String>(
+		                     ioSystem.getRegister().insertEntry("ec.stats.file", new String("beagle-stats.csv"), lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Statistics file flushing interval (in number of generations). The rows ";
+		lOSS << "are kept in memory between flushes. When zero, the file is only written ";
+		lOSS << "at the end of the evolution.";
+		Register::Description lDescription(
+		    "Statistics flushing interval",
+		    "UInt",
+		    "10",
+		    lOSS.str()
+		);
+		mFlushInterval = castHandleT<UInt>(
+		                     ioSystem.getRegister().insertEntry("ec.stats.flush", new UInt(10), lDescription));
+	}
+	{
+		std::ostringstream lOSS;
+		lOSS << "Number of demes and size of each deme of the population. ";
+		lOSS << "The format of an UIntArray is S1,S2,...,Sn, where Si is the ith value. ";
+		lOSS << "The size of the UIntArray is the number of demes present in the ";
+		lOSS << "vivarium, while each value of the vector is the size of the corresponding ";
+		lOSS << "deme.";
+		Register::Description lDescription(
+		    "Vivarium and demes sizes",
+		    "UIntArray",
+		    "100",
+		    lOSS.str()
+		);
+		mPopSize = castHandleT<UIntArray>(
+		               ioSystem.getRegister().insertEntry("ec.pop.size", new UIntArray(1,100), lDescription));
+	}
+	Beagle_StackTraceEndM("void StatsWriterOp::registerParams(System&)");
+}
+
+
+/*!
+ *  \brief Buffer the statistics of the deme, and of the vivarium after the last deme.
+ *  \param ioDeme Actual deme of the evolution.
+ *  \param ioContext Context of the evolution.
+ */
+void StatsWriterOp::operate(Deme& ioDeme, Context& ioContext)
+{
+	Beagle_StackTraceBeginM();
+	if(mStatsFilename->getWrappedValue().empty()) return;
+	Beagle_NonNullPointerAssertM(ioDeme.getStats());
+
+	if(mFileStarted == false) {
+		setColumns(*ioDeme.getStats());
+		// A new evolution overwrites the file, while an evolution restarted from
+		// a milestone appends to the existing file.
+		std::ifstream lIFS(mStatsFilename->getWrappedValue().c_str());
+		const bool lFileExists = lIFS.good();
+		lIFS.close();
+		if((ioContext.getGeneration() == 0) || (lFileExists == false)) {
+			std::ofstream lOFS(mStatsFilename->getWrappedValue().c_str(), std::ios_base::out | std::ios_base::trunc);
+			if(!lOFS) {
+				throw Beagle_RunTimeExceptionM(std::string("Could not open statistics file '")+
+				                               mStatsFilename->getWrappedValue()+"' for writing!");
+			}
+			lOFS << "generation,stats,popsize";
+			for(unsigned int i=0; i<mItemTags.size(); ++i) lOFS << ',' << mItemTags[i];
+			for(unsigned int i=0; i<mMeasureIDs.size(); ++i) {
+				lOFS << ',' << mMeasureIDs[i] << "-avg" << ',' << mMeasureIDs[i] << "-std";
+				lOFS << ',' << mMeasureIDs[i] << "-max" << ',' << mMeasureIDs[i] << "-min";
+			}
+			lOFS << '\n';
+		}
+		mFileStarted = true;
+		Beagle_LogDetailedM(
+		    ioContext.getSystem().getLogger(),
+		    "stats", "Beagle::StatsWriterOp",
+		    std::string("Writing statistics into file '")+mStatsFilename->getWrappedValue()+"'"
+		);
+	}
+
+	if(ioDeme.getStats()->isValid()) writeRow(*ioDeme.getStats());
+	if(ioContext.getDemeIndex() != (mPopSize->size()-1)) return;
+	Stats::Handle lVivaStats = ioContext.getVivarium().getStats();
+	if((lVivaStats != NULL) && lVivaStats->isValid()) writeRow(*lVivaStats);
+
+	if(ioContext.getContinueFlag() == true) {
+		if(mFlushInterval->getWrappedValue() == 0) return;
+		if((ioContext.getGeneration() % mFlushInterval->getWrappedValue()) != 0) return;
+	}
+	flush(ioContext);
+	Beagle_StackTraceEndM("void StatsWriterOp::operate(Deme&,Context&)");
+}
+
+
+/*!
+ *  \brief Set the columns of the statistics file from the items and measures of some stats.
+ *  \param inStats Statistics from which the columns are taken.
+ */
+void StatsWriterOp::setColumns(const Stats& inStats)
+{
+	Beagle_StackTraceBeginM();
+	inStats.getItemTags(mItemTags);
+	mMeasureIDs.clear();
+	mMeasureIDs.reserve(inStats.size());
+	for(unsigned int i=0; i<inStats.size(); ++i) mMeasureIDs.push_back(inStats[i].mID);
+	Beagle_StackTraceEndM("void StatsWriterOp::setColumns(const Stats&)");
+}
+
+
+/*!
+ *  \brief Append a row with the given statistics to the buffer.
+ *  \param inStats Statistics to write.
+ */
+void StatsWriterOp::writeRow(const Stats& inStats)
+{
+	Beagle_StackTraceBeginM();
+	std::ostringstream lOSS;
+	lOSS.precision(12);
+	lOSS << inStats.getGeneration() << ',' << inStats.getID() << ',' << inStats.getPopSize();
+	for(unsigned int i=0; i<mItemTags.size(); ++i) {
+		lOSS << ',';
+		if(inStats.existItem(mItemTags[i])) lOSS << inStats.getItem(mItemTags[i]);
+	}
+	for(unsigned int i=0; i<mMeasureIDs.size(); ++i) {
+		// Measures are usually in the same order as the columns
+		unsigned int j = (i < inStats.size()) ? i : 0;
+		if((j >= inStats.size()) || (inStats[j].mID != mMeasureIDs[i])) {
+			for(j=0; j<inStats.size(); ++j) if(inStats[j].mID == mMeasureIDs[i]) break;
+		}
+		if(j < inStats.size()) {
+			lOSS << ',' << inStats[j].mAvg << ',' << inStats[j].mStd;
+			lOSS << ',' << inStats[j].mMax << ',' << inStats[j].mMin;
+		} else lOSS << ",,,,";
+	}
+	lOSS << '\n';
+	mBuffer += lOSS.str();
+	Beagle_StackTraceEndM("void StatsWriterOp::writeRow(const Stats&)");
+}
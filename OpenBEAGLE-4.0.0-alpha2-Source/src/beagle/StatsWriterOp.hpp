@@ -0,0 +1,118 @@
+/*
+ *  Open BEAGLE
+ *  Copyright (C) 2001-2007 by Christian Gagne and Marc Parizeau
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *  Contact:
+ *  Laboratoire de Vision et Systemes Numeriques
+ *  Departement de genie electrique et de genie informatique
+ *  Universite Laval, Quebec, Canada, G1K 7P4
+ *  http://vision.gel.ulaval.ca
+ *
+ */
+
+
+/*!
+ *  \file   beagle/StatsWriterOp.hpp
+ *  \brief  Definition of the class StatsWriterOp.
+ *  \author Christian Gagne
+ *  \author Marc Parizeau
+ *  $Revision: $
+ *  $Date: $
+ */
+
+#ifndef Beagle_StatsWriterOp_hpp
+#define Beagle_StatsWriterOp_hpp
+
+#include <string>
+#include <vector>
+
+#include "beagle/config.hpp"
+#include "beagle/macros.hpp"
+#include "beagle/Object.hpp"
+#include "beagle/AllocatorT.hpp"
+#include "beagle/PointerT.hpp"
+#include "beagle/ContainerT.hpp"
+#include "beagle/WrapperT.hpp"
+#include "beagle/Operator.hpp"
+#include "beagle/UInt.hpp"
+#include "beagle/String.hpp"
+#include "beagle/Stats.hpp"
+#include "beagle/Context.hpp"
+
+namespace Beagle
+{
+
+/*!
+ *  \class StatsWriterOp beagle/StatsWriterOp.hpp "beagle/StatsWriterOp.hpp"
+ *  \brief Append the statistics of each generation into a CSV file.
+ *  \ingroup ECF
+ *  \ingroup Op
+ *  \ingroup FitStats
+ *
+ *  The operator writes one row per deme and per generation, followed by a row for the
+ *  vivarium after the last deme. The columns are the generation, the statistics ID, the
+ *  population size, each item of the statistics and the average, standard deviation,
+ *  maximum and minimum of each measure. The columns are set from the first statistics
+ *  written, items or measures missing from later statistics are left empty.
+ *
+ *  Rows are buffered in memory and appended to the file every \c ec.stats.flush
+ *  generations, at the end of the evolution, and when the operator is destroyed, so that
+ *  rows are not lost when the evolution is interrupted. The operator must be placed after the
+ *  statistics calculation operator in the evolver's main-loop.
+ */
+class StatsWriterOp : public Operator
+{
+
+public:
+
+	//! StatsWriterOp allocator type
+	typedef AllocatorT<StatsWriterOp,Operator::Alloc>
+	Alloc;
+	//! StatsWriterOp handle type.
+	typedef PointerT<StatsWriterOp,Operator::Handle>
+	Handle;
+	//! StatsWriterOp bag type.
+	typedef ContainerT<StatsWriterOp,Operator::Bag>
+	Bag;
+
+	explicit StatsWriterOp(std::string inName="StatsWriterOp");
+	virtual ~StatsWriterOp();
+
+	virtual void registerParams(System& ioSystem);
+	virtual void operate(Deme& ioDeme, Context& ioContext);
+
+protected:
+
+	void flush(Context& ioContext);
+	void setColumns(const Stats& inStats);
+	void writeRow(const Stats& inStats);
+	bool appendBuffer();
+
+private:
+	String::Handle           mStatsFilename;   //!< Name of the statistics file.
+	UInt::Handle             mFlushInterval;   //!< Flushing interval of the file (in generation).
+	UIntArray::Handle        mPopSize;         //!< Population size for the evolution.
+	std::vector<std::string> mItemTags;        //!< Tags of the items written, one column each.
+	std::vector<std::string> mMeasureIDs;      //!< IDs of the measures written, four columns each.
+	std::string              mBuffer;          //!< Rows not yet written into the file.
+	bool                     mFileStarted;     //!< True if the file has been written in this run.
+
+};
+
+}
+
+#endif // Beagle_StatsWriterOp_hpp